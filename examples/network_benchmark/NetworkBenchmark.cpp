@@ -0,0 +1,299 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+
+namespace
+{
+// Size of the messages exchanged between the clients and the server
+constexpr std::size_t messageSize = 32;
+
+// Number of connections opened by each client thread to measure the message rate
+constexpr std::size_t connectionsPerClient = 16;
+
+// Duration of each measurement
+const sf::Time duration = sf::seconds(3);
+
+using Message = std::array<std::byte, messageSize>;
+
+// Function run by each client thread, counting the completed operations
+using Client = void (*)(unsigned short, std::atomic<std::uint64_t>&);
+
+
+////////////////////////////////////////////////////////////
+/// Run one shard of the echo server: accept connections on
+/// the given listener and send back everything they receive,
+/// until `running` becomes false.
+///
+////////////////////////////////////////////////////////////
+void runServerShard(sf::TcpListener& listener, const std::atomic<bool>& running)
+{
+    struct Connection
+    {
+        sf::TcpSocket socket;
+        Message       buffer{};
+    };
+
+    // The sockets must outlive the context, which is destroyed first
+    std::list<Connection> connections;
+    sf::IoContext         context;
+
+    // Abandon the pending operations once the benchmark is over
+    const sf::TimeoutWithPredicate whileRunning([&running] { return running.load(); }, sf::milliseconds(100));
+
+    std::function<void(std::list<Connection>::iterator)> receive;
+    receive = [&](std::list<Connection>::iterator connection)
+    {
+        context.asyncReceive(
+            connection->socket,
+            connection->buffer.data(),
+            connection->buffer.size(),
+            [&, connection](sf::Socket::Status status, std::size_t size)
+            {
+                if (status != sf::Socket::Status::Done)
+                {
+                    connections.erase(connection);
+                    return;
+                }
+
+                // Echo the data back, then wait for the next message
+                context.asyncSend(connection->socket,
+                                  connection->buffer.data(),
+                                  size,
+                                  [&, connection](sf::Socket::Status sendStatus, std::size_t)
+                                  {
+                                      if (sendStatus == sf::Socket::Status::Done)
+                                          receive(connection);
+                                      else
+                                          connections.erase(connection);
+                                  });
+            },
+            whileRunning);
+    };
+
+    std::function<void()> accept;
+    accept = [&]
+    {
+        const auto connection = connections.emplace(connections.end());
+        context.asyncAccept(
+            listener,
+            connection->socket,
+            [&, connection](sf::Socket::Status status)
+            {
+                if (status != sf::Socket::Status::Done)
+                {
+                    connections.erase(connection);
+                    return;
+                }
+
+                // The connection stays handled by this shard until it is closed
+                receive(connection);
+                accept();
+            },
+            whileRunning);
+    };
+
+    accept();
+    while (context.getPendingCount() > 0)
+        context.run();
+}
+
+
+////////////////////////////////////////////////////////////
+/// Connect to the server, exchange a single message and
+/// disconnect, as many times as possible.
+///
+////////////////////////////////////////////////////////////
+void runConnectionClient(unsigned short port, std::atomic<std::uint64_t>& count)
+{
+    const Message   message{};
+    const sf::Clock clock;
+    while (clock.getElapsedTime() < duration)
+    {
+        sf::TcpSocket socket;
+        if (socket.connect(sf::IpAddress::LocalHost, port) != sf::Socket::Status::Done)
+            continue;
+
+        if (socket.send(message.data(), message.size()) != sf::Socket::Status::Done)
+            continue;
+
+        Message     buffer{};
+        std::size_t received = 0;
+        while (received < buffer.size())
+        {
+            std::size_t size = 0;
+            if (socket.receive(&buffer[received], buffer.size() - received, size) != sf::Socket::Status::Done)
+                break;
+            received += size;
+        }
+
+        if (received == buffer.size())
+            ++count;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+/// Open several connections to the server and bounce
+/// messages on each of them for the duration of the
+/// measurement.
+///
+////////////////////////////////////////////////////////////
+void runMessageClient(unsigned short port, std::atomic<std::uint64_t>& count)
+{
+    struct Connection
+    {
+        sf::TcpSocket socket;
+        Message       message{};
+        Message       buffer{};
+        std::size_t   received{};
+    };
+
+    std::list<Connection> connections(connectionsPerClient);
+    sf::IoContext         context;
+    const sf::Clock       clock;
+    std::uint64_t         messages = 0;
+
+    std::function<void(std::list<Connection>::iterator)> send;
+    std::function<void(std::list<Connection>::iterator)> receive;
+
+    send = [&](std::list<Connection>::iterator connection)
+    {
+        context.asyncSend(connection->socket,
+                          connection->message.data(),
+                          connection->message.size(),
+                          [&, connection](sf::Socket::Status status, std::size_t)
+                          {
+                              if (status == sf::Socket::Status::Done)
+                                  receive(connection);
+                          });
+    };
+
+    receive = [&](std::list<Connection>::iterator connection)
+    {
+        context.asyncReceive(connection->socket,
+                             &connection->buffer[connection->received],
+                             connection->buffer.size() - connection->received,
+                             [&, connection](sf::Socket::Status status, std::size_t size)
+                             {
+                                 if (status != sf::Socket::Status::Done)
+                                     return;
+
+                                 // Wait for the rest of the message if it was split
+                                 connection->received += size;
+                                 if (connection->received < connection->buffer.size())
+                                 {
+                                     receive(connection);
+                                     return;
+                                 }
+
+                                 ++messages;
+                                 connection->received = 0;
+                                 if (clock.getElapsedTime() < duration)
+                                     send(connection);
+                             });
+    };
+
+    for (auto connection = connections.begin(); connection != connections.end(); ++connection)
+    {
+        context.asyncConnect(connection->socket,
+                             sf::IpAddress::LocalHost,
+                             port,
+                             [&, connection](sf::Socket::Status status)
+                             {
+                                 if (status == sf::Socket::Status::Done)
+                                     send(connection);
+                             });
+    }
+
+    while (context.getPendingCount() > 0)
+        context.run();
+
+    count += messages;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Run a client function on several threads and return the
+/// number of operations completed per second.
+///
+////////////////////////////////////////////////////////////
+float measure(unsigned int threadCount, unsigned short port, Client client)
+{
+    std::atomic<std::uint64_t> count{};
+    std::vector<std::thread>   threads;
+
+    const sf::Clock clock;
+    for (unsigned int i = 0; i < threadCount; ++i)
+        threads.emplace_back(client, port, std::ref(count));
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    return static_cast<float>(count) / clock.getElapsedTime().asSeconds();
+}
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Entry point of application
+///
+/// \return Application exit code
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    // One server shard per core, if the system can balance connections between them
+    const unsigned int threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    const bool         sharded     = sf::TcpListener().setPortReuse(true);
+    const unsigned int shardCount  = sharded ? threadCount : 1;
+
+    // All the shards listen to the same port, the first one picks it
+    std::vector<sf::TcpListener> listeners(shardCount);
+    unsigned short               port = sf::Socket::AnyPort;
+    for (sf::TcpListener& listener : listeners)
+    {
+        listener.setPortReuse(sharded);
+        if (listener.listen(port, sf::IpAddress::LocalHost) != sf::Socket::Status::Done)
+            return EXIT_FAILURE;
+        port = listener.getLocalPort();
+    }
+
+    const bool completion = (sf::IoContext().getBackend() == sf::IoContext::Backend::Completion);
+    std::cout << "Server running " << shardCount << " shard(s) on port " << port << ", using "
+              << (completion ? "io_uring" : "a socket selector") << std::endl;
+
+    std::atomic<bool>        running{true};
+    std::vector<std::thread> shards;
+    for (sf::TcpListener& listener : listeners)
+        shards.emplace_back(runServerShard, std::ref(listener), std::cref(running));
+
+    std::cout << "Measuring connections per second with " << threadCount << " client thread(s)..." << std::endl;
+    std::cout << "Connections: " << measure(threadCount, port, runConnectionClient) << "/s" << std::endl;
+
+    std::cout << "Measuring messages per second with " << threadCount * connectionsPerClient << " connections..."
+              << std::endl;
+    std::cout << "Messages: " << measure(threadCount, port, runMessageClient) << "/s" << std::endl;
+
+    running = false;
+    for (std::thread& thread : shards)
+        thread.join();
+}
@@ -34,26 +34,35 @@
 #include <SFML/Graphics/ConvexShape.hpp>
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/FrameCapture.hpp>
 #include <SFML/Graphics/Glyph.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/ImageView.hpp>
 #include <SFML/Graphics/PrimitiveType.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderTexturePool.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/SceneGraph.hpp>
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/ShapeGeometry.hpp>
+#include <SFML/Graphics/SpatialIndex.hpp>
 #include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/SpriteBatch.hpp>
 #include <SFML/Graphics/StencilMode.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TileMap.hpp>
 #include <SFML/Graphics/Transform.hpp>
 #include <SFML/Graphics/Transformable.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
 #include <SFML/Graphics/VertexBuffer.hpp>
+#include <SFML/Graphics/VertexLayout.hpp>
 #include <SFML/Graphics/View.hpp>
 
 #include <SFML/Window.hpp>
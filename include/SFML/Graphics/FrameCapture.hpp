@@ -0,0 +1,264 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Image;
+class RenderTarget;
+
+////////////////////////////////////////////////////////////
+/// \brief Asynchronous capture of the frames rendered to
+///        a render target
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API FrameCapture : private GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called by the worker threads for each captured frame
+    ///
+    /// The first argument is the index of the frame, starting at 0,
+    /// and the second one contains its pixels.
+    ///
+    /// The callback is called exactly once for each index. If the
+    /// pixels of a frame couldn't be read back from the graphics
+    /// driver, the callback receives an empty image (of size 0x0)
+    /// for its index.
+    ///
+    ////////////////////////////////////////////////////////////
+    using Callback = std::function<void(std::uint64_t index, const Image& frame)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the frame capture
+    ///
+    /// \a queueDepth is both the number of frames that can be
+    /// read back by the graphics driver at the same time, and
+    /// the number of frames that can wait for a worker thread.
+    /// When the queue is full, `capture` blocks until a worker
+    /// thread is available: frames are never dropped.
+    ///
+    /// \warning When \a threadCount is greater than 1, \a callback
+    ///          is called concurrently and frames are not
+    ///          necessarily processed in capture order.
+    ///
+    /// \param callback    Function called for each captured frame
+    /// \param queueDepth  Maximum number of frames in flight
+    /// \param threadCount Number of worker threads calling \a callback
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit FrameCapture(Callback callback, std::size_t queueDepth = 3, unsigned int threadCount = 1);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Waits until all the captured frames have been processed.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~FrameCapture();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameCapture(const FrameCapture&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameCapture& operator=(const FrameCapture&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameCapture(FrameCapture&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment operator
+    ///
+    ////////////////////////////////////////////////////////////
+    FrameCapture& operator=(FrameCapture&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Capture the current contents of a render target
+    ///
+    /// The transfer of the pixels is only started by this
+    /// function: they are copied to a pixel buffer object by
+    /// the graphics driver while rendering continues, and handed
+    /// to the worker threads by a later call to `capture` or
+    /// `flush`, once the transfer is complete.
+    ///
+    /// If pixel buffer objects or sync objects are not supported
+    /// by the system, the pixels are read back immediately.
+    ///
+    /// For a render window, this function must be called after
+    /// drawing the frame and before calling `display`.
+    ///
+    /// \param target Render target to capture
+    ///
+    /// \return `true` if the capture was started, `false` if the target couldn't be activated
+    ///
+    /// \see `flush`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool capture(RenderTarget& target);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait until all the captured frames have been processed
+    ///
+    /// \see `capture`
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames captured so far
+    ///
+    /// \return Number of calls to `capture` that succeeded
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t getFrameCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports asynchronous readback
+    ///
+    /// When it doesn't, `capture` reads the pixels back
+    /// immediately, which stalls the rendering pipeline.
+    /// The encoding still happens in the worker threads.
+    ///
+    /// \return `true` if pixel buffer objects and sync objects are supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAsynchronousAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a callback saving each frame to its own image file
+    ///
+    /// Frames are saved to \a directory as `frame_000000.ext`,
+    /// `frame_000001.ext`, ... The supported formats are the
+    /// ones of `sf::Image::saveToFile`, such as "png" or "qoi".
+    /// No file is written for frames that couldn't be read back.
+    ///
+    /// \param directory Directory where the files are written
+    /// \param extension Extension of the files, which defines their format
+    ///
+    /// \return Callback to pass to the constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Callback saveToFiles(const std::filesystem::path& directory,
+                                              std::string_view             extension = "png");
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a callback appending the raw pixels of each frame to a file
+    ///
+    /// The 32-bit RGBA pixels of each frame are appended to
+    /// the file, top row first, in capture order even if
+    /// several worker threads are used. This is the cheapest
+    /// way to record clips, to be encoded later by an external
+    /// tool. Frames that couldn't be read back (empty images)
+    /// are skipped.
+    ///
+    /// \param filename Path of the file to write
+    ///
+    /// \return Callback to pass to the constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Callback appendToFile(const std::filesystem::path& filename);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::FrameCapture
+/// \ingroup graphics
+///
+/// Saving screenshots with `sf::Texture::update(window)`,
+/// `sf::Texture::copyToImage` and `sf::Image::saveToFile`
+/// stalls the render thread twice: while the graphics driver
+/// finishes rendering and transfers the pixels, and while the
+/// image is encoded.
+///
+/// `sf::FrameCapture` removes both stalls. The pixels of each
+/// captured frame are transferred to a pixel buffer object
+/// asynchronously, and they are only read a few frames later,
+/// once a fence signals that the transfer is complete. They are
+/// then handed to a pool of worker threads, which call a user
+/// callback to encode or store them.
+///
+/// The number of frames in flight is bounded, so that recording
+/// at full frame rate uses a fixed amount of memory; if the
+/// callbacks can't keep up, `capture` waits for them instead of
+/// dropping frames.
+///
+/// Usage example:
+/// \code
+/// // Record a clip as numbered QOI images, which are fast to encode
+/// sf::FrameCapture capture(sf::FrameCapture::saveToFiles("clip", "qoi"), 4, 2);
+///
+/// while (window.isOpen())
+/// {
+///     window.clear();
+///     window.draw(...);
+///
+///     if (!capture.capture(window))
+///         std::cerr << "Failed to capture the frame" << std::endl;
+///
+///     window.display();
+/// }
+///
+/// // Wait until all the frames are written
+/// capture.flush();
+/// \endcode
+///
+/// \see `sf::Image`, `sf::RenderTarget`
+///
+////////////////////////////////////////////////////////////
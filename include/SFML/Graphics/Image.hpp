@@ -45,7 +45,9 @@
 
 namespace sf
 {
+class ImageView;
 class InputStream;
+class OutputStream;
 
 ////////////////////////////////////////////////////////////
 /// \brief Class for loading, manipulating and saving images
@@ -54,6 +56,31 @@ class InputStream;
 class SFML_GRAPHICS_API Image
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Filter applied to the rows of PNG images before compression
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class PngFilter
+    {
+        Adaptive, //!< Choose the best filter for each row
+        None,     //!< Store the rows unfiltered
+        Sub,      //!< Difference with the pixel on the left
+        Up,       //!< Difference with the pixel above
+        Average,  //!< Difference with the average of the pixels on the left and above
+        Paeth     //!< Difference with the Paeth predictor of the neighboring pixels
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Options controlling how images are encoded
+    ///
+    ////////////////////////////////////////////////////////////
+    struct EncodingOptions
+    {
+        int       compressionLevel{8};            //!< PNG compression level; higher is smaller but slower
+        PngFilter pngFilter{PngFilter::Adaptive}; //!< Filter applied to the rows of PNG images
+        int       jpgQuality{90};                 //!< JPG quality, between 1 and 100
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -86,6 +113,17 @@ public:
     ////////////////////////////////////////////////////////////
     Image(Vector2u size, const std::uint8_t* pixels);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the image from a view of pixels
+    ///
+    /// The pixels of the view are copied to the image, whose
+    /// rows are tightly packed.
+    ///
+    /// \param view View of the pixels to copy to the image
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit Image(const ImageView& view);
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct the image from a file on disk
     ///
@@ -165,6 +203,13 @@ public:
     /// like jpeg with arithmetic coding or ASCII pnm.
     /// If this function fails, the image is left unchanged.
     ///
+    /// Regular files are mapped in memory and decoded in place.
+    /// A file must not be truncated by another process while it
+    /// is being loaded: on Unix systems this raises SIGBUS. Files
+    /// that are still being written when the loading starts, as
+    /// well as pipes and devices, are read sequentially instead.
+    /// Use `loadFromStream` to always read the file sequentially.
+    ///
     /// \param filename Path of the image file to load
     ///
     /// \return `true` if loading was successful
@@ -244,6 +289,48 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::optional<std::vector<std::uint8_t>> saveToMemory(std::string_view format) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Save the image to a custom stream
+    ///
+    /// The format of the image must be specified.
+    /// The supported image formats are bmp, png, tga, jpg and qoi.
+    /// BMP, TGA and JPG data is written to the stream as it is
+    /// produced by the encoder. PNG and QOI images are compressed
+    /// as a whole, so their encoded data is buffered in memory
+    /// before being written to the stream. This function fails
+    /// if the image is empty, if the format was invalid, or if
+    /// the stream reported an error.
+    ///
+    /// \param stream Destination stream to write to
+    /// \param format Encoding format to use
+    ///
+    /// \return `true` if saving was successful
+    ///
+    /// \see `saveToFile`, `saveToMemory`, `loadFromStream`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool saveToStream(OutputStream& stream, std::string_view format) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save the image to a custom stream with specific encoding options
+    ///
+    /// Lower PNG compression levels and a fixed row filter make
+    /// encoding large images significantly faster, at the
+    /// expense of bigger files. PNG images are split in bands
+    /// of rows that are compressed in parallel, and written to
+    /// the stream as soon as the preceding bands are complete.
+    ///
+    /// \param stream  Destination stream to write to
+    /// \param format  Encoding format to use
+    /// \param options Options of the encoder
+    ///
+    /// \return `true` if saving was successful
+    ///
+    /// \see `saveToFile`, `saveToMemory`, `loadFromStream`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool saveToStream(OutputStream& stream, std::string_view format, const EncodingOptions& options) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size (width and height) of the image
     ///
@@ -299,6 +386,31 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool copy(const Image& source, Vector2u dest, const IntRect& sourceRect = {}, bool applyAlpha = false);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy pixels from a view onto this image
+    ///
+    /// This overload copies the pixels of `source` directly from
+    /// the buffer it refers to, which can be a sub-rectangle of
+    /// another image or any strided array of RGBA pixels.
+    ///
+    /// Note that this function can fail if either the view or this
+    /// image is empty, or if the destination position is out of
+    /// the boundaries of this image. Pixels falling outside of this
+    /// image are ignored.
+    ///
+    /// On failure, the destination image is left unchanged.
+    ///
+    /// \param source     View of the pixels to copy
+    /// \param dest       Coordinates of the destination position
+    /// \param applyAlpha Should the copy take into account the source transparency?
+    ///
+    /// \return `true` if the operation was successful, `false` otherwise
+    ///
+    /// \see `sf::ImageView`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool copy(const ImageView& source, Vector2u dest, bool applyAlpha = false);
+
     ////////////////////////////////////////////////////////////
     /// \brief Change the color of a pixel
     ///
@@ -0,0 +1,200 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstdint>
+
+
+namespace sf
+{
+class Image;
+
+////////////////////////////////////////////////////////////
+/// \brief Non-owning view of a rectangle of RGBA pixels
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ImageView
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty view.
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageView() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the view from an array of pixels
+    ///
+    /// The pixel array is assumed to contain 32-bits RGBA pixels,
+    /// and `stride` pixels between the beginnings of two
+    /// consecutive rows. A stride of 0 means that rows are
+    /// tightly packed (i.e. `stride` is `size.x`).
+    ///
+    /// The pixels are not copied: the array must stay alive and
+    /// unchanged as long as the view is used.
+    ///
+    /// \param pixels Array of pixels to view
+    /// \param size   Width and height of the view
+    /// \param stride Number of pixels between the beginnings of two rows
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageView(const std::uint8_t* pixels, Vector2u size, unsigned int stride = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the view from an image
+    ///
+    /// The view covers the whole image. It becomes invalid as
+    /// soon as the image is modified or destroyed.
+    ///
+    /// \param image Image to view
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageView(const Image& image); // NOLINT(google-explicit-constructor)
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a view of a sub-rectangle of this view
+    ///
+    /// No pixel is copied: the returned view points to the same
+    /// pixels, with the same stride.
+    ///
+    /// `area` must be contained within the view.
+    ///
+    /// \param area Sub-rectangle of the view
+    ///
+    /// \return View of the sub-rectangle
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] ImageView getSubView(const IntRect& area) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size (width and height) of the view
+    ///
+    /// \return Size of the view, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the stride of the view
+    ///
+    /// \return Number of pixels between the beginnings of two rows
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getStride() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the rows of the view are tightly packed
+    ///
+    /// \return `true` if the stride is equal to the width of the view, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isContiguous() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the color of a pixel
+    ///
+    /// This function doesn't check the validity of the pixel
+    /// coordinates, using out-of-range values will result in
+    /// an undefined behavior.
+    ///
+    /// \param coords Coordinates of pixel to get
+    ///
+    /// \return Color of the pixel at given coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Color getPixel(Vector2u coords) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a read-only pointer to the first pixel of the view
+    ///
+    /// If the view is empty, a null pointer is returned.
+    ///
+    /// \return Read-only pointer to the first pixel
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::uint8_t* getPixelsPtr() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a read-only pointer to the first pixel of a row
+    ///
+    /// \param y Index of the row
+    ///
+    /// \return Read-only pointer to the first pixel of the row
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::uint8_t* getRowPtr(unsigned int y) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const std::uint8_t* m_pixels{}; //!< First pixel of the view
+    Vector2u            m_size;     //!< Size of the view
+    unsigned int        m_stride{}; //!< Number of pixels between the beginnings of two rows
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ImageView
+/// \ingroup graphics
+///
+/// `sf::ImageView` refers to a rectangle of RGBA pixels owned
+/// by something else, usually a `sf::Image`. It only stores a
+/// pointer, a size and a stride, so it is cheap to copy and to
+/// pass by value.
+///
+/// Views of sub-rectangles keep the stride of their parent, so
+/// that a region of an image can be given to `sf::Texture::update`
+/// or `sf::Image::copy` without first copying it into a
+/// temporary image.
+///
+/// Usage example:
+/// \code
+/// const sf::Image atlas("atlas.png");
+///
+/// // Upload a single tile of the atlas to a texture
+/// const sf::ImageView tile = sf::ImageView(atlas).getSubView({{64, 32}, {32, 32}});
+/// sf::Texture texture(tile.getSize());
+/// texture.update(tile);
+/// \endcode
+///
+/// \see `sf::Image`, `sf::Texture`
+///
+////////////////////////////////////////////////////////////
@@ -37,11 +37,13 @@
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/StencilMode.hpp>
 #include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexLayout.hpp>
 #include <SFML/Graphics/View.hpp>
 
 #include <SFML/System/Vector2.hpp>
 
 #include <array>
+#include <vector>
 
 #include <cstddef>
 #include <cstdint>
@@ -321,6 +323,31 @@ public:
               PrimitiveType       type,
               const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices with a custom layout
+    ///
+    /// This overload allows drawing vertex types that are more
+    /// compact than `sf::Vertex`. Unlike with `sf::Vertex`, small
+    /// batches are not pre-transformed on the CPU.
+    ///
+    /// If the layout is not valid or not supported by the
+    /// system, nothing is drawn.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param layout      Layout of the vertices
+    /// \param states      Render states to use for drawing
+    ///
+    /// \see `sf::VertexLayout`
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const void*         vertices,
+              std::size_t         vertexCount,
+              PrimitiveType       type,
+              const VertexLayout& layout,
+              const RenderStates& states = RenderStates::Default);
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw primitives defined by a vertex buffer
     ///
@@ -523,6 +550,24 @@ private:
     ////////////////////////////////////////////////////////////
     void setupDraw(bool useVertexCache, const RenderStates& states);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set up the vertex arrays according to a vertex layout
+    ///
+    /// \param layout  Layout of the vertices
+    /// \param address Address of the vertex data, or 0 if it is sourced from the bound vertex buffer
+    /// \param states  Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void setupVertexLayout(const VertexLayout& layout, std::uintptr_t address, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Restore the vertex arrays after drawing with a vertex layout
+    ///
+    /// \param layout Layout of the vertices
+    ///
+    ////////////////////////////////////////////////////////////
+    void cleanupVertexLayout(const VertexLayout& layout);
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw the primitives
     ///
@@ -547,18 +592,19 @@ private:
     ////////////////////////////////////////////////////////////
     struct StatesCache
     {
-        bool                  enable{};                //!< Is the cache enabled?
-        bool                  glStatesSet{};           //!< Are our internal GL states set yet?
-        bool                  viewChanged{};           //!< Has the current view changed since last draw?
-        bool                  scissorEnabled{};        //!< Is scissor testing enabled?
-        bool                  stencilEnabled{};        //!< Is stencil testing enabled?
-        BlendMode             lastBlendMode;           //!< Cached blending mode
-        StencilMode           lastStencilMode;         //!< Cached stencil
-        std::uint64_t         lastTextureId{};         //!< Cached texture
-        CoordinateType        lastCoordinateType{};    //!< Texture coordinate type
-        bool                  texCoordsArrayEnabled{}; //!< Is `GL_TEXTURE_COORD_ARRAY` client state enabled?
-        bool                  useVertexCache{};        //!< Did we previously use the vertex cache?
-        std::array<Vertex, 4> vertexCache{};           //!< Pre-transformed vertices cache
+        bool                      enable{};                //!< Is the cache enabled?
+        bool                      glStatesSet{};           //!< Are our internal GL states set yet?
+        bool                      viewChanged{};           //!< Has the current view changed since last draw?
+        bool                      scissorEnabled{};        //!< Is scissor testing enabled?
+        bool                      stencilEnabled{};        //!< Is stencil testing enabled?
+        BlendMode                 lastBlendMode;           //!< Cached blending mode
+        StencilMode               lastStencilMode;         //!< Cached stencil
+        std::uint64_t             lastTextureId{};         //!< Cached texture
+        CoordinateType            lastCoordinateType{};    //!< Texture coordinate type
+        bool                      texCoordsArrayEnabled{}; //!< Is `GL_TEXTURE_COORD_ARRAY` client state enabled?
+        bool                      useVertexCache{};        //!< Did we previously use the vertex cache?
+        std::array<Vertex, 4>     vertexCache{};           //!< Pre-transformed vertices cache
+        std::vector<unsigned int> enabledAttributes;       //!< Shader attribute arrays enabled for the current draw
     };
 
     ////////////////////////////////////////////////////////////
@@ -82,6 +82,28 @@ public:
     ////////////////////////////////////////////////////////////
     RenderTexture(Vector2u size, const ContextSettings& settings = {});
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a render-texture with a given pixel format
+    ///
+    /// The `format` parameter selects the storage format of the
+    /// target texture, for example a floating point format to
+    /// render HDR lighting or a single channel format to render
+    /// masks. It must be supported by the graphics driver, see
+    /// `Texture::isFormatAvailable`. The sRGB capability of
+    /// `settings` only applies to the RGBA8 format.
+    ///
+    /// After creation, the contents of the render-texture are undefined.
+    /// Call `RenderTexture::clear` first to ensure a single color fill.
+    ///
+    /// \param size     Width and height of the render-texture
+    /// \param format   Storage format of the target texture's pixels
+    /// \param settings Additional settings for the underlying OpenGL texture and context
+    ///
+    /// \throws sf::Exception if creation was unsuccessful
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexture(Vector2u size, Texture::Format format, const ContextSettings& settings = {});
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -131,6 +153,26 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool resize(Vector2u size, const ContextSettings& settings = {});
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Resize the render-texture and change its pixel format
+    ///
+    /// The `format` parameter selects the storage format of the
+    /// target texture. It must be supported by the graphics driver,
+    /// see `Texture::isFormatAvailable`. The sRGB capability of
+    /// `settings` only applies to the RGBA8 format.
+    ///
+    /// After resizing, the contents of the render-texture are undefined.
+    /// Call `RenderTexture::clear` first to ensure a single color fill.
+    ///
+    /// \param size     Width and height of the render-texture
+    /// \param format   Storage format of the target texture's pixels
+    /// \param settings Additional settings for the underlying OpenGL texture and context
+    ///
+    /// \return `true` if resizing has been successful, `false` if it failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool resize(Vector2u size, Texture::Format format, const ContextSettings& settings = {});
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the maximum anti-aliasing level supported by the system
     ///
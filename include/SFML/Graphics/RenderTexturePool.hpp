@@ -0,0 +1,263 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <SFML/Window/ContextSettings.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Pool of transient render textures, recycled across
+///        passes and frames
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API RenderTexturePool
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the pool
+    ///
+    /// Render textures that are not used during \a maxUnusedFrames
+    /// consecutive frames are destroyed by `endFrame`, so that
+    /// targets of an obsolete size (for example after the window
+    /// was resized) don't stay allocated forever. Render textures
+    /// used during the current frame are always kept: a value of
+    /// 0 behaves like 1, only the render textures that were not
+    /// used during the frame are destroyed.
+    ///
+    /// \param maxUnusedFrames Number of frames after which an unused render texture is destroyed
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit RenderTexturePool(unsigned int maxUnusedFrames = 2);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool(const RenderTexturePool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool& operator=(const RenderTexturePool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool(RenderTexturePool&&) noexcept = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment operator
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool& operator=(RenderTexturePool&&) noexcept = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a render texture from the pool
+    ///
+    /// A render texture that was released and that matches the
+    /// requested size and settings is reused if possible,
+    /// otherwise a new one is created.
+    ///
+    /// Only the depth bits, stencil bits, anti-aliasing level
+    /// and sRGB capability of \a settings are taken into account
+    /// when matching render textures.
+    ///
+    /// The view of the returned render texture is reset to its
+    /// default view, and its texture is neither smooth nor
+    /// repeated. Its contents are undefined: it should be
+    /// cleared before being drawn to.
+    ///
+    /// The render texture belongs to the caller until it is
+    /// given back with `release`, or until the end of the frame.
+    ///
+    /// \param size     Width and height of the render texture
+    /// \param settings Additional settings for the underlying OpenGL texture and context
+    ///
+    /// \return Pointer to the render texture, or a null pointer if it couldn't be created
+    ///
+    /// \see `release`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] RenderTexture* acquire(Vector2u size, const ContextSettings& settings = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a render texture with a given pixel format from the pool
+    ///
+    /// Render textures are only reused for requests of the same
+    /// pixel format, so that a floating point target is never
+    /// handed out in place of an RGBA8 one, and the other way
+    /// around. The format must be supported by the graphics
+    /// driver, see `Texture::isFormatAvailable`.
+    ///
+    /// Apart from the pixel format, this function behaves like
+    /// the other overload of `acquire`.
+    ///
+    /// \param size     Width and height of the render texture
+    /// \param format   Storage format of the render texture's pixels
+    /// \param settings Additional settings for the underlying OpenGL texture and context
+    ///
+    /// \return Pointer to the render texture, or a null pointer if it couldn't be created
+    ///
+    /// \see `release`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] RenderTexture* acquire(Vector2u size, Texture::Format format, const ContextSettings& settings = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give a render texture back to the pool
+    ///
+    /// Once released, the render texture can be handed out to
+    /// another pass by `acquire`: passes whose lifetimes don't
+    /// overlap share the same render textures this way. It must
+    /// not be used by the caller anymore.
+    ///
+    /// \param renderTexture Render texture returned by `acquire`
+    ///
+    /// \see `acquire`
+    ///
+    ////////////////////////////////////////////////////////////
+    void release(RenderTexture& renderTexture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Notify the pool that the current frame is complete
+    ///
+    /// All the render textures still in use are released, and
+    /// the ones that were not used for too many frames are
+    /// destroyed.
+    ///
+    ////////////////////////////////////////////////////////////
+    void endFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy all the render textures of the pool
+    ///
+    /// No render texture returned by `acquire` must be in use
+    /// when this function is called.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of render textures owned by the pool
+    ///
+    /// \return Number of render textures, in use or not
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSize() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Render texture owned by the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        RenderTexture   renderTexture;   //!< Render texture
+        Texture::Format format{};        //!< Pixel format requested when the render texture was created
+        ContextSettings settings;        //!< Settings requested when the render texture was created
+        std::uint64_t   lastUsedFrame{}; //!< Last frame during which the render texture was acquired
+        bool            inUse{};         //!< Is the render texture currently acquired?
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<std::unique_ptr<Entry>> m_entries;         //!< Render textures owned by the pool
+    unsigned int                        m_maxUnusedFrames; //!< Number of unused frames before destruction
+    std::uint64_t                       m_frame{};         //!< Index of the current frame
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RenderTexturePool
+/// \ingroup graphics
+///
+/// Creating a `sf::RenderTexture` is expensive: it allocates a
+/// texture, depth, stencil and multisample buffers, and a frame
+/// buffer object for each context that uses it. Post-processing
+/// chains typically need several intermediate render textures
+/// every frame, whose sizes follow the size of the window.
+///
+/// `sf::RenderTexturePool` hands out render textures matching a
+/// size and a set of context settings, and recycles them instead
+/// of destroying them. A render texture released by a pass can be
+/// reused by a later pass of the same frame, so that a chain of
+/// passes only needs as many render textures as there are
+/// intermediate results alive at the same time.
+///
+/// Usage example:
+/// \code
+/// sf::RenderTexturePool pool;
+///
+/// while (window.isOpen())
+/// {
+///     const sf::Vector2u size = window.getSize();
+///
+///     sf::RenderTexture* scene = pool.acquire(size);
+///     scene->clear();
+///     scene->draw(...);
+///     scene->display();
+///
+///     // Blur the scene into a new target, the scene is not needed anymore afterwards
+///     sf::RenderTexture* blurred = pool.acquire(size);
+///     blurred->clear();
+///     blurred->draw(sf::Sprite(scene->getTexture()), &blurShader);
+///     blurred->display();
+///     pool.release(*scene);
+///
+///     window.clear();
+///     window.draw(sf::Sprite(blurred->getTexture()));
+///     window.display();
+///
+///     // Release the remaining targets
+///     pool.endFrame();
+/// }
+/// \endcode
+///
+/// \see `sf::RenderTexture`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,281 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Transform.hpp>
+
+#include <limits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class RenderTarget;
+
+////////////////////////////////////////////////////////////
+/// \brief Hierarchy of nodes with cached world transforms
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SceneGraph : public Drawable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of a node of the graph
+    ///
+    ////////////////////////////////////////////////////////////
+    using Id = std::size_t;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Special value used as the parent of root nodes
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr Id NoParent{std::numeric_limits<Id>::max()};
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a node to the graph
+    ///
+    /// The world transform of the new node is its local transform
+    /// combined with the world transform of its parent.
+    ///
+    /// \param parent         Parent of the new node, or `NoParent` to add a root node
+    /// \param localTransform Transform of the node relative to its parent
+    ///
+    /// \return Identifier of the new node
+    ///
+    ////////////////////////////////////////////////////////////
+    Id add(Id parent = NoParent, const Transform& localTransform = Transform::Identity);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a node and all its descendants from the graph
+    ///
+    /// The identifiers of the removed nodes may be reused by
+    /// nodes added later.
+    ///
+    /// \param id Identifier of the node to remove
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(Id id);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the nodes from the graph
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of nodes in the graph
+    ///
+    /// \return Number of nodes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the parent of a node
+    ///
+    /// \param id Identifier of the node
+    ///
+    /// \return Identifier of the parent, or `NoParent` if the node is a root node
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Id getParent(Id id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the transform of a node relative to its parent
+    ///
+    /// The world transforms of the node and of its descendants
+    /// are recomputed the next time they are needed.
+    ///
+    /// The local transform is typically the transform of a
+    /// `sf::Transformable` that describes the node:
+    /// \code
+    /// graph.setLocalTransform(arm, armTransformable.getTransform());
+    /// \endcode
+    ///
+    /// \param id             Identifier of the node
+    /// \param localTransform Transform of the node relative to its parent
+    ///
+    /// \see `getLocalTransform`, `getWorldTransform`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLocalTransform(Id id, const Transform& localTransform);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the transform of a node relative to its parent
+    ///
+    /// \param id Identifier of the node
+    ///
+    /// \return Local transform of the node
+    ///
+    /// \see `setLocalTransform`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Transform& getLocalTransform(Id id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the transform of a node relative to the world
+    ///
+    /// The world transform is the local transform of the node
+    /// combined with the local transforms of all its ancestors.
+    /// If local transforms were changed since the last call, the
+    /// world transforms of the modified nodes and of their
+    /// descendants are recomputed first.
+    ///
+    /// \param id Identifier of the node
+    ///
+    /// \return World transform of the node
+    ///
+    /// \see `getLocalTransform`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Transform& getWorldTransform(Id id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Attach a drawable to a node
+    ///
+    /// The drawable is drawn with the world transform of the
+    /// node when the graph is drawn. It must exist as long as
+    /// the node uses it. A null pointer detaches the current
+    /// drawable, if any.
+    ///
+    /// \param id       Identifier of the node
+    /// \param drawable Drawable to attach, or a null pointer
+    ///
+    /// \see `getDrawable`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDrawable(Id id, const Drawable* drawable);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the drawable attached to a node
+    ///
+    /// \param id Identifier of the node
+    ///
+    /// \return Pointer to the drawable of the node, or a null pointer if it has none
+    ///
+    /// \see `setDrawable`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Drawable* getDrawable(Id id) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the nodes to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of a node in the arrays
+    ///
+    /// \param id Identifier of the node
+    ///
+    /// \return Index of the node
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getIndex(Id id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recompute the world transforms of the modified nodes
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateWorldTransforms() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Transform>            m_localTransforms; //!< Transform of each node relative to its parent
+    mutable std::vector<Transform>    m_worldTransforms; //!< Cached transform of each node relative to the world
+    std::vector<std::size_t>          m_parents;         //!< Index of the parent of each node, or NoParent
+    std::vector<const Drawable*>      m_drawables;       //!< Drawable attached to each node
+    std::vector<Id>                   m_ids;             //!< Identifier of each node
+    mutable std::vector<std::uint8_t> m_dirty;           //!< Must the world transform of each node be recomputed?
+    mutable bool                      m_needUpdate{};    //!< Is any node dirty?
+    std::vector<std::size_t>          m_indices;         //!< Index of the node that owns each identifier
+    std::vector<Id>                   m_freeIds;         //!< Identifiers that are not used by any node
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SceneGraph
+/// \ingroup graphics
+///
+/// `sf::SceneGraph` stores a hierarchy of nodes, each with a
+/// transform relative to its parent (its local transform) and
+/// an optional drawable. It caches the transform of every node
+/// relative to the world, so that the transforms of a hierarchy
+/// (UI panels, skeletal sprites, ...) don't have to be combined
+/// manually every time it is drawn.
+///
+/// Changing the local transform of a node marks it as dirty.
+/// When world transforms are needed, the dirty nodes and their
+/// descendants are recomputed, and the others are left as they
+/// are. Nodes are stored in contiguous arrays, in which every
+/// node comes after its parent: the update is a single linear
+/// pass over the arrays, in which dirty flags are propagated
+/// from parents to children.
+///
+/// Drawing the graph draws the drawables of the nodes in the
+/// order in which the nodes were added, parents before their
+/// children, with their world transform combined with the
+/// transform of the render states.
+///
+/// Usage example:
+/// \code
+/// sf::SceneGraph graph;
+///
+/// sf::Transformable panel;
+/// panel.setPosition({100, 100});
+/// const sf::SceneGraph::Id panelNode = graph.add(sf::SceneGraph::NoParent, panel.getTransform());
+/// graph.setDrawable(panelNode, &panelBackground);
+///
+/// const sf::SceneGraph::Id buttonNode = graph.add(panelNode, sf::Transform().translate({10, 10}));
+/// graph.setDrawable(buttonNode, &buttonSprite);
+///
+/// // Moving the panel moves the button too
+/// panel.move({5, 0});
+/// graph.setLocalTransform(panelNode, panel.getTransform());
+///
+/// window.draw(graph);
+/// \endcode
+///
+/// \see `sf::Transformable`, `sf::Transform`
+///
+////////////////////////////////////////////////////////////
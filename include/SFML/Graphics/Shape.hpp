@@ -315,6 +315,8 @@ protected:
     void update();
 
 private:
+    friend class ShapeGeometry;
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw the shape to a render target
     ///
@@ -394,6 +396,9 @@ private:
 /// \li getPointCount must return the number of points of the shape
 /// \li getPoint must return the points of the shape
 ///
-/// \see `sf::RectangleShape`, `sf::CircleShape`, `sf::ConvexShape`, `sf::Transformable`
+/// Many shapes with the same geometry that only differ by
+/// their transform can share a single `sf::ShapeGeometry`.
+///
+/// \see `sf::RectangleShape`, `sf::CircleShape`, `sf::ConvexShape`, `sf::ShapeGeometry`, `sf::Transformable`
 ///
 ////////////////////////////////////////////////////////////
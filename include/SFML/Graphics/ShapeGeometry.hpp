@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+
+namespace sf
+{
+class RenderTarget;
+class Shape;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Immutable geometry of a shape, shared by several
+///        instances that only differ by their transform
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ShapeGeometry : public Drawable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty geometry, which draws nothing.
+    ///
+    ////////////////////////////////////////////////////////////
+    ShapeGeometry() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Capture the geometry of a shape
+    ///
+    /// The fill and outline vertices of the shape, with their
+    /// colors and texture coordinates, are copied as they are
+    /// when this function is called. Later changes to the shape
+    /// don't affect the geometry.
+    ///
+    /// The transform of the shape (position, rotation, scale
+    /// and origin) is not part of the geometry: it must be given
+    /// in the render states every time the geometry is drawn.
+    ///
+    /// The texture of the shape, if any, must exist as long as
+    /// the geometry uses it.
+    ///
+    /// \param shape Shape to capture
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ShapeGeometry(const Shape& shape);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the source texture of the geometry
+    ///
+    /// \return Pointer to the texture of the captured shape, or a null pointer if it had none
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture* getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the geometry
+    ///
+    /// The returned rectangle is the local bounding rectangle
+    /// of the captured shape, outline included.
+    ///
+    /// \return Local bounding rectangle of the geometry
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getLocalBounds() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the geometry to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const Texture* m_texture{};                                     //!< Texture of the captured shape
+    VertexArray    m_vertices{PrimitiveType::TriangleFan};          //!< Vertex array containing the fill geometry
+    VertexArray    m_outlineVertices{PrimitiveType::TriangleStrip}; //!< Vertex array containing the outline geometry
+    FloatRect      m_bounds; //!< Bounding rectangle of the whole geometry (outline + fill)
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ShapeGeometry
+/// \ingroup graphics
+///
+/// Every `sf::Shape` owns a copy of its fill and outline
+/// vertices. When a scene contains thousands of shapes with
+/// the same points, colors and outline (bullets, particles,
+/// markers...), these copies are identical, and keeping them
+/// up to date costs memory and time for nothing.
+///
+/// `sf::ShapeGeometry` captures the vertices of a shape once.
+/// A single geometry can then be drawn any number of times
+/// with a different transform, so that each instance only
+/// stores a `sf::Transform` (or a `sf::Transformable`) instead
+/// of a whole shape. Since the geometry is immutable, it can
+/// safely be shared, for example through a
+/// `std::shared_ptr<const sf::ShapeGeometry>`.
+///
+/// Usage example:
+/// \code
+/// sf::CircleShape prototype(4.f);
+/// prototype.setFillColor(sf::Color::Red);
+/// prototype.setOutlineThickness(1.f);
+/// prototype.setOrigin(prototype.getGeometricCenter());
+///
+/// const sf::ShapeGeometry bulletGeometry(prototype);
+///
+/// std::vector<sf::Transformable> bullets = ...;
+/// for (const sf::Transformable& bullet : bullets)
+///     window.draw(bulletGeometry, bullet.getTransform());
+/// \endcode
+///
+/// \see `sf::Shape`, `sf::Transformable`
+///
+////////////////////////////////////////////////////////////
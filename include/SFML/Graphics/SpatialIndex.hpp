@@ -0,0 +1,281 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Drawable;
+class View;
+
+////////////////////////////////////////////////////////////
+/// \brief Uniform grid of drawables used to find the ones that are visible in a view
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SpatialIndex
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of an object stored in the index
+    ///
+    ////////////////////////////////////////////////////////////
+    using Id = std::size_t;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the index from the size of its cells
+    ///
+    /// Cells should be about as large as the typical object
+    /// stored in the index: smaller cells make objects span more
+    /// cells, larger cells make queries test more objects.
+    ///
+    /// \param cellSize Size of a cell of the grid, in world units
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SpatialIndex(Vector2f cellSize = {256.f, 256.f});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a drawable to the index
+    ///
+    /// The index only stores a pointer to the drawable: it
+    /// must be kept alive as long as it is in the index.
+    ///
+    /// Drawables are returned by queries in the order in which
+    /// they were inserted, which is meant to be their draw order.
+    ///
+    /// \param drawable Drawable to add
+    /// \param bounds   Bounds of the drawable in world coordinates
+    ///
+    /// \return Identifier of the drawable in the index
+    ///
+    /// \see `update`, `remove`
+    ///
+    ////////////////////////////////////////////////////////////
+    Id insert(const Drawable& drawable, const FloatRect& bounds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the bounds of a drawable
+    ///
+    /// This function must be called whenever the drawable moves
+    /// or changes size, typically with the result of its
+    /// `getGlobalBounds()` function. Only the cells that the
+    /// drawable enters or leaves are modified, which makes
+    /// small movements cheap.
+    ///
+    /// \param id     Identifier of the drawable, as returned by `insert`
+    /// \param bounds New bounds of the drawable in world coordinates
+    ///
+    /// \see `insert`
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(Id id, const FloatRect& bounds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a drawable from the index
+    ///
+    /// \param id Identifier of the drawable, as returned by `insert`
+    ///
+    /// \see `insert`
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(Id id);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the drawables from the index
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of drawables stored in the index
+    ///
+    /// \return Number of drawables
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds of a drawable stored in the index
+    ///
+    /// \param id Identifier of the drawable, as returned by `insert`
+    ///
+    /// \return Bounds of the drawable in world coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const FloatRect& getBounds(Id id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the drawables that intersect an area
+    ///
+    /// The drawables are appended to \a result in draw order.
+    /// The vector is not cleared, so that it can be reused
+    /// from one frame to the next without reallocating.
+    ///
+    /// The index keeps a scratch buffer between queries to avoid
+    /// allocating on each call: concurrent queries on the same
+    /// index must be synchronized, even though this function is
+    /// const.
+    ///
+    /// \param area   Area to test, in world coordinates
+    /// \param result Vector to append the drawables to
+    ///
+    ////////////////////////////////////////////////////////////
+    void query(const FloatRect& area, std::vector<const Drawable*>& result) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the drawables that are visible in a view
+    ///
+    /// This is equivalent to querying the area returned by
+    /// `getVisibleArea(view)`.
+    ///
+    /// \param view   View to test
+    /// \param result Vector to append the drawables to
+    ///
+    ////////////////////////////////////////////////////////////
+    void query(const View& view, std::vector<const Drawable*>& result) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the area of the world that is visible in a view
+    ///
+    /// If the view is rotated, the returned rectangle is the
+    /// axis-aligned bounding box of the visible area.
+    ///
+    /// \param view View to compute the visible area of
+    ///
+    /// \return Visible area, in world coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static FloatRect getVisibleArea(const View& view);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Object stored in the index
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        const Drawable* drawable{};  //!< Drawable, or a null pointer if the slot is free
+        FloatRect       bounds;      //!< Bounds of the drawable in world coordinates
+        IntRect         cells;       //!< Range of cells covered by the drawable
+        std::uint64_t   order{};     //!< Insertion order, used to sort query results
+        bool            oversized{}; //!< Is the drawable too large to be stored in cells?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the range of cells covered by an area
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] IntRect getCellRange(const FloatRect& area) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an object to the cells it covers
+    ///
+    ////////////////////////////////////////////////////////////
+    void link(Id id);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an object from the cells it covers
+    ///
+    ////////////////////////////////////////////////////////////
+    void unlink(Id id);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2f                                           m_cellSize;         //!< Size of a cell of the grid
+    std::vector<Entry>                                 m_entries;          //!< Objects stored in the index
+    std::vector<Id>                                    m_freeIds;          //!< Free slots in m_entries
+    std::unordered_map<std::uint64_t, std::vector<Id>> m_cells;            //!< Objects stored in each non-empty cell
+    std::vector<Id>                                    m_oversizedEntries; //!< Objects tested by every query
+    std::uint64_t                                      m_nextOrder{};      //!< Insertion order of the next object
+    std::size_t                                        m_size{};           //!< Number of objects in the index
+    mutable std::vector<Id>                            m_candidates;       //!< Objects found by the current query
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpatialIndex
+/// \ingroup graphics
+///
+/// `sf::SpatialIndex` stores drawables in a uniform grid according
+/// to their bounds, so that the ones that are visible in a view
+/// can be found without testing every object of the scene. This
+/// is useful when a world contains far more objects than what
+/// is visible on screen at any given time: submitting only the
+/// visible ones saves the CPU cost of the draw calls that would
+/// otherwise be clipped by the GPU.
+///
+/// The index doesn't own the drawables, nor does it know when
+/// they move: whenever the bounds of a drawable change, `update`
+/// has to be called with its new bounds. Objects that are much
+/// larger than a cell are kept in a separate list that is tested
+/// by every query, so that they don't fill the grid.
+///
+/// Usage example:
+/// \code
+/// std::vector<sf::Sprite> sprites = ...;
+///
+/// sf::SpatialIndex index({128.f, 128.f});
+/// std::vector<sf::SpatialIndex::Id> ids;
+/// for (const sf::Sprite& sprite : sprites)
+///     ids.push_back(index.insert(sprite, sprite.getGlobalBounds()));
+///
+/// std::vector<const sf::Drawable*> visible;
+/// while (window.isOpen())
+/// {
+///     // Move a sprite
+///     sprites[0].move({1.f, 0.f});
+///     index.update(ids[0], sprites[0].getGlobalBounds());
+///
+///     // Draw only the visible sprites
+///     visible.clear();
+///     index.query(window.getView(), visible);
+///
+///     window.clear();
+///     for (const sf::Drawable* drawable : visible)
+///         window.draw(*drawable);
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see `sf::View`, `sf::Drawable`
+///
+////////////////////////////////////////////////////////////
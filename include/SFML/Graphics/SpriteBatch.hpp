@@ -0,0 +1,393 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <SFML/System/Angle.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class Sprite;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Drawable collection of sprites stored in
+///        structure-of-arrays form
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SpriteBatch : public Drawable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a sprite to the batch
+    ///
+    /// The sprite is placed at the origin of the world, without
+    /// rotation nor scale, and with a white color.
+    ///
+    /// The `texture` argument refers to a texture that must
+    /// exist as long as the batch uses it.
+    ///
+    /// \param texture     Source texture of the sprite
+    /// \param textureRect Sub-rectangle of the texture displayed by the sprite
+    ///
+    /// \return Index of the new sprite in the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t add(const Texture& texture, const IntRect& textureRect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow adding a sprite with a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t add(const Texture&& texture, const IntRect& textureRect) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a copy of a sprite to the batch
+    ///
+    /// The texture, texture rectangle, color and transformable
+    /// properties of the sprite are copied into the batch.
+    ///
+    /// \param sprite Sprite to copy
+    ///
+    /// \return Index of the new sprite in the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t add(const Sprite& sprite);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove a sprite from the batch
+    ///
+    /// The sprites that follow the removed one are shifted down
+    /// by one index, so that the draw order is preserved.
+    ///
+    /// \param index Index of the sprite to remove
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(std::size_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the sprites from the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of sprites in the batch
+    ///
+    /// \return Number of sprites
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve storage for a number of sprites
+    ///
+    /// \param count Number of sprites to reserve storage for
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the position of a sprite
+    ///
+    /// \param index    Index of the sprite
+    /// \param position New position
+    ///
+    /// \see `getPosition`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPosition(std::size_t index, Vector2f position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the rotation of a sprite
+    ///
+    /// \param index Index of the sprite
+    /// \param angle New rotation
+    ///
+    /// \see `getRotation`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRotation(std::size_t index, Angle angle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the scale factors of a sprite
+    ///
+    /// \param index   Index of the sprite
+    /// \param factors New scale factors
+    ///
+    /// \see `getScale`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setScale(std::size_t index, Vector2f factors);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the local origin of a sprite
+    ///
+    /// \param index  Index of the sprite
+    /// \param origin New origin
+    ///
+    /// \see `getOrigin`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOrigin(std::size_t index, Vector2f origin);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the source texture of a sprite
+    ///
+    /// \param index   Index of the sprite
+    /// \param texture New texture
+    ///
+    /// \see `getTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(std::size_t index, const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(std::size_t index, const Texture&& texture) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the sub-rectangle of the texture displayed by a sprite
+    ///
+    /// \param index     Index of the sprite
+    /// \param rectangle Rectangle defining the region of the texture to display
+    ///
+    /// \see `getTextureRect`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTextureRect(std::size_t index, const IntRect& rectangle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the global color of a sprite
+    ///
+    /// \param index Index of the sprite
+    /// \param color New color of the sprite
+    ///
+    /// \see `getColor`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setColor(std::size_t index, Color color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Current position
+    ///
+    /// \see `setPosition`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getPosition(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the rotation of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Current rotation
+    ///
+    /// \see `setRotation`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Angle getRotation(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the scale factors of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Current scale factors
+    ///
+    /// \see `setScale`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getScale(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local origin of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Current origin
+    ///
+    /// \see `setOrigin`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getOrigin(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the source texture of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Reference to the sprite's texture
+    ///
+    /// \see `setTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTexture(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sub-rectangle of the texture displayed by a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Texture rectangle of the sprite
+    ///
+    /// \see `setTextureRect`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const IntRect& getTextureRect(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global color of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Global color of the sprite
+    ///
+    /// \see `setColor`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Color getColor(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of a sprite
+    ///
+    /// \param index Index of the sprite
+    ///
+    /// \return Global bounding rectangle of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getGlobalBounds(std::size_t index) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the sprites to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the geometry of a sprite as needing an update
+    ///
+    /// \param index Index of the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidate(std::size_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the vertices of the sprites that have changed
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateVertices() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Vector2f>       m_positions;    //!< Position of each sprite
+    std::vector<float>          m_rotations;    //!< Rotation of each sprite, in radians
+    std::vector<Vector2f>       m_scales;       //!< Scale factors of each sprite
+    std::vector<Vector2f>       m_origins;      //!< Local origin of each sprite
+    std::vector<IntRect>        m_textureRects; //!< Texture rectangle of each sprite
+    std::vector<Color>          m_colors;       //!< Color of each sprite
+    std::vector<const Texture*> m_textures;     //!< Texture of each sprite
+    mutable std::vector<Vertex> m_vertices;     //!< Vertices of the sprites, 6 per sprite
+    mutable std::size_t         m_dirtyBegin{}; //!< Index of the first sprite whose vertices must be updated
+    mutable std::size_t         m_dirtyEnd{};   //!< Index past the last sprite whose vertices must be updated
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpriteBatch
+/// \ingroup graphics
+///
+/// `sf::SpriteBatch` stores a collection of sprites and draws
+/// them with as few draw calls as possible: one for each run
+/// of consecutive sprites sharing the same texture.
+///
+/// Unlike a collection of `sf::Sprite`, the batch doesn't store
+/// a `sf::Transformable` per sprite. Instead, positions, rotations,
+/// scales, origins, texture rectangles and colors are each stored
+/// in their own contiguous array, and the vertices of all the
+/// sprites that changed since the last draw are generated in a
+/// single pass over those arrays. This keeps the memory accessed
+/// when updating a large number of sprites compact, and avoids a
+/// virtual call per sprite when drawing them.
+///
+/// Sprites are identified by their index in the batch, which is
+/// also their draw order. Use a single texture atlas for all the
+/// sprites of a batch to draw it with a single draw call.
+///
+/// Usage example:
+/// \code
+/// const sf::Texture atlas("atlas.png");
+///
+/// sf::SpriteBatch batch;
+/// for (int i = 0; i < 10000; ++i)
+/// {
+///     const std::size_t index = batch.add(atlas, {{0, 0}, {16, 16}});
+///     batch.setPosition(index, {static_cast<float>(i % 100) * 8.f, static_cast<float>(i / 100) * 6.f});
+///     batch.setOrigin(index, {8.f, 8.f});
+/// }
+///
+/// while (window.isOpen())
+/// {
+///     for (std::size_t i = 0; i < batch.getSize(); ++i)
+///         batch.setRotation(i, batch.getRotation(i) + sf::degrees(1));
+///
+///     window.clear();
+///     window.draw(batch);
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see `sf::Sprite`, `sf::Texture`
+///
+////////////////////////////////////////////////////////////
@@ -47,6 +47,7 @@ namespace sf
 class InputStream;
 class Window;
 class Image;
+class ImageView;
 
 ////////////////////////////////////////////////////////////
 /// \brief Image living on the graphics card that can be used for drawing
@@ -55,6 +56,30 @@ class Image;
 class SFML_GRAPHICS_API Texture : GlResource
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Storage format of the texture's pixels
+    ///
+    /// RGBA8 is the format of `sf::Image` and `sf::Color`, and
+    /// the only one that is always available. The other formats
+    /// store fewer channels or more precision per channel, and
+    /// require support from the graphics driver (see
+    /// `isFormatAvailable`).
+    ///
+    /// Channels that a format doesn't store read as 0 for green
+    /// and blue, and 1 for alpha, when the texture is sampled.
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Format
+    {
+        RGBA8,   //!< Red, green, blue and alpha channels, 8-bit normalized integers
+        R8,      //!< Red channel, 8-bit normalized integer
+        RG8,     //!< Red and green channels, 8-bit normalized integers
+        R16F,    //!< Red channel, 16-bit floating point number
+        RGBA16F, //!< Red, green, blue and alpha channels, 16-bit floating point numbers
+        R32F,    //!< Red channel, 32-bit floating point number
+        RGBA32F  //!< Red, green, blue and alpha channels, 32-bit floating point numbers
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -265,6 +290,17 @@ public:
     ////////////////////////////////////////////////////////////
     explicit Texture(Vector2u size, bool sRgb = false);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the texture with a given size and pixel format
+    ///
+    /// \param size   Width and height of the texture
+    /// \param format Storage format of the texture's pixels
+    ///
+    /// \throws sf::Exception if construction was unsuccessful
+    ///
+    ////////////////////////////////////////////////////////////
+    Texture(Vector2u size, Format format);
+
     ////////////////////////////////////////////////////////////
     /// \brief Resize the texture
     ///
@@ -278,6 +314,22 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool resize(Vector2u size, bool sRgb = false);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Resize the texture and change its pixel format
+    ///
+    /// This function fails if `format` is not supported by
+    /// the graphics driver, see `isFormatAvailable`.
+    ///
+    /// If this function fails, the texture is left unchanged.
+    ///
+    /// \param size   Width and height of the texture
+    /// \param format Storage format of the texture's pixels
+    ///
+    /// \return `true` if resizing was successful, `false` if it failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool resize(Vector2u size, Format format);
+
     ////////////////////////////////////////////////////////////
     /// \brief Load the texture from a file on disk
     ///
@@ -387,6 +439,16 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Vector2u getSize() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the storage format of the texture's pixels
+    ///
+    /// \return Pixel format of the texture
+    ///
+    /// \see `resize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Format getFormat() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Copy the texture pixels to an image
     ///
@@ -395,6 +457,11 @@ public:
     /// them to a new image, potentially applying transformations
     /// to pixels if necessary (texture may be padded or flipped).
     ///
+    /// Pixels of textures that don't use the RGBA8 format are
+    /// converted: missing channels are filled with 0 for green and
+    /// blue and 255 for alpha, and floating point values are
+    /// clamped to the [0, 1] range.
+    ///
     /// \return Image containing the texture's pixels
     ///
     /// \see `loadFromImage`
@@ -406,7 +473,11 @@ public:
     /// \brief Update the whole texture from an array of pixels
     ///
     /// The pixel array is assumed to have the same size as
-    /// the `area` rectangle, and to contain 32-bits RGBA pixels.
+    /// the `area` rectangle, and to contain pixels in the format
+    /// of the texture: one byte per channel stored by the format
+    /// (32-bits RGBA pixels for RGBA8, 8-bits pixels for R8, ...).
+    /// Floating point formats convert the bytes from the [0, 255]
+    /// range to the [0, 1] range.
     ///
     /// No additional check is performed on the size of the pixel
     /// array. Passing invalid arguments will lead to an undefined
@@ -424,7 +495,11 @@ public:
     /// \brief Update a part of the texture from an array of pixels
     ///
     /// The size of the pixel array must match the `size` argument,
-    /// and it must contain 32-bits RGBA pixels.
+    /// and it must contain pixels in the format of the texture:
+    /// one byte per channel stored by the format (32-bits RGBA
+    /// pixels for RGBA8, 8-bits pixels for R8, ...).
+    /// Floating point formats convert the bytes from the [0, 255]
+    /// range to the [0, 1] range.
     ///
     /// No additional check is performed on the size of the pixel
     /// array or the bounds of the area to update. Passing invalid
@@ -440,6 +515,49 @@ public:
     ////////////////////////////////////////////////////////////
     void update(const std::uint8_t* pixels, Vector2u size, Vector2u dest);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the whole texture from an array of floating point pixels
+    ///
+    /// The pixel array is assumed to have the same size as the
+    /// texture, and to contain one `float` per channel stored by
+    /// the format of the texture (4 for RGBA16F, 1 for R32F, ...).
+    /// This is the way to give floating point textures values
+    /// outside of the [0, 1] range. Values are clamped to the
+    /// [0, 1] range by formats that store normalized integers.
+    ///
+    /// No additional check is performed on the size of the pixel
+    /// array. Passing invalid arguments will lead to an undefined
+    /// behavior.
+    ///
+    /// This function does nothing if `pixels` is `nullptr`
+    /// or if the texture was not previously created.
+    ///
+    /// \param pixels Array of pixels to copy to the texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const float* pixels);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the texture from an array of floating point pixels
+    ///
+    /// The size of the pixel array must match the `size` argument,
+    /// and it must contain one `float` per channel stored by the
+    /// format of the texture (4 for RGBA16F, 1 for R32F, ...).
+    ///
+    /// No additional check is performed on the size of the pixel
+    /// array or the bounds of the area to update. Passing invalid
+    /// arguments will lead to an undefined behavior.
+    ///
+    /// This function does nothing if `pixels` is null or if the
+    /// texture was not previously created.
+    ///
+    /// \param pixels Array of pixels to copy to the texture
+    /// \param size   Width and height of the pixel region contained in `pixels`
+    /// \param dest   Coordinates of the destination position
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const float* pixels, Vector2u size, Vector2u dest);
+
     ////////////////////////////////////////////////////////////
     /// \brief Update a part of this texture from another texture
     ///
@@ -514,6 +632,42 @@ public:
     ////////////////////////////////////////////////////////////
     void update(const Image& image, Vector2u dest);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the texture from a view of pixels
+    ///
+    /// The pixels are uploaded directly from the buffer the view
+    /// refers to, even if its rows are not tightly packed: a
+    /// sub-rectangle of an image can be uploaded without copying
+    /// it into a temporary image first.
+    ///
+    /// No additional check is performed on the size of the view.
+    /// Passing a view bigger than the texture will lead to an
+    /// undefined behavior.
+    ///
+    /// This function does nothing if the texture was not
+    /// previously created.
+    ///
+    /// \param view View of the pixels to copy to the texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const ImageView& view);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the texture from a view of pixels
+    ///
+    /// No additional check is performed on the size of the view.
+    /// Passing an invalid combination of view size and destination
+    /// will lead to an undefined behavior.
+    ///
+    /// This function does nothing if the texture was not
+    /// previously created.
+    ///
+    /// \param view View of the pixels to copy to the texture
+    /// \param dest Coordinates of the destination position
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const ImageView& view, Vector2u dest);
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the texture from the contents of a window
     ///
@@ -711,6 +865,22 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static unsigned int getMaximumSize();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports a pixel format
+    ///
+    /// RGBA8 is always available. R8 and RG8 require the
+    /// ARB_texture_rg extension (core since OpenGL 3.0), RGBA16F
+    /// and RGBA32F require the ARB_texture_float extension (core
+    /// since OpenGL 3.0), R16F and R32F require both. None of the
+    /// other formats is available on OpenGL ES.
+    ///
+    /// \param format Pixel format to check
+    ///
+    /// \return `true` if textures can be created with this format, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isFormatAvailable(Format format);
+
 private:
     friend class Text;
     friend class RenderTexture;
@@ -740,12 +910,43 @@ private:
     ////////////////////////////////////////////////////////////
     void invalidateMipmap();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Resize the texture and change its pixel format
+    ///
+    /// \param size   Width and height of the texture
+    /// \param format Storage format of the texture's pixels
+    /// \param sRgb   `true` to enable sRGB conversion (RGBA8 only), `false` to disable it
+    ///
+    /// \return `true` if resizing was successful, `false` if it failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool resize(Vector2u size, Format format, bool sRgb);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload an array of pixels to a part of the texture
+    ///
+    /// \param pixels      Array of pixels to copy to the texture
+    /// \param size        Width and height of the pixel region contained in `pixels`
+    /// \param dest        Coordinates of the destination position
+    /// \param pixelFormat OpenGL format of the pixels (GL_RGBA, GL_RED, ...)
+    /// \param pixelType   OpenGL type of the channels (GL_UNSIGNED_BYTE or GL_FLOAT)
+    /// \param rowLength   Number of pixels between the beginnings of two rows, 0 if rows are tightly packed
+    ///
+    ////////////////////////////////////////////////////////////
+    void updatePixels(const void*  pixels,
+                      Vector2u     size,
+                      Vector2u     dest,
+                      unsigned int pixelFormat,
+                      unsigned int pixelType,
+                      unsigned int rowLength = 0);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     Vector2u      m_size;            //!< Public texture size
     Vector2u      m_actualSize;      //!< Actual texture size (can be greater than public size because of padding)
     unsigned int  m_texture{};       //!< Internal texture identifier
+    Format        m_format{};        //!< Storage format of the pixels
     bool          m_isSmooth{};      //!< Status of the smooth filter
     bool          m_sRgb{};          //!< Should the texture source be converted from sRGB?
     bool          m_isRepeated{};    //!< Is the texture in repeat mode?
@@ -802,10 +1003,25 @@ SFML_GRAPHICS_API void swap(Texture& left, Texture& right) noexcept;
 /// store the collision information separately, for example in an array
 /// of booleans.
 ///
-/// Like `sf::Image`, `sf::Texture` can handle a unique internal
-/// representation of pixels, which is RGBA 32 bits. This means
-/// that a pixel must be composed of 8 bit red, green, blue and
-/// alpha channels -- just like a `sf::Color`.
+/// Like `sf::Image`, `sf::Texture` uses RGBA 32 bits as its
+/// default internal representation of pixels. This means that
+/// a pixel is composed of 8 bit red, green, blue and alpha
+/// channels -- just like a `sf::Color`.
+///
+/// Textures that don't need four 8 bit channels can use another
+/// `sf::Texture::Format`: a single channel mask (R8) takes a
+/// quarter of the memory and bandwidth of an RGBA texture, and
+/// floating point formats (R16F, RGBA16F, R32F, RGBA32F) store
+/// values outside of the [0, 1] range, for HDR lighting or
+/// distance fields for example.
+/// \code
+/// if (sf::Texture::isFormatAvailable(sf::Texture::Format::R32F))
+/// {
+///     sf::Texture distanceField({256, 256}, sf::Texture::Format::R32F);
+///     std::vector<float> distances = ...; // one float per pixel
+///     distanceField.update(distances.data());
+/// }
+/// \endcode
 ///
 /// When providing texture data from an image file or memory, it can
 /// either be stored in a linear color space or an sRGB color space.
@@ -0,0 +1,292 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Drawable grid of tiles taken from a tileset texture
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TileMap : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the tile map
+    ///
+    /// All the tiles are initialized to the first tile of
+    /// the tileset.
+    ///
+    /// \param tileset   Texture containing the tiles, arranged in rows
+    /// \param tileSize  Size of a tile, in pixels
+    /// \param mapSize   Size of the map, in tiles
+    /// \param chunkSize Width and height of a chunk, in tiles
+    ///
+    /// \see `setTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap(const Texture& tileset, Vector2u tileSize, Vector2u mapSize, unsigned int chunkSize = 32);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow construction from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap(const Texture&& tileset, Vector2u tileSize, Vector2u mapSize, unsigned int chunkSize = 32) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the tileset texture of the tile map
+    ///
+    /// The `tileset` argument refers to a texture that must
+    /// exist as long as the tile map uses it. Indeed, the tile
+    /// map doesn't store its own copy of the texture, but rather
+    /// keeps a pointer to the one that you passed to this function.
+    ///
+    /// Since the texture coordinates of the tiles depend on the
+    /// size of the tileset, the whole map is uploaded again the
+    /// next time it is drawn.
+    ///
+    /// \param tileset New tileset texture
+    ///
+    /// \see `getTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture& tileset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture&& tileset) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a tile of the map
+    ///
+    /// Tiles are numbered from left to right and from top to
+    /// bottom in the tileset. Only the chunk containing the tile
+    /// is uploaded again the next time it is drawn, and only
+    /// the part of it that has changed.
+    ///
+    /// \param position Position of the tile in the map, in tiles
+    /// \param tile     Index of the tile in the tileset
+    ///
+    /// \see `getTile`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTile(Vector2u position, unsigned int tile);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a tile of the map
+    ///
+    /// \param position Position of the tile in the map, in tiles
+    ///
+    /// \return Index of the tile in the tileset
+    ///
+    /// \see `setTile`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getTile(Vector2u position) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the tileset texture of the tile map
+    ///
+    /// \return Reference to the tile map's texture
+    ///
+    /// \see `setTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a tile
+    ///
+    /// \return Size of a tile, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getTileSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the map
+    ///
+    /// \return Size of the map, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getMapSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a chunk
+    ///
+    /// \return Width and height of a chunk, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getChunkSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in local coordinates, which means
+    /// that it ignores the transformations (translation, rotation,
+    /// scale, ...) that are applied to the entity.
+    /// In other words, this function returns the bounds of the
+    /// entity in the entity's coordinate system.
+    ///
+    /// \return Local bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in global coordinates, which means
+    /// that it takes into account the transformations (translation,
+    /// rotation, scale, ...) that are applied to the entity.
+    /// In other words, this function returns the bounds of the
+    /// tile map in the global 2D world's coordinate system.
+    ///
+    /// \return Global bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getGlobalBounds() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Square block of tiles drawn with a single draw call
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        VertexBuffer        vertexBuffer; //!< Geometry of the chunk
+        std::vector<Vertex> vertices;     //!< Geometry of the chunk when vertex buffers are not available
+        Vector2u            position;     //!< Position of the first tile of the chunk in the map, in tiles
+        Vector2u            size;         //!< Size of the chunk, in tiles
+        std::size_t         dirtyBegin{}; //!< Index of the first tile that must be uploaded
+        std::size_t         dirtyEnd{};   //!< Index past the last tile that must be uploaded
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the tile map to a render target
+    ///
+    /// Only the chunks that intersect the view of the target
+    /// are drawn.
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the tiles of a chunk that have changed
+    ///
+    /// \param chunk Chunk to update
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateChunk(Chunk& chunk) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark all the tiles of all the chunks as changed
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidateChunks();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const Texture*              m_texture;      //!< Tileset texture
+    Vector2u                    m_tileSize;     //!< Size of a tile, in pixels
+    Vector2u                    m_mapSize;      //!< Size of the map, in tiles
+    unsigned int                m_chunkSize;    //!< Width and height of a chunk, in tiles
+    Vector2u                    m_chunkCount;   //!< Number of chunks in each direction
+    std::vector<unsigned int>   m_tiles;        //!< Tiles of the map, row by row
+    mutable std::vector<Chunk>  m_chunks;       //!< Chunks of the map, row by row
+    mutable std::vector<Vertex> m_uploadBuffer; //!< Temporary storage for the vertices being uploaded
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TileMap
+/// \ingroup graphics
+///
+/// `sf::TileMap` is a drawable class that displays a large grid
+/// of tiles, all taken from the same tileset texture.
+///
+/// The map is split into square chunks of tiles, each of which
+/// is stored in a static `sf::VertexBuffer` and drawn with a
+/// single draw call. The geometry of the map is only uploaded
+/// to the graphics card when it changes: changing a tile only
+/// uploads the modified part of the chunk containing it, the
+/// next time that chunk is drawn. Chunks that don't intersect
+/// the view of the render target are not drawn at all, which
+/// keeps the cost of drawing a map proportional to the visible
+/// area rather than to the size of the map.
+///
+/// If vertex buffers are not available, the geometry of the
+/// chunks is kept in system memory and drawn from there.
+///
+/// Like `sf::Sprite`, `sf::TileMap` inherits all the functions
+/// from `sf::Transformable` and only keeps a reference to its
+/// texture, which must not be destroyed while it is used.
+///
+/// Usage example:
+/// \code
+/// // Load a tileset made of 32x32 tiles
+/// const sf::Texture tileset("tileset.png");
+///
+/// // Create a 1024x1024 map
+/// sf::TileMap map(tileset, {32, 32}, {1024, 1024});
+/// for (unsigned int y = 0; y < 1024; ++y)
+///     for (unsigned int x = 0; x < 1024; ++x)
+///         map.setTile({x, y}, level[x + y * 1024]);
+///
+/// // Draw it
+/// window.draw(map);
+/// \endcode
+///
+/// \see `sf::Texture`, `sf::VertexBuffer`, `sf::Transformable`
+///
+////////////////////////////////////////////////////////////
@@ -35,10 +35,13 @@
 
 #include <array>
 
+#include <cstddef>
+
 
 namespace sf
 {
 class Angle;
+struct Vertex;
 
 ////////////////////////////////////////////////////////////
 /// \brief 3x3 transform matrix
@@ -131,6 +134,40 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] constexpr FloatRect transformRect(const FloatRect& rectangle) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform an array of 2D points
+    ///
+    /// The result is the same as calling `transformPoint` on
+    /// every point, but the whole array is processed in a single
+    /// loop that the compiler can vectorize, which is much faster
+    /// for large arrays.
+    ///
+    /// `points` and `result` can be the same array, to transform
+    /// points in place. Other overlaps are not allowed.
+    ///
+    /// \param points Array of points to transform
+    /// \param count  Number of points to transform
+    /// \param result Array receiving the `count` transformed points
+    ///
+    /// \see `transformPoint`, `transformVertices`
+    ///
+    ////////////////////////////////////////////////////////////
+    SFML_GRAPHICS_API void transformPoints(const Vector2f* points, std::size_t count, Vector2f* result) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform the positions of an array of vertices in place
+    ///
+    /// The colors and texture coordinates of the vertices are
+    /// left unchanged.
+    ///
+    /// \param vertices Array of vertices to transform
+    /// \param count    Number of vertices to transform
+    ///
+    /// \see `transformPoints`
+    ///
+    ////////////////////////////////////////////////////////////
+    SFML_GRAPHICS_API void transformVertices(Vertex* vertices, std::size_t count) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Combine the current transform with another one
     ///
@@ -32,9 +32,12 @@
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/PrimitiveType.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/VertexLayout.hpp>
 
 #include <SFML/Window/GlResource.hpp>
 
+#include <vector>
+
 #include <cstddef>
 
 
@@ -139,6 +142,38 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool create(std::size_t vertexCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the vertex buffer as a ring of regions for streaming updates
+    ///
+    /// Allocates enough graphics memory to hold `regionCount`
+    /// regions of `vertexCount` vertices each. Every call to
+    /// `mapRegion` hands out the next region of the ring, so new
+    /// vertex data can be written while the GPU is still reading
+    /// the regions that were submitted during previous frames.
+    ///
+    /// If the system supports persistent buffer mapping and
+    /// fence objects, the whole buffer stays mapped for its
+    /// entire lifetime and writing to a region does not involve
+    /// the driver at all. Otherwise the region is written to
+    /// system memory and uploaded when it is unmapped.
+    ///
+    /// This mode is meant for vertex buffers whose usage is
+    /// `Usage::Stream` or `Usage::Dynamic`. After creation,
+    /// `getVertexCount` returns the size of a single region.
+    ///
+    /// If `regionCount` is less than 2 or `vertexCount` is 0,
+    /// this function behaves exactly like `create(vertexCount)`.
+    ///
+    /// \param vertexCount Number of vertices worth of memory to allocate per region
+    /// \param regionCount Number of regions to allocate
+    ///
+    /// \return `true` if creation was successful
+    ///
+    /// \see `mapRegion`, `unmapRegion`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t vertexCount, std::size_t regionCount);
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the vertex count
     ///
@@ -187,6 +222,11 @@ public:
     /// If `offset` is not 0 and `offset` + `vertexCount` is greater
     /// than the size of the currently created buffer, the update fails.
     ///
+    /// If the buffer was created with multiple regions, the vertices
+    /// are written to the next region as if `mapRegion` and
+    /// `unmapRegion` were used. In this case `offset` must be 0 and
+    /// `vertexCount` must not be greater than the size of a region.
+    ///
     /// No additional check is performed on the size of the vertex
     /// array. Passing invalid arguments will lead to undefined
     /// behavior.
@@ -200,9 +240,34 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool update(const Vertex* vertices, std::size_t vertexCount, unsigned int offset);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of custom vertices
+    ///
+    /// This function behaves like the `sf::Vertex` overload, but
+    /// accepts any vertex type matching the layout of the buffer.
+    /// The update fails if the size of `T` is not equal to the
+    /// stride of the layout.
+    ///
+    /// \param vertices    Array of vertices to copy to the buffer
+    /// \param vertexCount Number of vertices to copy
+    /// \param offset      Offset in the buffer to copy to
+    ///
+    /// \return `true` if the update was successful
+    ///
+    /// \see `setLayout`
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    [[nodiscard]] bool update(const T* vertices, std::size_t vertexCount, unsigned int offset);
+
     ////////////////////////////////////////////////////////////
     /// \brief Copy the contents of another buffer into this buffer
     ///
+    /// If `vertexBuffer` was created with multiple regions, the
+    /// region that is currently drawn is copied. Copying into a
+    /// buffer that was created with multiple regions is not
+    /// supported.
+    ///
     /// \param vertexBuffer Vertex buffer whose contents to copy into this vertex buffer
     ///
     /// \return `true` if the copy was successful
@@ -210,6 +275,98 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool update(const VertexBuffer& vertexBuffer);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Map the next region of the buffer for writing
+    ///
+    /// The returned pointer gives access to `getVertexCount()`
+    /// vertices. It stays valid until `unmapRegion` is called.
+    /// Only one region can be mapped at a time.
+    ///
+    /// This function only blocks if the GPU is still reading the
+    /// requested region, i.e. if the application is more than
+    /// `getRegionCount() - 1` frames ahead of the GPU.
+    ///
+    /// This function fails if the buffer was not created with
+    /// `create(vertexCount, regionCount)` or if a region is
+    /// already mapped.
+    ///
+    /// \code
+    /// sf::VertexBuffer buffer(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Stream);
+    /// if (!buffer.create(vertexCount, 3))
+    ///     return;
+    ///
+    /// while (window.isOpen())
+    /// {
+    ///     if (sf::Vertex* vertices = buffer.mapRegion())
+    ///     {
+    ///         // write up to vertexCount vertices...
+    ///         (void)buffer.unmapRegion();
+    ///     }
+    ///
+    ///     window.clear();
+    ///     window.draw(buffer);
+    ///     window.display();
+    /// }
+    /// \endcode
+    ///
+    /// \return Pointer to the mapped region, or a null pointer on failure
+    ///
+    /// \see `unmapRegion`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vertex* mapRegion();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Map the next region of the buffer for writing custom vertices
+    ///
+    /// This function behaves like the `sf::Vertex` overload, but
+    /// accepts any vertex type matching the layout of the buffer.
+    /// Mapping fails if the size of `T` is not equal to the stride
+    /// of the layout.
+    ///
+    /// \return Pointer to the mapped region, or a null pointer on failure
+    ///
+    /// \see `unmapRegion`, `setLayout`
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    [[nodiscard]] T* mapRegion();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit the region previously mapped with `mapRegion`
+    ///
+    /// Once unmapped, the region becomes the one that is used
+    /// when drawing the vertex buffer. The pointer returned by
+    /// `mapRegion` must not be used anymore after this call.
+    ///
+    /// \return `true` if the region was successfully submitted
+    ///
+    /// \see `mapRegion`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool unmapRegion();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of regions the buffer is split into
+    ///
+    /// \return Number of regions, 1 if the buffer is not multi-buffered
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getRegionCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the offset of the region that is currently drawn
+    ///
+    /// This is the offset, in vertices, of the region that was
+    /// last submitted with `unmapRegion`. You shouldn't need to
+    /// use this function, unless you mix `sf::VertexBuffer` with
+    /// OpenGL code.
+    ///
+    /// \return Offset of the current region in vertices
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getRegionOffset() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Overload of assignment operator
     ///
@@ -286,6 +443,35 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Usage getUsage() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the layout of the vertices stored in this vertex buffer
+    ///
+    /// The layout defines the size of a vertex and how its
+    /// attributes are read when the buffer is drawn. It allows
+    /// storing vertex types that are more compact than `sf::Vertex`.
+    ///
+    /// Since the layout defines the size of a vertex, a buffer
+    /// that was already created is created again, with the same
+    /// number of vertices and regions, when the size of a vertex
+    /// changes. Its previous contents are lost.
+    ///
+    /// The default layout matches `sf::Vertex`.
+    ///
+    /// \param layout Layout of the vertices
+    ///
+    /// \see `sf::VertexLayout`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLayout(const VertexLayout& layout);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the layout of the vertices stored in this vertex buffer
+    ///
+    /// \return Layout of the vertices
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const VertexLayout& getLayout() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Bind a vertex buffer for rendering
     ///
@@ -331,13 +517,55 @@ private:
     ////////////////////////////////////////////////////////////
     void draw(RenderTarget& target, RenderStates states) const override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the regions of a multi-buffered vertex buffer
+    ///
+    /// Deletes pending fences and, if the buffer was persistently
+    /// mapped, the buffer itself since its storage is immutable.
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseRegions();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of vertices of any type
+    ///
+    /// \param vertices    Array of vertices to copy to the buffer
+    /// \param vertexSize  Size of a single vertex in bytes
+    /// \param vertexCount Number of vertices to copy
+    /// \param offset      Offset in the buffer to copy to
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool updateData(const void*  vertices,
+                                  std::size_t  vertexSize,
+                                  std::size_t  vertexCount,
+                                  unsigned int offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Map the next region of the buffer for writing vertices of any type
+    ///
+    /// \param vertexSize Size of a single vertex in bytes
+    ///
+    /// \return Pointer to the mapped region, or a null pointer on failure
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] void* mapRegionData(std::size_t vertexSize);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    unsigned int  m_buffer{};                             //!< Internal buffer identifier
-    std::size_t   m_size{};                               //!< Size in Vertices of the currently allocated buffer
-    PrimitiveType m_primitiveType{PrimitiveType::Points}; //!< Type of primitives to draw
-    Usage         m_usage{Usage::Stream};                 //!< How this vertex buffer is to be used
+    unsigned int           m_buffer{};                             //!< Internal buffer identifier
+    std::size_t            m_size{};                               //!< Size in vertices of each region of the buffer
+    PrimitiveType          m_primitiveType{PrimitiveType::Points}; //!< Type of primitives to draw
+    Usage                  m_usage{Usage::Stream};                 //!< How this vertex buffer is to be used
+    VertexLayout           m_layout;                               //!< Layout of the vertices stored in the buffer
+    std::size_t            m_regionCount{1};                       //!< Number of regions the buffer is split into
+    std::size_t            m_currentRegion{};                      //!< Index of the region that is currently drawn
+    void*                  m_persistentMapping{};                  //!< Persistently mapped buffer memory, if supported
+    void*                  m_mappedRegion{};                       //!< Region currently handed out by mapRegion
+    std::vector<void*>     m_fences;                               //!< Fences guarding regions still read by the GPU
+    std::vector<std::byte> m_stagingData;                          //!< Staging memory used without persistent mapping
 };
 
 ////////////////////////////////////////////////////////////
@@ -351,6 +579,8 @@ SFML_GRAPHICS_API void swap(VertexBuffer& left, VertexBuffer& right) noexcept;
 
 } // namespace sf
 
+#include <SFML/Graphics/VertexBuffer.inl>
+
 
 ////////////////////////////////////////////////////////////
 /// \class sf::VertexBuffer
@@ -0,0 +1,192 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Description of how the attributes of a vertex are laid out in memory
+///
+////////////////////////////////////////////////////////////
+struct SFML_GRAPHICS_API VertexLayout
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Types the components of an attribute can be stored as
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class ComponentType
+    {
+        Float,         //!< 32-bit floating point number
+        HalfFloat,     //!< 16-bit floating point number, see `toHalfFloat`
+        Short,         //!< 16-bit signed integer
+        UnsignedShort, //!< 16-bit unsigned integer
+        UnsignedByte   //!< 8-bit unsigned integer
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Format and location of a single vertex attribute
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Attribute
+    {
+        ComponentType type{ComponentType::Float}; //!< Type of each component
+        unsigned int  componentCount{2};          //!< Number of components, from 1 to 4
+        std::size_t   offset{};                   //!< Offset from the start of the vertex in bytes
+        bool          normalized{};               //!< Normalize integer components (shader attributes only)
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Additional attribute sourced by a vertex shader
+    ///
+    ////////////////////////////////////////////////////////////
+    struct ShaderAttribute
+    {
+        std::string name;      //!< Name of the attribute variable in the vertex shader
+        Attribute   attribute; //!< Format and location of the attribute
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether the layout can be used for drawing
+    ///
+    /// The position must be made of 2 to 4 `Float`, `HalfFloat`
+    /// or `Short` components. The texture coordinates must be made
+    /// of 1 to 4 components of the same types. The color must be
+    /// made of 3 or 4 components of any type. Every attribute must
+    /// fit within `stride` bytes and every shader attribute must
+    /// have a name.
+    ///
+    /// \return `true` if the layout is valid
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isValid() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a single component of the given type
+    ///
+    /// \param type Component type
+    ///
+    /// \return Size of a component in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::size_t getComponentSize(ComponentType type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a 32-bit floating point number to a 16-bit one
+    ///
+    /// The value is rounded to the nearest representable value.
+    /// Values too large to be represented become infinity.
+    ///
+    /// \param value Value to convert
+    ///
+    /// \return Bits of the IEEE 754 half-precision representation of \a value
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::uint16_t toHalfFloat(float value);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::size_t                  stride{20};                                                //!< Vertex size in bytes
+    Attribute                    position{ComponentType::Float, 2, 0, false};               //!< Position of the vertex
+    std::optional<Attribute>     color{Attribute{ComponentType::UnsignedByte, 4, 8, true}}; //!< Color of the vertex
+    std::optional<Attribute>     texCoords{Attribute{ComponentType::Float, 2, 12, false}};  //!< Texture coordinates
+    std::vector<ShaderAttribute> shaderAttributes;                                          //!< Extra shader attributes
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::VertexLayout
+/// \ingroup graphics
+///
+/// `sf::VertexLayout` describes the memory layout of custom
+/// vertex types, so that they can be drawn directly with
+/// `sf::RenderTarget` and stored in `sf::VertexBuffer`.
+///
+/// A default constructed layout matches `sf::Vertex`: a
+/// position made of 2 floats, a color made of 4 bytes and
+/// texture coordinates made of 2 floats, 20 bytes in total.
+///
+/// Smaller vertex types reduce the amount of memory that has
+/// to be transferred to the GPU. For instance tiles of a tile
+/// map can use 16-bit integer positions and texture coordinates,
+/// and particles can use half-precision floating point positions.
+/// Since texture coordinates are interpreted according to the
+/// `sf::CoordinateType` of the render states, integer texture
+/// coordinates in pixels are exact for textures of up to 32767
+/// pixels, and half-precision floating point texture coordinates
+/// are best combined with `sf::CoordinateType::Normalized`.
+///
+/// The color attribute is optional. If there is none, vertices
+/// are drawn in white. Without texture coordinates, vertices
+/// can't be textured.
+///
+/// Additional attributes can be passed to vertex shaders. They
+/// are bound by name, attributes that the current shader does
+/// not use are ignored.
+///
+/// Half-precision floating point attributes require support for
+/// the `ARB_half_float_vertex` OpenGL extension.
+///
+/// Usage example:
+/// \code
+/// struct TileVertex
+/// {
+///     std::int16_t  x, y;
+///     std::int16_t  u, v;
+///     std::uint8_t  r, g, b, a;
+///     std::uint16_t variation;
+///     std::uint16_t padding;
+/// };
+///
+/// sf::VertexLayout layout;
+/// layout.stride    = sizeof(TileVertex);
+/// layout.position  = {sf::VertexLayout::ComponentType::Short, 2, offsetof(TileVertex, x)};
+/// layout.texCoords = {sf::VertexLayout::ComponentType::Short, 2, offsetof(TileVertex, u)};
+/// layout.color     = {sf::VertexLayout::ComponentType::UnsignedByte, 4, offsetof(TileVertex, r), true};
+/// layout.shaderAttributes.push_back(
+///     {"variation", {sf::VertexLayout::ComponentType::UnsignedShort, 1, offsetof(TileVertex, variation)}});
+///
+/// std::vector<TileVertex> vertices = ...;
+/// window.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles, layout, states);
+/// \endcode
+///
+/// \see `sf::Vertex`, `sf::VertexBuffer`, `sf::RenderTarget`
+///
+////////////////////////////////////////////////////////////
@@ -31,6 +31,8 @@
 #include <SFML/Network/Dns.hpp>
 #include <SFML/Network/Ftp.hpp>
 #include <SFML/Network/Http.hpp>
+#include <SFML/Network/IoAwaitable.hpp>
+#include <SFML/Network/IoContext.hpp>
 #include <SFML/Network/IpAddress.hpp>
 #include <SFML/Network/Packet.hpp>
 #include <SFML/Network/Sftp.hpp>
@@ -39,6 +41,7 @@
 #include <SFML/Network/SocketSelector.hpp>
 #include <SFML/Network/TcpListener.hpp>
 #include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/TlsSessionCache.hpp>
 #include <SFML/Network/UdpSocket.hpp>
 
 #include <SFML/System.hpp>
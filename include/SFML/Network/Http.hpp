@@ -31,15 +31,20 @@
 
 #include <SFML/Network/IpAddress.hpp>
 #include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/TlsSessionCache.hpp>
 
 #include <SFML/System/Time.hpp>
 
 #include <iosfwd>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
 
+#include <cstddef>
+
 
 namespace sf
 {
@@ -404,24 +409,141 @@ public:
     /// of `Time::Zero` means that the client will use the system default timeout
     /// (which is usually pretty long).
     ///
+    /// The connection to the server is kept alive after the
+    /// response is received if the server allows it, and reused
+    /// by the next requests (see `sendRequests`).
+    ///
     /// \param request      Request to send
     /// \param timeout      Maximum time to wait
     /// \param verifyServer Verify the server if using HTTPS
     ///
     /// \return Server's response
     ///
+    /// \see `sendRequests`
+    ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Response sendRequest(const Request& request, Time timeout = Time::Zero, bool verifyServer = true) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several HTTP requests and return the server's responses
+    ///
+    /// Consecutive GET and HEAD requests are pipelined: they are
+    /// all sent at once on the same connection, and the responses
+    /// are then received in order. This saves a round trip per
+    /// request compared to calling `sendRequest` for each of them.
+    /// If the server closes the connection before answering all
+    /// of them, the remaining ones are sent again on a new
+    /// connection.
+    /// The other requests (such as POST requests) are not
+    /// idempotent: each of them is sent alone, once its preceding
+    /// requests are answered, and it is only sent again if it
+    /// could not be sent at all on an idle connection, which the
+    /// server may have closed in the meantime.
+    /// Requests that couldn't be sent or answered get a response
+    /// with the `Response::Status::ConnectionFailed` status.
+    ///
+    /// \param requests     Requests to send
+    /// \param timeout      Maximum time to wait
+    /// \param verifyServer Verify the server if using HTTPS
+    ///
+    /// \return Server's responses, in the same order as the requests
+    ///
+    /// \see `sendRequest`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<Response> sendRequests(const std::vector<Request>& requests,
+                                                     Time                        timeout      = Time::Zero,
+                                                     bool                        verifyServer = true) const;
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Connection to the host, kept alive between requests
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Connection
+    {
+        TcpSocket socket;         //!< Socket connected to the host
+        bool      verifyServer{}; //!< Was the server verified by the TLS handshake?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add the missing mandatory fields to a request
+    ///
+    /// \param request Request to complete
+    ///
+    /// \return Request ready to be sent to the host
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Request completeRequest(const Request& request) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take an idle connection to the host from the pool
+    ///
+    /// \param verifyServer Does the connection need to have verified the server?
+    ///
+    /// \return Idle connection, or a null pointer if there is none
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::unique_ptr<Connection> takeIdleConnection(bool verifyServer) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open a new connection to the host
+    ///
+    /// The host addresses are tried in order, starting with the
+    /// one at \a hostIndex, which is updated to the index of the
+    /// address that was connected to.
+    ///
+    /// \param timeout      Maximum time to wait for the connection
+    /// \param verifyServer Verify the server if using HTTPS
+    /// \param hostIndex    Index of the first host address to try
+    ///
+    /// \return New connection, or a null pointer if none of the remaining host addresses could be reached
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::unique_ptr<Connection> openConnection(Time         timeout,
+                                                             bool         verifyServer,
+                                                             std::size_t& hostIndex) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give a connection back to the pool once it is idle
+    ///
+    /// \param connection Connection to keep alive
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseConnection(std::unique_ptr<Connection> connection) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive the response to a request
+    ///
+    /// The end of the response is determined by its Content-Length
+    /// field or its chunked encoding, so that the connection can
+    /// be reused afterwards. Otherwise, the response ends when
+    /// the server closes the connection.
+    ///
+    /// \param connection Connection to receive the response from
+    /// \param data       Data received but not processed yet, updated by the function
+    /// \param request    Request that the response answers
+    /// \param response   Response to fill
+    ///
+    /// \return `true` if the connection can be kept alive, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool receiveResponse(Connection&    connection,
+                                              std::string&   data,
+                                              const Request& request,
+                                              Response&      response);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    std::vector<IpAddress>         m_hosts;       //!< Web host addresses
-    std::optional<IpAddress::Type> m_addressType; //!< Address type
-    std::string                    m_hostName;    //!< Web host name
-    unsigned short                 m_port{};      //!< Port used for connection with host
-    bool                           m_https{};     //!< Use HTTPS
+    std::vector<IpAddress>                           m_hosts;           //!< Web host addresses
+    std::optional<IpAddress::Type>                   m_addressType;     //!< Address type
+    std::string                                      m_hostName;        //!< Web host name
+    unsigned short                                   m_port{};          //!< Port used for connection with host
+    bool                                             m_https{};         //!< Use HTTPS
+    mutable TlsSessionCache                          m_tlsSessionCache; //!< TLS sessions resumed by new connections
+    mutable std::mutex                               m_mutex;           //!< Mutex protecting the idle connections
+    mutable std::vector<std::unique_ptr<Connection>> m_idleConnections; //!< Idle keep-alive connections
 };
 
 } // namespace sf
@@ -457,7 +579,14 @@ private:
 ///
 /// `sf::Http` provides a simple function, SendRequest, to send a
 /// `sf::Http::Request` and return the corresponding `sf::Http::Response`
-/// from the server.
+/// from the server. Connections are kept alive and pooled by
+/// the `sf::Http` instance, so that successive requests to the
+/// same host don't pay for a new connection and TLS handshake
+/// each time. Several requests can also be pipelined on the
+/// same connection with `sendRequests`. When a new HTTPS
+/// connection is needed anyway, it resumes the TLS session of
+/// the previous ones (unless the server isn't verified), which
+/// makes its handshake much cheaper.
 ///
 /// Usage example:
 /// \code
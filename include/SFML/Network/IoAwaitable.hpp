@@ -0,0 +1,357 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/IoContext.hpp>
+
+// The awaitables are only available to programs built with C++20 coroutines
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <coroutine>
+#include <functional>
+#include <optional>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Result of an awaited send or receive operation
+///
+////////////////////////////////////////////////////////////
+struct IoTransferResult
+{
+    Socket::Status status{}; //!< Status of the operation
+    std::size_t    size{};   //!< Number of bytes sent or received
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Result of an awaited UDP receive operation
+///
+////////////////////////////////////////////////////////////
+struct IoReceiveFromResult
+{
+    Socket::Status           status{};      //!< Status of the operation
+    std::size_t              size{};        //!< Number of bytes received
+    std::optional<IpAddress> remoteAddress; //!< Address of the sender
+    unsigned short           remotePort{};  //!< Port of the sender
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Operation of an `sf::IoContext` that a coroutine
+///        can wait for with `co_await`
+///
+////////////////////////////////////////////////////////////
+template <typename Result>
+class [[nodiscard]] IoAwaitable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Function resuming the coroutine with the result of the operation
+    ///
+    ////////////////////////////////////////////////////////////
+    using Resume = std::function<void(Result result)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Function starting the operation
+    ///
+    ////////////////////////////////////////////////////////////
+    using Start = std::function<void(Resume resume)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the awaitable from the function starting the operation
+    ///
+    /// The operation is started when the awaitable is awaited.
+    ///
+    /// \param start Function starting the operation
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit IoAwaitable(Start start);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the result is available without suspending
+    ///
+    /// \return Always `false`, the operation completes in `IoContext::run` or `IoContext::poll`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool await_ready() const noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start the operation, the coroutine is resumed once it completes
+    ///
+    /// \param handle Handle of the suspended coroutine
+    ///
+    ////////////////////////////////////////////////////////////
+    void await_suspend(std::coroutine_handle<> handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the result of the operation
+    ///
+    /// \return Result of the completed operation
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Result await_resume();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Start                 m_start;  //!< Function starting the operation
+    std::optional<Result> m_result; //!< Result of the operation, set once it completes
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Receive raw data from a TCP socket in a coroutine
+///
+/// \param context Context performing the operation
+/// \param socket  Connected socket to receive from
+/// \param data    Pointer to the array to fill with the received bytes
+/// \param size    Maximum number of bytes that can be received
+/// \param timeout Timeout of the operation, none by default
+///
+/// \return Awaitable operation
+///
+/// \see `IoContext::asyncReceive`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] IoAwaitable<IoTransferResult> asyncReceive(
+    IoContext&                                 context,
+    TcpSocket&                                 socket,
+    void*                                      data,
+    std::size_t                                size,
+    const std::optional<TimeoutWithPredicate>& timeout = std::nullopt);
+
+////////////////////////////////////////////////////////////
+/// \brief Send raw data over a TCP socket in a coroutine
+///
+/// \param context Context performing the operation
+/// \param socket  Connected socket to send over
+/// \param data    Pointer to the sequence of bytes to send
+/// \param size    Number of bytes to send
+/// \param timeout Timeout of the operation, none by default
+///
+/// \return Awaitable operation
+///
+/// \see `IoContext::asyncSend`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] IoAwaitable<IoTransferResult> asyncSend(
+    IoContext&                                 context,
+    TcpSocket&                                 socket,
+    const void*                                data,
+    std::size_t                                size,
+    const std::optional<TimeoutWithPredicate>& timeout = std::nullopt);
+
+////////////////////////////////////////////////////////////
+/// \brief Receive a packet from a TCP socket in a coroutine
+///
+/// \param context Context performing the operation
+/// \param socket  Connected socket to receive from
+/// \param packet  Packet to fill with the received data
+/// \param timeout Timeout of the operation, none by default
+///
+/// \return Awaitable operation
+///
+/// \see `IoContext::asyncReceive`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] IoAwaitable<Socket::Status> asyncReceive(
+    IoContext&                                 context,
+    TcpSocket&                                 socket,
+    Packet&                                    packet,
+    const std::optional<TimeoutWithPredicate>& timeout = std::nullopt);
+
+////////////////////////////////////////////////////////////
+/// \brief Send a packet over a TCP socket in a coroutine
+///
+/// The packet must stay alive until the operation is awaited.
+///
+/// \param context Context performing the operation
+/// \param socket  Connected socket to send over
+/// \param packet  Packet to send
+/// \param timeout Timeout of the operation, none by default
+///
+/// \return Awaitable operation
+///
+/// \see `IoContext::asyncSend`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] IoAwaitable<Socket::Status> asyncSend(IoContext&                                 context,
+                                                    TcpSocket&                                 socket,
+                                                    Packet&                                    packet,
+                                                    const std::optional<TimeoutWithPredicate>& timeout = std::nullopt);
+
+////////////////////////////////////////////////////////////
+/// \brief Receive a datagram from a UDP socket in a coroutine
+///
+/// \param context Context performing the operation
+/// \param socket  Bound socket to receive from
+/// \param data    Pointer to the array to fill with the received bytes
+/// \param size    Maximum number of bytes that can be received
+/// \param timeout Timeout of the operation, none by default
+///
+/// \return Awaitable operation
+///
+/// \see `IoContext::asyncReceive`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] IoAwaitable<IoReceiveFromResult> asyncReceive(
+    IoContext&                                 context,
+    UdpSocket&                                 socket,
+    void*                                      data,
+    std::size_t                                size,
+    const std::optional<TimeoutWithPredicate>& timeout = std::nullopt);
+
+////////////////////////////////////////////////////////////
+/// \brief Send a datagram over a UDP socket in a coroutine
+///
+/// \param context       Context performing the operation
+/// \param socket        Socket to send over
+/// \param data          Pointer to the sequence of bytes to send
+/// \param size          Number of bytes to send
+/// \param remoteAddress Address of the receiver
+/// \param remotePort    Port of the receiver to send the data to
+/// \param timeout       Timeout of the operation, none by default
+///
+/// \return Awaitable operation
+///
+/// \see `IoContext::asyncSend`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] IoAwaitable<IoTransferResult> asyncSend(
+    IoContext&                                 context,
+    UdpSocket&                                 socket,
+    const void*                                data,
+    std::size_t                                size,
+    IpAddress                                  remoteAddress,
+    unsigned short                             remotePort,
+    const std::optional<TimeoutWithPredicate>& timeout = std::nullopt);
+
+////////////////////////////////////////////////////////////
+/// \brief Accept a new connection in a coroutine
+///
+/// \param context  Context performing the operation
+/// \param listener Listening socket
+/// \param socket   Socket that will hold the new connection
+/// \param timeout  Timeout of the operation, none by default
+///
+/// \return Awaitable operation
+///
+/// \see `IoContext::asyncAccept`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] IoAwaitable<Socket::Status> asyncAccept(
+    IoContext&                                 context,
+    TcpListener&                               listener,
+    TcpSocket&                                 socket,
+    const std::optional<TimeoutWithPredicate>& timeout = std::nullopt);
+
+////////////////////////////////////////////////////////////
+/// \brief Connect a TCP socket to a remote peer in a coroutine
+///
+/// \param context       Context performing the operation
+/// \param socket        Socket to connect
+/// \param remoteAddress Address of the remote peer
+/// \param remotePort    Port of the remote peer
+/// \param timeout       Timeout of the operation, none by default
+///
+/// \return Awaitable operation
+///
+/// \see `IoContext::asyncConnect`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] IoAwaitable<Socket::Status> asyncConnect(
+    IoContext&                                 context,
+    TcpSocket&                                 socket,
+    IpAddress                                  remoteAddress,
+    unsigned short                             remotePort,
+    const std::optional<TimeoutWithPredicate>& timeout = std::nullopt);
+
+} // namespace sf
+
+#include <SFML/Network/IoAwaitable.inl>
+
+#endif
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::IoAwaitable
+/// \ingroup network
+///
+/// The free functions `sf::asyncReceive`, `sf::asyncSend`,
+/// `sf::asyncAccept` and `sf::asyncConnect` declared in this
+/// header wrap the operations of `sf::IoContext` in awaitables,
+/// so that a coroutine can wait for them with `co_await`
+/// instead of passing a callback. They are only available
+/// when the program is built with C++20 coroutines; SFML itself
+/// doesn't need to be built as C++20.
+///
+/// The operation is started when the awaitable is awaited, and
+/// the coroutine is resumed by `IoContext::run` or
+/// `IoContext::poll` once the operation completes, in the
+/// thread that runs the context. Timeouts and packet framing
+/// behave exactly like with the callback operations. If the
+/// context is destroyed while the operation is pending, the
+/// coroutine is never resumed.
+///
+/// SFML doesn't provide a coroutine type: any task type that
+/// can `co_await` arbitrary awaitables works.
+///
+/// Usage example:
+/// \code
+/// // Echo the packets of a client until it disconnects
+/// Task serve(sf::IoContext& context, sf::TcpSocket& client)
+/// {
+///     sf::Packet packet;
+///     while (co_await sf::asyncReceive(context, client, packet, sf::seconds(30)) == sf::Socket::Status::Done)
+///     {
+///         if (co_await sf::asyncSend(context, client, packet) != sf::Socket::Status::Done)
+///             break;
+///     }
+/// }
+///
+/// // Accept clients forever, each one served by its own coroutine
+/// Task listen(sf::IoContext& context, sf::TcpListener& listener)
+/// {
+///     while (true)
+///     {
+///         auto client = std::make_unique<sf::TcpSocket>();
+///         if (co_await sf::asyncAccept(context, listener, *client) == sf::Socket::Status::Done)
+///             startServing(context, std::move(client));
+///     }
+/// }
+///
+/// // A single thread runs every coroutine
+/// while (running)
+///     context.run();
+/// \endcode
+///
+/// \see `sf::IoContext`
+///
+////////////////////////////////////////////////////////////
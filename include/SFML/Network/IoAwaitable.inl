@@ -0,0 +1,212 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/IoAwaitable.hpp> // NOLINT(misc-header-include-cycle)
+
+#include <utility>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+template <typename Result>
+IoAwaitable<Result>::IoAwaitable(Start start) : m_start(std::move(start))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename Result>
+bool IoAwaitable<Result>::await_ready() const noexcept
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename Result>
+void IoAwaitable<Result>::await_suspend(std::coroutine_handle<> handle)
+{
+    // The callbacks of the context are only called by run() and poll(),
+    // so the coroutine is always suspended by the time it is resumed
+    m_start(
+        [this, handle](Result result)
+        {
+            m_result = std::move(result);
+            handle.resume();
+        });
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename Result>
+Result IoAwaitable<Result>::await_resume()
+{
+    return std::move(*m_result);
+}
+
+
+////////////////////////////////////////////////////////////
+inline IoAwaitable<IoTransferResult> asyncReceive(IoContext&                                 context,
+                                                  TcpSocket&                                 socket,
+                                                  void*                                      data,
+                                                  std::size_t                                size,
+                                                  const std::optional<TimeoutWithPredicate>& timeout)
+{
+    return IoAwaitable<IoTransferResult>(
+        [&context, &socket, data, size, timeout](const IoAwaitable<IoTransferResult>::Resume& resume)
+        {
+            context.asyncReceive(
+                socket,
+                data,
+                size,
+                [resume](Socket::Status status, std::size_t received) { resume({status, received}); },
+                timeout);
+        });
+}
+
+
+////////////////////////////////////////////////////////////
+inline IoAwaitable<IoTransferResult> asyncSend(IoContext&                                 context,
+                                               TcpSocket&                                 socket,
+                                               const void*                                data,
+                                               std::size_t                                size,
+                                               const std::optional<TimeoutWithPredicate>& timeout)
+{
+    return IoAwaitable<IoTransferResult>(
+        [&context, &socket, data, size, timeout](const IoAwaitable<IoTransferResult>::Resume& resume)
+        {
+            context.asyncSend(
+                socket,
+                data,
+                size,
+                [resume](Socket::Status status, std::size_t sent) { resume({status, sent}); },
+                timeout);
+        });
+}
+
+
+////////////////////////////////////////////////////////////
+inline IoAwaitable<Socket::Status> asyncReceive(IoContext&                                 context,
+                                                TcpSocket&                                 socket,
+                                                Packet&                                    packet,
+                                                const std::optional<TimeoutWithPredicate>& timeout)
+{
+    return IoAwaitable<Socket::Status>(
+        [&context, &socket, &packet, timeout](const IoAwaitable<Socket::Status>::Resume& resume)
+        { context.asyncReceive(socket, packet, resume, timeout); });
+}
+
+
+////////////////////////////////////////////////////////////
+inline IoAwaitable<Socket::Status> asyncSend(IoContext&                                 context,
+                                             TcpSocket&                                 socket,
+                                             Packet&                                    packet,
+                                             const std::optional<TimeoutWithPredicate>& timeout)
+{
+    return IoAwaitable<Socket::Status>(
+        [&context, &socket, &packet, timeout](const IoAwaitable<Socket::Status>::Resume& resume)
+        { context.asyncSend(socket, packet, resume, timeout); });
+}
+
+
+////////////////////////////////////////////////////////////
+inline IoAwaitable<IoReceiveFromResult> asyncReceive(IoContext&                                 context,
+                                                     UdpSocket&                                 socket,
+                                                     void*                                      data,
+                                                     std::size_t                                size,
+                                                     const std::optional<TimeoutWithPredicate>& timeout)
+{
+    return IoAwaitable<IoReceiveFromResult>(
+        [&context, &socket, data, size, timeout](const IoAwaitable<IoReceiveFromResult>::Resume& resume)
+        {
+            context.asyncReceive(
+                socket,
+                data,
+                size,
+                [resume](Socket::Status           status,
+                         std::size_t              received,
+                         std::optional<IpAddress> remoteAddress,
+                         unsigned short           remotePort)
+                { resume({status, received, remoteAddress, remotePort}); },
+                timeout);
+        });
+}
+
+
+////////////////////////////////////////////////////////////
+inline IoAwaitable<IoTransferResult> asyncSend(IoContext&                                 context,
+                                               UdpSocket&                                 socket,
+                                               const void*                                data,
+                                               std::size_t                                size,
+                                               IpAddress                                  remoteAddress,
+                                               unsigned short                             remotePort,
+                                               const std::optional<TimeoutWithPredicate>& timeout)
+{
+    return IoAwaitable<IoTransferResult>(
+        [&context, &socket, data, size, remoteAddress, remotePort, timeout](
+            const IoAwaitable<IoTransferResult>::Resume& resume)
+        {
+            context.asyncSend(
+                socket,
+                data,
+                size,
+                remoteAddress,
+                remotePort,
+                [resume](Socket::Status status, std::size_t sent) { resume({status, sent}); },
+                timeout);
+        });
+}
+
+
+////////////////////////////////////////////////////////////
+inline IoAwaitable<Socket::Status> asyncAccept(IoContext&                                 context,
+                                               TcpListener&                               listener,
+                                               TcpSocket&                                 socket,
+                                               const std::optional<TimeoutWithPredicate>& timeout)
+{
+    return IoAwaitable<Socket::Status>(
+        [&context, &listener, &socket, timeout](const IoAwaitable<Socket::Status>::Resume& resume)
+        { context.asyncAccept(listener, socket, resume, timeout); });
+}
+
+
+////////////////////////////////////////////////////////////
+inline IoAwaitable<Socket::Status> asyncConnect(IoContext&                                 context,
+                                                TcpSocket&                                 socket,
+                                                IpAddress                                  remoteAddress,
+                                                unsigned short                             remotePort,
+                                                const std::optional<TimeoutWithPredicate>& timeout)
+{
+    return IoAwaitable<Socket::Status>(
+        [&context, &socket, remoteAddress, remotePort, timeout](const IoAwaitable<Socket::Status>::Resume& resume)
+        { context.asyncConnect(socket, remoteAddress, remotePort, resume, timeout); });
+}
+
+} // namespace sf
@@ -0,0 +1,489 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/Socket.hpp>
+
+#include <SFML/System/Time.hpp>
+#include <SFML/System/TimeoutWithPredicate.hpp>
+
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class Packet;
+class TcpListener;
+class TcpSocket;
+class UdpSocket;
+
+////////////////////////////////////////////////////////////
+/// \brief Asynchronous socket operations completed by
+///        an event loop
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API IoContext
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Mechanism used to perform the operations
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Backend
+    {
+        Automatic,  //!< Use the completion backend if the system supports it, the readiness backend otherwise
+        Completion, //!< Operations are submitted to and completed by the system (io_uring on Linux)
+        Readiness   //!< Operations are performed once a `sf::SocketSelector` reports their socket as ready
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Callback called when a send or receive operation completes
+    ///
+    /// The second argument is the number of bytes transferred.
+    ///
+    ////////////////////////////////////////////////////////////
+    using TransferCallback = std::function<void(Socket::Status status, std::size_t size)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Callback called when a UDP receive operation completes
+    ///
+    /// The arguments following the status are the number of bytes
+    /// received, and the address and port of the sender.
+    ///
+    ////////////////////////////////////////////////////////////
+    using ReceiveFromCallback = std::function<void(Socket::Status           status,
+                                                   std::size_t              size,
+                                                   std::optional<IpAddress> remoteAddress,
+                                                   unsigned short           remotePort)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Callback called when an accept or connect operation completes
+    ///
+    ////////////////////////////////////////////////////////////
+    using StatusCallback = std::function<void(Socket::Status status)>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the context
+    ///
+    /// If \a backend is `Backend::Completion` but the system
+    /// doesn't support it, the readiness backend is used instead.
+    ///
+    /// \param backend Backend to use
+    ///
+    /// \see `getBackend`
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit IoContext(Backend backend = Backend::Automatic);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// The pending operations are abandoned: their callbacks
+    /// are not called. The destructor waits until the system
+    /// has cancelled them, so that their sockets and buffers
+    /// are not accessed anymore once it returns.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~IoContext();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    IoContext(const IoContext&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    IoContext& operator=(const IoContext&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    IoContext(IoContext&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    IoContext& operator=(IoContext&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the backend actually used by the context
+    ///
+    /// \return `Backend::Completion` or `Backend::Readiness`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Backend getBackend() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start receiving raw data from a TCP socket
+    ///
+    /// The operation completes as soon as some data is received,
+    /// which may be less than \a size bytes. The buffer must stay
+    /// valid until the callback is called.
+    ///
+    /// \param socket   Connected socket to receive from
+    /// \param data     Pointer to the array to fill with the received bytes
+    /// \param size     Maximum number of bytes that can be received
+    /// \param callback Function called when the operation completes
+    /// \param timeout  Timeout of the operation, none by default
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncReceive(TcpSocket&                                 socket,
+                      void*                                      data,
+                      std::size_t                                size,
+                      TransferCallback                           callback,
+                      const std::optional<TimeoutWithPredicate>& timeout = std::nullopt);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start sending raw data over a TCP socket
+    ///
+    /// The operation completes once all the bytes have been sent,
+    /// or when an error occurs. The buffer must stay valid until
+    /// the callback is called.
+    ///
+    /// \param socket   Connected socket to send over
+    /// \param data     Pointer to the sequence of bytes to send
+    /// \param size     Number of bytes to send
+    /// \param callback Function called when the operation completes
+    /// \param timeout  Timeout of the operation, none by default
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncSend(TcpSocket&                                 socket,
+                   const void*                                data,
+                   std::size_t                                size,
+                   TransferCallback                           callback,
+                   const std::optional<TimeoutWithPredicate>& timeout = std::nullopt);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start receiving a packet from a TCP socket
+    ///
+    /// The operation completes once the whole packet has been
+    /// received, or when an error occurs. The packet must stay
+    /// alive until the callback is called; it is cleared when
+    /// the operation starts.
+    ///
+    /// The packets are framed like the ones sent and received
+    /// by `TcpSocket::send(Packet&)` and `TcpSocket::receive(Packet&)`,
+    /// the peer can use either. If a previous operation timed out
+    /// in the middle of a packet, this one resumes from the bytes
+    /// that were already received.
+    ///
+    /// \param socket   Connected socket to receive from
+    /// \param packet   Packet to fill with the received data
+    /// \param callback Function called when the operation completes
+    /// \param timeout  Timeout of the operation, none by default
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncReceive(TcpSocket&                                 socket,
+                      Packet&                                    packet,
+                      StatusCallback                             callback,
+                      const std::optional<TimeoutWithPredicate>& timeout = std::nullopt);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start sending a packet over a TCP socket
+    ///
+    /// The data of the packet is copied when the operation
+    /// starts: the packet can be modified or destroyed right
+    /// after this call.
+    ///
+    /// \param socket   Connected socket to send over
+    /// \param packet   Packet to send
+    /// \param callback Function called when the operation completes
+    /// \param timeout  Timeout of the operation, none by default
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncSend(TcpSocket&                                 socket,
+                   Packet&                                    packet,
+                   StatusCallback                             callback,
+                   const std::optional<TimeoutWithPredicate>& timeout = std::nullopt);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start receiving a datagram from a UDP socket
+    ///
+    /// The socket must be bound to a port. If the datagram is
+    /// larger than \a size, the remaining bytes are discarded.
+    /// The buffer must stay valid until the callback is called.
+    ///
+    /// \param socket   Bound socket to receive from
+    /// \param data     Pointer to the array to fill with the received bytes
+    /// \param size     Maximum number of bytes that can be received
+    /// \param callback Function called when the operation completes
+    /// \param timeout  Timeout of the operation, none by default
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncReceive(UdpSocket&                                 socket,
+                      void*                                      data,
+                      std::size_t                                size,
+                      ReceiveFromCallback                        callback,
+                      const std::optional<TimeoutWithPredicate>& timeout = std::nullopt);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start sending a datagram over a UDP socket
+    ///
+    /// \a size must not be greater than `UdpSocket::MaxDatagramSize`,
+    /// otherwise the operation fails. The buffer must stay valid
+    /// until the callback is called.
+    ///
+    /// \param socket        Socket to send over
+    /// \param data          Pointer to the sequence of bytes to send
+    /// \param size          Number of bytes to send
+    /// \param remoteAddress Address of the receiver
+    /// \param remotePort    Port of the receiver to send the data to
+    /// \param callback      Function called when the operation completes
+    /// \param timeout       Timeout of the operation, none by default
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncSend(UdpSocket&                                 socket,
+                   const void*                                data,
+                   std::size_t                                size,
+                   IpAddress                                  remoteAddress,
+                   unsigned short                             remotePort,
+                   TransferCallback                           callback,
+                   const std::optional<TimeoutWithPredicate>& timeout = std::nullopt);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start accepting a new connection
+    ///
+    /// When the operation succeeds, \a socket is connected to
+    /// the new client. It must stay alive until the callback
+    /// is called.
+    ///
+    /// \param listener Listening socket
+    /// \param socket   Socket that will hold the new connection
+    /// \param callback Function called when the operation completes
+    /// \param timeout  Timeout of the operation, none by default
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncAccept(TcpListener&                               listener,
+                     TcpSocket&                                 socket,
+                     StatusCallback                             callback,
+                     const std::optional<TimeoutWithPredicate>& timeout = std::nullopt);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start connecting a TCP socket to a remote peer
+    ///
+    /// If the socket is already connected, the connection is
+    /// closed first.
+    ///
+    /// \param socket        Socket to connect
+    /// \param remoteAddress Address of the remote peer
+    /// \param remotePort    Port of the remote peer
+    /// \param callback      Function called when the operation completes
+    /// \param timeout       Timeout of the operation, none by default
+    ///
+    ////////////////////////////////////////////////////////////
+    void asyncConnect(TcpSocket&                                 socket,
+                      IpAddress                                  remoteAddress,
+                      unsigned short                             remotePort,
+                      StatusCallback                             callback,
+                      const std::optional<TimeoutWithPredicate>& timeout = std::nullopt);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait for operations to complete and call their callbacks
+    ///
+    /// This function returns as soon as at least one operation
+    /// has completed, or when \a timeout is reached. If there is
+    /// no pending operation, it returns immediately.
+    ///
+    /// The callbacks are only ever called from `run` and `poll`,
+    /// in the thread that calls them. They can start new
+    /// operations, but must not call `run` or `poll`.
+    ///
+    /// \param timeout Maximum time to wait, (use `Time::Zero` for infinity)
+    ///
+    /// \return Number of operations that completed
+    ///
+    /// \see `poll`
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t run(Time timeout = Time::Zero);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Call the callbacks of the completed operations without waiting
+    ///
+    /// \return Number of operations that completed
+    ///
+    /// \see `run`
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t poll();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of operations that are not completed yet
+    ///
+    /// \return Number of pending operations
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPendingCount() const;
+
+private:
+    struct IoContextImpl;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unique_ptr<IoContextImpl> m_impl; //!< Opaque pointer to the implementation (which requires OS-specific types)
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::IoContext
+/// \ingroup network
+///
+/// `sf::SocketSelector` is readiness-based: the program waits
+/// until a socket is ready, then calls `receive` or `send`
+/// on it, which costs at least two system calls per message.
+/// `sf::IoContext` is completion-based instead: operations are
+/// started with `asyncReceive`, `asyncSend`, `asyncAccept` or
+/// `asyncConnect`, and a callback is called once they are
+/// complete. Programs built with C++20 coroutines can also
+/// `co_await` the operations, see `sf::IoAwaitable`.
+///
+/// On Linux, the operations are submitted to the kernel through
+/// an io_uring instance: starting any number of operations and
+/// waiting for their completion costs a single system call.
+/// On other systems, or when io_uring is not available, the
+/// context falls back to a `sf::SocketSelector` and performs
+/// the operations once their socket is ready. The behavior is
+/// the same with both backends.
+///
+/// Sockets given to an `sf::IoContext` are switched to
+/// non-blocking mode, and must stay alive as long as they
+/// have pending operations. At most one receive and one send
+/// operation should be pending on a given socket at any time,
+/// otherwise the order in which they complete is unspecified.
+/// Operations on a TCP socket work on its raw byte stream:
+/// TLS sockets and the packet buffer of `sf::TcpSocket` are
+/// not supported.
+///
+/// Every operation accepts an optional timeout. When it is
+/// given as a `sf::Time`, the operation is abandoned after
+/// that duration. When it is given as a predicate, the
+/// predicate is checked at the period of the
+/// `sf::TimeoutWithPredicate` and the operation is abandoned
+/// as soon as it returns `false`. Abandoned operations complete
+/// with `Socket::Status::NotReady`, or `Socket::Status::Partial`
+/// if some data was already sent. When a packet receive
+/// operation is abandoned in the middle of a packet, the bytes
+/// received so far are kept in the socket: the next packet
+/// receive operation, or `sf::TcpSocket::receive(Packet&)`,
+/// resumes from them. A TCP connection whose packet send
+/// operation was abandoned in the middle of a packet can't be
+/// used to exchange packets anymore.
+///
+/// An `sf::IoContext` is not thread-safe, but contexts don't
+/// share any state: a server can scale over several cores by
+/// running one context per thread. Each thread then owns a
+/// `sf::TcpListener` with port reuse enabled (see
+/// `sf::TcpListener::setPortReuse`), all listening on the same
+/// port, so that the system distributes the incoming
+/// connections between the threads. Every connection stays
+/// handled by the thread that accepted it, which avoids any
+/// locking and keeps its data in the caches of a single core.
+///
+/// Usage example:
+/// \code
+/// sf::IoContext context;
+/// sf::TcpListener listener;
+/// sf::TcpSocket client;
+/// std::array<std::byte, 1024> buffer;
+///
+/// if (listener.listen(55001) != sf::Socket::Status::Done)
+/// {
+///     // error...
+/// }
+///
+/// std::function<void(sf::Socket::Status, std::size_t)> onReceived;
+/// onReceived = [&](sf::Socket::Status status, std::size_t size)
+/// {
+///     if (status != sf::Socket::Status::Done)
+///         return;
+///
+///     // Echo the data back to the client, then wait for more
+///     context.asyncSend(client, buffer.data(), size, [&](sf::Socket::Status, std::size_t)
+///     { context.asyncReceive(client, buffer.data(), buffer.size(), onReceived); });
+/// };
+///
+/// context.asyncAccept(listener, client, [&](sf::Socket::Status status)
+/// {
+///     if (status == sf::Socket::Status::Done)
+///         context.asyncReceive(client, buffer.data(), buffer.size(), onReceived);
+/// });
+///
+/// while (context.getPendingCount() > 0)
+///     context.run();
+/// \endcode
+///
+/// Receiving a packet with a timeout:
+/// \code
+/// sf::Packet packet;
+/// context.asyncReceive(client, packet, [&](sf::Socket::Status status)
+/// {
+///     if (status == sf::Socket::Status::NotReady)
+///         std::cout << "Nothing was received for 5 seconds" << std::endl;
+/// }, sf::seconds(5));
+/// \endcode
+///
+/// Sharding a server over several threads:
+/// \code
+/// std::vector<std::thread> threads;
+/// for (unsigned int i = 0; i < std::thread::hardware_concurrency(); ++i)
+/// {
+///     threads.emplace_back([]
+///     {
+///         sf::IoContext context;
+///         sf::TcpListener listener;
+///         listener.setPortReuse(true);
+///         if (listener.listen(55001) != sf::Socket::Status::Done)
+///             return;
+///
+///         // Accept and serve connections with this thread's context only
+///         ...
+///
+///         while (running)
+///             context.run(sf::milliseconds(100));
+///     });
+/// }
+/// \endcode
+///
+/// \see `sf::IoAwaitable`, `sf::SocketSelector`, `sf::TcpSocket`, `sf::UdpSocket`, `sf::TcpListener`
+///
+////////////////////////////////////////////////////////////
@@ -98,6 +98,41 @@ public:
     ////////////////////////////////////////////////////////////
     void append(const void* data, std::size_t sizeInBytes);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Append zero-initialized space to the end of the packet
+    ///
+    /// The returned bytes can be written to directly instead
+    /// of building the data in a separate buffer and appending
+    /// it.
+    ///
+    /// Warning: the returned pointer becomes invalid after
+    /// you append data to the packet, therefore it should never
+    /// be stored.
+    ///
+    /// \param sizeInBytes Number of bytes to append
+    ///
+    /// \return Pointer to the first appended byte
+    ///
+    /// \see `append`, `reserve`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::byte* allocate(std::size_t sizeInBytes);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve storage for the data of the packet
+    ///
+    /// Appending data to the packet doesn't reallocate its
+    /// storage until its size exceeds \a sizeInBytes. This
+    /// avoids repeated reallocations when the size of the data
+    /// to write is known in advance.
+    ///
+    /// \param sizeInBytes Total number of bytes to reserve storage for
+    ///
+    /// \see `append`, `allocate`
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t sizeInBytes);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the current reading position in the packet
     ///
@@ -360,7 +395,302 @@ public:
     ////////////////////////////////////////////////////////////
     Packet& operator<<(const String& data);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read an array of values from the packet
+    ///
+    /// This is equivalent to extracting each value of the array
+    /// with `operator>>`, but the whole array is checked and
+    /// converted from network byte order at once. No length is
+    /// read: \a count must match the number of values written.
+    ///
+    /// \param data  Array to fill with the values
+    /// \param count Number of values to read
+    ///
+    /// \return Reference to the packet, to test its validity
+    ///
+    /// \see `writeArray`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(std::int8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(std::uint8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(std::int16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(std::uint16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(std::int32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(std::uint32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(std::int64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(std::uint64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(float* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& readArray(double* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an array of values into the packet
+    ///
+    /// This is equivalent to inserting each value of the array
+    /// with `operator<<`, but the whole array is converted to
+    /// network byte order and appended at once. The length of
+    /// the array is not written.
+    ///
+    /// \param data  Array of values to write
+    /// \param count Number of values to write
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `readArray`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const std::int8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const std::uint8_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const std::int16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const std::uint16_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const std::int32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const std::uint32_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const std::int64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const std::uint64_t* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const float* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \overload
+    ////////////////////////////////////////////////////////////
+    Packet& writeArray(const double* data, std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read an unsigned integer encoded as a variable-length integer
+    ///
+    /// \param data Variable to fill with the value
+    ///
+    /// \return Reference to the packet, to test its validity
+    ///
+    /// \see `writeVarUint`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readVarUint(std::uint64_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read a signed integer encoded as a variable-length integer
+    ///
+    /// \param data Variable to fill with the value
+    ///
+    /// \return Reference to the packet, to test its validity
+    ///
+    /// \see `writeVarInt`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readVarInt(std::int64_t& data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an unsigned integer as a variable-length integer
+    ///
+    /// The value is written 7 bits at a time (LEB128 encoding):
+    /// values below 128 take a single byte, values below 16384
+    /// take 2 bytes, and so on up to 10 bytes. This is well suited
+    /// to lengths and identifiers, which are usually small.
+    ///
+    /// \param data Value to write
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `readVarUint`, `writeVarInt`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeVarUint(std::uint64_t data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a signed integer as a variable-length integer
+    ///
+    /// The value is zig-zag encoded before being written like
+    /// `writeVarUint` does, so that values close to zero take
+    /// few bytes whatever their sign.
+    ///
+    /// \param data Value to write
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `readVarInt`, `writeVarUint`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeVarInt(std::int64_t data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read bits from the packet
+    ///
+    /// \param data     Variable to fill with the bits
+    /// \param bitCount Number of bits to read, between 1 and 32
+    ///
+    /// \return Reference to the packet, to test its validity
+    ///
+    /// \see `writeBits`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readBits(std::uint32_t& data, unsigned int bitCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write bits into the packet
+    ///
+    /// Consecutive calls to `writeBits` (and `writeQuantized`)
+    /// pack their bits together, from the least significant bit
+    /// of each byte to the most significant one, so that for
+    /// example 8 booleans only take a single byte.
+    ///
+    /// Any other write starts at the next byte boundary: the
+    /// unused bits of the last byte are left to zero. Reads
+    /// must follow the same sequence.
+    ///
+    /// \param data     Value whose lowest bits are written
+    /// \param bitCount Number of bits to write, between 1 and 32
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `readBits`, `writeQuantized`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeBits(std::uint32_t data, unsigned int bitCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read a floating point number quantized with `writeQuantized`
+    ///
+    /// \a min, \a max and \a bitCount must be the same values
+    /// as the ones used to write the number.
+    ///
+    /// \param data     Variable to fill with the value
+    /// \param min      Lowest value of the range
+    /// \param max      Highest value of the range
+    /// \param bitCount Number of bits of the quantized value, between 1 and 32
+    ///
+    /// \return Reference to the packet, to test its validity
+    ///
+    /// \see `writeQuantized`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& readQuantized(float& data, float min, float max, unsigned int bitCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write a floating point number quantized to a number of bits
+    ///
+    /// The value is clamped to the range [\a min, \a max], which
+    /// is divided into 2^\a bitCount - 1 steps; the index of the
+    /// nearest step is written with `writeBits`. The precision
+    /// of the value read back is therefore (max - min) / (2^bitCount - 1).
+    ///
+    /// \param data     Value to write
+    /// \param min      Lowest value of the range
+    /// \param max      Highest value of the range
+    /// \param bitCount Number of bits of the quantized value, between 1 and 32
+    ///
+    /// \return Reference to the packet
+    ///
+    /// \see `readQuantized`, `writeBits`
+    ///
+    ////////////////////////////////////////////////////////////
+    Packet& writeQuantized(float data, float min, float max, unsigned int bitCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace the data of the packet by its difference with a baseline
+    ///
+    /// Only the bytes that differ from \a baseline are kept,
+    /// along with the length of the runs of unchanged bytes.
+    /// When consecutive packets have the same layout, such as
+    /// snapshots of a game state, this is usually much smaller
+    /// than the packet itself.
+    ///
+    /// The receiver must have the same baseline, and call
+    /// `applyDelta` to restore the original data.
+    ///
+    /// The reading position of the packet is reset.
+    ///
+    /// \param baseline Packet to compute the difference with
+    ///
+    /// \see `applyDelta`
+    ///
+    ////////////////////////////////////////////////////////////
+    void makeDelta(const Packet& baseline);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Restore the data of a packet encoded with `makeDelta`
+    ///
+    /// If the data of the packet is not a valid difference, the
+    /// packet is left unchanged and `false` is returned.
+    ///
+    /// The reading position of the packet is reset.
+    ///
+    /// \param baseline Packet that the difference was computed with
+    ///
+    /// \return `true` if the data was restored successfully
+    ///
+    /// \see `makeDelta`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool applyDelta(const Packet& baseline);
+
 protected:
+    friend class IoContext;
     friend class TcpSocket;
     friend class UdpSocket;
 
@@ -416,12 +746,36 @@ private:
     ////////////////////////////////////////////////////////////
     bool checkSize(std::size_t size);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Read an array of values of a given size
+    ///
+    /// \param data        Array to fill with the values
+    /// \param count       Number of values to read
+    /// \param elementSize Size of a value, in bytes
+    /// \param swap        Whether values are stored in network byte order
+    ///
+    ////////////////////////////////////////////////////////////
+    void readElements(void* data, std::size_t count, std::size_t elementSize, bool swap);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write an array of values of a given size
+    ///
+    /// \param data        Array of values to write
+    /// \param count       Number of values to write
+    /// \param elementSize Size of a value, in bytes
+    /// \param swap        Whether values are stored in network byte order
+    ///
+    ////////////////////////////////////////////////////////////
+    void writeElements(const void* data, std::size_t count, std::size_t elementSize, bool swap);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     std::vector<std::byte> m_data;          //!< Data stored in the packet
     std::size_t            m_readPos{};     //!< Current reading position in the packet
     std::size_t            m_sendPos{};     //!< Current send position in the packet (for handling partial sends)
+    unsigned int           m_writeBitPos{}; //!< Number of bits written in the last byte by `writeBits`, 0 if none
+    unsigned int           m_readBitPos{};  //!< Number of bits read in the previous byte by `readBits`, 0 if none
     bool                   m_isValid{true}; //!< Reading state of the packet
 };
 
@@ -486,6 +840,32 @@ private:
 /// \li floating point numbers (`float`, `double`)
 /// \li string types (`char*`, `wchar_t*`, `std::string`, `std::wstring`, `sf::String`)
 ///
+/// Arrays of integers and floating point numbers are best written
+/// and read with `writeArray` and `readArray`, which convert the
+/// whole array at once instead of one value at a time:
+/// \code
+/// std::vector<float> positions = ...;
+///
+/// packet.reserve(packet.getDataSize() + sizeof(std::uint32_t) + positions.size() * sizeof(float));
+/// packet << static_cast<std::uint32_t>(positions.size());
+/// packet.writeArray(positions.data(), positions.size());
+/// \endcode
+///
+/// When bandwidth matters, packets also provide compact encodings:
+/// variable-length integers (`writeVarUint`, `writeVarInt`),
+/// bit-packed values (`writeBits`, `writeQuantized`) and delta
+/// encoding against a previous packet (`makeDelta`, `applyDelta`).
+/// They are opt-in and don't change how the stream operators
+/// encode data, and since they only change the contents of the
+/// packet, they can be combined with a custom `onSend` and
+/// `onReceive` (to compress the packet, for example).
+/// \code
+/// // An identifier, 3 flags and a heading precise to 0.1 degree in as little as 3 bytes
+/// packet.writeVarUint(entityId);
+/// packet.writeBits(isJumping, 1).writeBits(isCrouching, 1).writeBits(isFiring, 1);
+/// packet.writeQuantized(heading, 0.f, 360.f, 12);
+/// \endcode
+///
 /// Like standard streams, it is also possible to define your own
 /// overloads of operators >> and << in order to handle your
 /// custom types.
@@ -184,6 +184,7 @@ protected:
     void close();
 
 private:
+    friend class IoContext;
     friend class SocketSelector;
 
     ////////////////////////////////////////////////////////////
@@ -112,6 +112,38 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status accept(TcpSocket& socket);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Allow other listeners to listen on the same port
+    ///
+    /// When enabled on several listeners (of this process or of
+    /// other processes run by the same user) that listen on the
+    /// same port and address, the system distributes the incoming
+    /// connections between them. Combined with one thread per
+    /// listener, this spreads the cost of accepting connections
+    /// over several cores, see the `sf::IoContext` documentation.
+    ///
+    /// Port reuse is only supported on Linux (`SO_REUSEPORT`) and
+    /// FreeBSD (`SO_REUSEPORT_LB`), other systems don't balance
+    /// the connections between the listeners.
+    ///
+    /// The setting is applied by the next call to `listen`.
+    /// Port reuse is disabled by default.
+    ///
+    /// \param enabled `true` to enable port reuse, `false` to disable it
+    ///
+    /// \return `true` if port reuse is supported, or if \a enabled is `false`
+    ///
+    /// \see `listen`
+    ///
+    ////////////////////////////////////////////////////////////
+    bool setPortReuse(bool enabled);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    bool m_portReuse{}; //!< Share the port with other listeners?
 };
 
 
@@ -161,6 +193,16 @@ public:
 /// }
 /// \endcode
 ///
+/// To spread the incoming connections over several threads,
+/// each thread can own its own listener with port reuse
+/// enabled:
+/// \code
+/// // In each thread
+/// sf::TcpListener listener;
+/// listener.setPortReuse(true);
+/// listener.listen(55001);
+/// \endcode
+///
 /// \see `sf::TcpSocket`, `sf::Socket`
 ///
 ////////////////////////////////////////////////////////////
@@ -49,6 +49,7 @@ namespace sf
 class TcpListener;
 class IpAddress;
 class Packet;
+class TlsSessionCache;
 
 ////////////////////////////////////////////////////////////
 /// \brief Specialized socket using the TCP protocol
@@ -497,6 +498,31 @@ public:
                              std::string_view privateKeyData,
                              std::string_view privateKeyPasswordData = {});
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the cache used to resume TLS sessions
+    ///
+    /// As a client, the socket offers the session stored in the
+    /// cache for the host name given to `setupTlsClient` and the
+    /// port it is connected to, and stores the new session once
+    /// it is established. Sessions are only stored and offered
+    /// when the server's certificate is verified.
+    ///
+    /// As a server, the socket issues session tickets protected
+    /// by the keys of the cache, and accepts the valid tickets
+    /// presented by clients. Either way, a resumed session skips
+    /// most of the cost of the handshake.
+    ///
+    /// The cache is used by the next calls to `setupTlsClient`
+    /// and `setupTlsServer`, and must stay alive as long as the
+    /// socket uses it. By default, no cache is used.
+    ///
+    /// \param cache Cache to use, or a null pointer to not use any
+    ///
+    /// \see `setupTlsClient`, `setupTlsServer`, `isTlsSessionResumed`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTlsSessionCache(TlsSessionCache* cache);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the name of the TLS ciphersuite currently in use
     ///
@@ -507,6 +533,20 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::optional<std::string> getCurrentCiphersuiteName() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the TLS handshake resumed a previous session
+    ///
+    /// A client resumes a session when the server accepts the
+    /// session stored in its cache, a server when the client
+    /// presents a valid session ticket.
+    ///
+    /// \return `true` if the session was resumed, `false` if a full handshake was performed or if TLS is not set up
+    ///
+    /// \see `setTlsSessionCache`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isTlsSessionResumed() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Send raw data to the remote peer
     ///
@@ -577,6 +617,33 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status send(Packet& packet);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several formatted packets of data to the remote peer
+    ///
+    /// The packets are sent in order, as if `send(Packet&)` was
+    /// called for each of them, but they are handed to the system
+    /// together: sending many small packets this way requires a
+    /// lot fewer system calls. A packet cannot appear several
+    /// times in the array, since each packet records its own
+    /// progress; send it again in another call instead.
+    ///
+    /// In non-blocking mode, if this function returns `sf::Socket::Status::Partial`,
+    /// you \em must retry sending the same unmodified packets before sending
+    /// anything else in order to guarantee the packets arrive at the remote
+    /// peer uncorrupted. Each packet keeps track of how much of it was
+    /// already sent.
+    /// This function will fail if the socket is not connected.
+    ///
+    /// \param packets Array of pointers to the packets to send
+    /// \param count   Number of packets in the array
+    ///
+    /// \return Status code
+    ///
+    /// \see `receive`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status send(Packet* const* packets, std::size_t count);
+
     ////////////////////////////////////////////////////////////
     /// \brief Receive a formatted packet of data from the remote peer
     ///
@@ -588,12 +655,53 @@ public:
     ///
     /// \return Status code
     ///
-    /// \see `send`
+    /// \see `send`, `setPacketBufferSize`
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status receive(Packet& packet);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the buffer used to receive packets
+    ///
+    /// By default, `receive(Packet&)` reads the size of each
+    /// packet and then its data, which costs at least two system
+    /// calls per packet. When a buffer size is set, the socket
+    /// instead receives as many bytes as the buffer can hold in
+    /// a single call, and extracts the following packets from
+    /// the buffer without any further system call. This greatly
+    /// reduces the cost of receiving many small packets.
+    ///
+    /// Packets larger than the buffer are still received, they
+    /// simply bypass it.
+    ///
+    /// Bytes that were received ahead of the extracted packets
+    /// are kept by the socket, and are still returned by the
+    /// next calls to `receive`. As a consequence, a
+    /// `sf::SocketSelector` may report that the socket is not
+    /// ready while packets are waiting in the buffer: when using
+    /// a selector, call `receive` until it returns
+    /// `Status::NotReady` (in non-blocking mode) before waiting
+    /// again.
+    ///
+    /// \param size Size of the buffer in bytes, or 0 to disable buffering
+    ///
+    /// \see `getPacketBufferSize`, `receive`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPacketBufferSize(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the buffer used to receive packets
+    ///
+    /// \return Size of the buffer in bytes, 0 if packets are not buffered
+    ///
+    /// \see `setPacketBufferSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPacketBufferSize() const;
+
 private:
+    friend class IoContext;
     friend class TcpListener;
 
     ////////////////////////////////////////////////////////////
@@ -613,7 +721,7 @@ private:
     struct Impl;
     std::unique_ptr<Impl>  m_impl;              //!< Implementation details
     PendingPacket          m_pendingPacket;     //!< Temporary data of the packet currently being received
-    std::vector<std::byte> m_blockToSendBuffer; //!< Buffer used to prepare data being sent from the socket
+    std::vector<std::byte> m_blockToSendBuffer; //!< Buffer used to coalesce packets being sent over TLS
 };
 
 } // namespace sf
@@ -0,0 +1,208 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <array>
+#include <memory>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Storage for TLS sessions, allowing connections to
+///        be resumed without a full handshake
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API TlsSessionCache
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the cache
+    ///
+    /// \a ticketLifetime is only used by servers: it is the
+    /// duration during which the session tickets they issue can
+    /// be used to resume a session, and the period at which the
+    /// keys protecting the tickets are renewed. It is limited to
+    /// 7 days.
+    ///
+    /// \param ticketLifetime Lifetime of the session tickets issued by servers
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TlsSessionCache(Time ticketLifetime = seconds(86400));
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TlsSessionCache();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TlsSessionCache(const TlsSessionCache&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TlsSessionCache& operator=(const TlsSessionCache&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TlsSessionCache(TlsSessionCache&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TlsSessionCache& operator=(TlsSessionCache&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the key protecting the session tickets issued by servers
+    ///
+    /// By default, servers protect their session tickets with a
+    /// random key: only the servers sharing the same cache can
+    /// resume the sessions. Servers running in different processes
+    /// or on different machines can resume each other's sessions
+    /// if they are given the same key.
+    ///
+    /// The key is used to issue new tickets for the lifetime
+    /// given to the constructor, after which a random key is
+    /// generated again: this function must be called before the
+    /// end of the lifetime to keep the servers synchronized.
+    /// Tickets issued with the previous key stay valid.
+    ///
+    /// The key must be generated from a cryptographically secure
+    /// source of randomness, and kept secret.
+    ///
+    /// \param keyId Identifier of the key, sent in clear in the tickets
+    /// \param key   Secret key
+    ///
+    /// \return `true` if the key was set, `false` on error or if not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setTicketKey(std::uint32_t keyId, const std::array<std::byte, 32>& key);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget all the sessions stored by clients
+    ///
+    /// The next connection to each server will perform a full
+    /// handshake.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of sessions stored by clients
+    ///
+    /// \return Number of servers whose session can be resumed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSize() const;
+
+private:
+    friend class TcpSocket;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TlsSessionCache
+/// \ingroup network
+///
+/// A full TLS handshake requires an additional round trip
+/// and expensive asymmetric cryptography. When a client
+/// reconnects to a server it was connected to recently, both
+/// can instead resume the previous session: the handshake is
+/// shorter and much cheaper.
+///
+/// `sf::TlsSessionCache` stores what both ends need to resume
+/// sessions. It is given to `sf::TcpSocket::setTlsSessionCache`
+/// before setting up TLS:
+/// \li On the client side, it stores the last session
+///     established with each host name and port, and offers
+///     it to the server when connecting to the same host name
+///     and port again. Only the sessions of connections that
+///     verified the server's certificate are stored: resuming
+///     a session skips this verification.
+/// \li On the server side, it holds the keys used to issue and
+///     verify session tickets. A client presenting a valid
+///     ticket resumes its session.
+///
+/// When the server refuses to resume a session, for example
+/// because the ticket expired, a full handshake is performed
+/// instead: using a cache never prevents connections.
+///
+/// A cache can be shared by any number of sockets, including
+/// sockets used by different threads. It must stay alive as
+/// long as sockets use it.
+///
+/// `sf::Http` uses its own cache: successive HTTPS requests
+/// sent to the same host resume the same session, as long as
+/// the server is verified.
+///
+/// Usage example:
+/// \code
+/// sf::TlsSessionCache cache;
+///
+/// for (int i = 0; i < 10; ++i)
+/// {
+///     sf::TcpSocket socket;
+///     socket.setTlsSessionCache(&cache);
+///
+///     if (socket.connect(address, 443) != sf::Socket::Status::Done)
+///         return;
+///
+///     // Only the first handshake is a full one, the next ones resume the session
+///     if (socket.setupTlsClient("www.example.com") != sf::TcpSocket::TlsStatus::HandshakeComplete)
+///         return;
+///
+///     ...
+/// }
+/// \endcode
+///
+/// \see `sf::TcpSocket`, `sf::Http`
+///
+////////////////////////////////////////////////////////////
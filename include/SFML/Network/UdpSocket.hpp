@@ -55,6 +55,19 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static constexpr std::size_t MaxDatagramSize{65507}; //!< The maximum number of bytes that can be sent in a single UDP datagram
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Datagram sent or received by `sendBatch` and `receiveBatch`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Datagram
+    {
+        void*                    data{};        //!< Bytes of the datagram (not modified when sending)
+        std::size_t              size{};        //!< Number of bytes to send, or maximum number of bytes to receive
+        std::size_t              received{};    //!< Number of bytes received
+        std::optional<IpAddress> remoteAddress; //!< Address of the receiver when sending, of the sender when receiving
+        unsigned short           remotePort{};  //!< Port of the receiver when sending, of the sender when receiving
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -194,11 +207,90 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Status receive(Packet& packet, std::optional<IpAddress>& remoteAddress, unsigned short& remotePort);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send several datagrams to remote peers
+    ///
+    /// This is equivalent to calling `send` for each datagram,
+    /// but it uses as few system calls as possible, which
+    /// makes a big difference when sending many datagrams.
+    ///
+    /// The datagrams are sent in order. If a datagram can't be
+    /// sent (for example because the socket is non-blocking and
+    /// the system can't take more data), the function stops and
+    /// returns the corresponding status: \a sent tells how many
+    /// datagrams were sent before, the remaining ones should be
+    /// sent again later.
+    ///
+    /// Make sure that the size of each datagram is not greater
+    /// than `UdpSocket::MaxDatagramSize`, otherwise this function
+    /// will fail and no datagram will be sent.
+    ///
+    /// \param datagrams Array of datagrams to send
+    /// \param count     Number of datagrams in the array
+    /// \param sent      This variable is filled with the number of datagrams sent
+    ///
+    /// \return Status code
+    ///
+    /// \see `receiveBatch`, `setSegmentationOffload`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status sendBatch(const Datagram* datagrams, std::size_t count, std::size_t& sent);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive several datagrams from remote peers
+    ///
+    /// In blocking mode, this function waits until a datagram
+    /// is received. It then receives the datagrams that are
+    /// already available, up to \a count, without waiting for
+    /// more: \a received tells how many were received.
+    ///
+    /// The `received`, `remoteAddress` and `remotePort` members
+    /// of the received datagrams are filled. As with `receive`,
+    /// the buffer of each datagram must be large enough for the
+    /// data that you intend to receive.
+    ///
+    /// \param datagrams Array of datagrams to fill
+    /// \param count     Number of datagrams in the array
+    /// \param received  This variable is filled with the number of datagrams received
+    ///
+    /// \return Status code
+    ///
+    /// \see `sendBatch`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status receiveBatch(Datagram* datagrams, std::size_t count, std::size_t& received);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable segmentation offload for `sendBatch`
+    ///
+    /// When enabled, consecutive datagrams of the same size sent
+    /// to the same peer by `sendBatch` are handed to the system
+    /// as a single buffer, which is split into datagrams by the
+    /// network stack or the network card. This makes sending
+    /// bursts of datagrams much cheaper.
+    ///
+    /// Segmentation offload is only supported on Linux (4.18 and
+    /// later). Datagrams that don't fit in the maximum
+    /// transmission unit of the network can't be segmented: only
+    /// enable it when sending datagrams smaller than that.
+    ///
+    /// Segmentation offload is disabled by default.
+    ///
+    /// \param enabled `true` to enable segmentation offload, `false` to disable it
+    ///
+    /// \return `true` if segmentation offload is supported, or if \a enabled is `false`
+    ///
+    /// \see `sendBatch`
+    ///
+    ////////////////////////////////////////////////////////////
+    bool setSegmentationOffload(bool enabled);
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     std::vector<std::byte> m_buffer{MaxDatagramSize}; //!< Temporary buffer holding the received data in Receive(Packet)
+    bool                   m_segmentationOffload{};   //!< Use segmentation offload in sendBatch?
 };
 
 } // namespace sf
@@ -288,6 +380,23 @@ private:
 /// socket.send(message.c_str(), message.size() + 1, sender, port);
 /// \endcode
 ///
+/// Servers that exchange many datagrams with many peers can
+/// send and receive them in batches with `sendBatch` and
+/// `receiveBatch`, to reduce the number of system calls:
+/// \code
+/// std::vector<std::array<std::byte, 1500>> buffers(64);
+/// std::vector<sf::UdpSocket::Datagram>     datagrams(buffers.size());
+/// for (std::size_t i = 0; i < buffers.size(); ++i)
+///     datagrams[i] = {buffers[i].data(), buffers[i].size()};
+///
+/// std::size_t received = 0;
+/// if (socket.receiveBatch(datagrams.data(), datagrams.size(), received) == sf::Socket::Status::Done)
+/// {
+///     for (std::size_t i = 0; i < received; ++i)
+///         handle(datagrams[i].data, datagrams[i].received, *datagrams[i].remoteAddress, datagrams[i].remotePort);
+/// }
+/// \endcode
+///
 /// \see `sf::Socket`, `sf::TcpSocket`, `sf::Packet`
 ///
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+
+#include <SFML/System/Export.hpp>
+
+#include <optional>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Abstract class for custom file output streams
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API OutputStream
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Virtual destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual ~OutputStream() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write data to the stream
+    ///
+    /// After writing, the stream's writing position must be
+    /// advanced by the amount of bytes written.
+    ///
+    /// \param data Buffer containing the data to write
+    /// \param size Number of bytes to write
+    ///
+    /// \return The number of bytes actually written, or `std::nullopt` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual std::optional<std::size_t> write(const void* data, std::size_t size) = 0;
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::OutputStream
+/// \ingroup system
+///
+/// This class allows users to define their own file output
+/// destinations to which SFML can save resources.
+///
+/// It is the counterpart of `sf::InputStream`: resource classes
+/// like `sf::Image` provide a `saveToStream` function, which
+/// writes the encoded data to the stream instead of returning
+/// it in a buffer (see the documentation of each function for
+/// how much of it is buffered in memory). If your data goes
+/// to a different destination (over a network, into an archive,
+/// through a compressor, etc), derive your own class from
+/// `sf::OutputStream`.
+///
+/// Usage example:
+/// \code
+/// // custom stream class that writes to a socket
+/// class SocketStream : public sf::OutputStream
+/// {
+/// public:
+///
+///     SocketStream(sf::TcpSocket& socket) : m_socket(socket)
+///     {
+///     }
+///
+///     [[nodiscard]] std::optional<std::size_t> write(const void* data, std::size_t size) override
+///     {
+///         if (m_socket.send(data, size) != sf::Socket::Status::Done)
+///             return std::nullopt;
+///
+///         return size;
+///     }
+///
+/// private:
+///
+///     sf::TcpSocket& m_socket;
+/// };
+///
+/// // now you can send images...
+/// SocketStream stream(socket);
+///
+/// if (!image.saveToStream(stream, "png"))
+/// {
+///     // Handle error...
+/// }
+/// \endcode
+///
+/// \see `InputStream`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,462 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/FrameCapture.hpp>
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <cassert>
+#include <cstring>
+
+
+namespace
+{
+// A "FrameCaptureImpl" namespace is required to avoid ambiguity in unity builds
+namespace FrameCaptureImpl
+{
+// Pixels of a frame waiting for a worker thread, bottom row first as read by OpenGL,
+// or no pixels at all if the frame couldn't be read back
+struct Job
+{
+    std::uint64_t             index{};
+    sf::Vector2u              size;
+    std::vector<std::uint8_t> pixels;
+};
+
+// Pixel buffer object receiving the pixels of a frame
+struct Slot
+{
+    unsigned int  buffer{};
+    sf::Vector2u  size;
+    void*         fence{};
+    std::uint64_t index{};
+};
+
+// Number of bytes of a frame of the given size
+[[nodiscard]] std::size_t getByteCount(sf::Vector2u size)
+{
+    return std::size_t{size.x} * std::size_t{size.y} * 4;
+}
+} // namespace FrameCaptureImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct FrameCapture::Impl
+{
+    Impl(Callback theCallback, std::size_t queueDepth, unsigned int threadCount) :
+        callback(std::move(theCallback)),
+        maxJobs(queueDepth),
+        slots(queueDepth),
+        asynchronous(isAsynchronousAvailable())
+    {
+        for (unsigned int i = 0; i < threadCount; ++i)
+            workers.emplace_back([this] { work(); });
+    }
+
+    ~Impl()
+    {
+        {
+            const TransientContextLock contextLock;
+
+            readBackAll();
+
+            for (const FrameCaptureImpl::Slot& slot : slots)
+            {
+                if (slot.buffer)
+                    glCheck(GLEXT_glDeleteBuffers(1, &slot.buffer));
+            }
+        }
+
+        {
+            const std::lock_guard lock(mutex);
+            stopping = true;
+        }
+
+        jobAvailable.notify_all();
+
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    // Body of the worker threads
+    void work()
+    {
+        while (true)
+        {
+            FrameCaptureImpl::Job job;
+
+            {
+                std::unique_lock lock(mutex);
+                jobAvailable.wait(lock, [this] { return stopping || !jobs.empty(); });
+
+                // Pending jobs are always processed before stopping
+                if (jobs.empty())
+                    return;
+
+                job = std::move(jobs.front());
+                jobs.pop_front();
+                ++busyWorkers;
+            }
+
+            jobDone.notify_all();
+
+            // Frames that couldn't be read back are delivered as empty images, so that no index is skipped
+            Image frame;
+            if (!job.pixels.empty())
+            {
+                frame = Image(job.size, job.pixels.data());
+                frame.flipVertically();
+            }
+
+            callback(job.index, frame);
+
+            {
+                const std::lock_guard lock(mutex);
+                --busyWorkers;
+            }
+
+            jobDone.notify_all();
+        }
+    }
+
+    // Hand a frame to the worker threads, waiting for room in the queue if needed
+    void push(FrameCaptureImpl::Job&& job)
+    {
+        {
+            std::unique_lock lock(mutex);
+            jobDone.wait(lock, [this] { return jobs.size() < maxJobs; });
+            jobs.push_back(std::move(job));
+        }
+
+        jobAvailable.notify_one();
+    }
+
+    // Requires an active context
+    void readBack(FrameCaptureImpl::Slot& slot)
+    {
+        auto* const sync = static_cast<GLsync>(slot.fence);
+
+        // Flushing guarantees that the fence eventually gets signaled
+        GLenum result = GLEXT_GL_TIMEOUT_EXPIRED;
+        while (result == GLEXT_GL_TIMEOUT_EXPIRED)
+            result = glCheck(GLEXT_glClientWaitSync(sync, GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000));
+
+        glCheck(GLEXT_glDeleteSync(sync));
+        slot.fence = nullptr;
+
+        if (result == GLEXT_GL_WAIT_FAILED)
+        {
+            err() << "Failed to wait for captured frame " << slot.index << " to be transferred" << std::endl;
+            push(FrameCaptureImpl::Job{slot.index, {}, {}});
+            return;
+        }
+
+        FrameCaptureImpl::Job job{slot.index, slot.size, {}};
+        job.pixels.resize(FrameCaptureImpl::getByteCount(slot.size));
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, slot.buffer));
+
+        const void* const source = glCheck(GLEXT_glMapBufferRange(GLEXT_GL_PIXEL_PACK_BUFFER,
+                                                                  0,
+                                                                  static_cast<GLsizeiptr>(job.pixels.size()),
+                                                                  GLEXT_GL_MAP_READ_BIT));
+
+        if (source)
+        {
+            std::memcpy(job.pixels.data(), source, job.pixels.size());
+            glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER));
+        }
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+        if (!source)
+        {
+            err() << "Failed to map the pixels of captured frame " << slot.index << std::endl;
+            push(FrameCaptureImpl::Job{slot.index, {}, {}});
+            return;
+        }
+
+        push(std::move(job));
+    }
+
+    // Requires an active context
+    void readBackCompleted()
+    {
+        // Slots are visited from the oldest capture to the most recent one,
+        // so that frames are handed to the worker threads in capture order
+        for (std::size_t i = 0; i < slots.size(); ++i)
+        {
+            FrameCaptureImpl::Slot& slot = slots[(nextSlot + i) % slots.size()];
+            if (!slot.fence)
+                continue;
+
+            const GLenum result = glCheck(GLEXT_glClientWaitSync(static_cast<GLsync>(slot.fence), 0, 0));
+            if (result == GLEXT_GL_TIMEOUT_EXPIRED)
+                break;
+
+            readBack(slot);
+        }
+    }
+
+    // Requires an active context
+    void readBackAll()
+    {
+        for (std::size_t i = 0; i < slots.size(); ++i)
+        {
+            FrameCaptureImpl::Slot& slot = slots[(nextSlot + i) % slots.size()];
+            if (slot.fence)
+                readBack(slot);
+        }
+    }
+
+    Callback                            callback;      //!< Function called by the worker threads
+    std::size_t                         maxJobs;       //!< Maximum number of frames waiting for a worker thread
+    std::vector<FrameCaptureImpl::Slot> slots;         //!< Ring of pixel buffer objects
+    std::size_t                         nextSlot{};    //!< Slot receiving the next capture, and holding the oldest one
+    bool                                asynchronous;  //!< Are pixel buffer objects and sync objects used?
+    std::uint64_t                       frameCount{};  //!< Number of frames captured so far
+    std::deque<FrameCaptureImpl::Job>   jobs;          //!< Frames waiting for a worker thread
+    std::size_t                         busyWorkers{}; //!< Number of worker threads currently running the callback
+    bool                                stopping{};    //!< Are the worker threads requested to stop?
+    std::mutex                          mutex;         //!< Mutex protecting the jobs and the worker state
+    std::condition_variable             jobAvailable;  //!< Signaled when a job is pushed or the workers must stop
+    std::condition_variable             jobDone;       //!< Signaled when a job is popped or completed
+    std::vector<std::thread>            workers;       //!< Worker threads
+};
+
+
+////////////////////////////////////////////////////////////
+FrameCapture::FrameCapture(Callback callback, std::size_t queueDepth, unsigned int threadCount)
+{
+    assert(callback && "FrameCapture::FrameCapture() Callback must not be empty");
+    assert(queueDepth > 0 && "FrameCapture::FrameCapture() Queue depth must be greater than 0");
+    assert(threadCount > 0 && "FrameCapture::FrameCapture() Thread count must be greater than 0");
+
+    m_impl = std::make_unique<Impl>(std::move(callback), queueDepth, threadCount);
+}
+
+
+////////////////////////////////////////////////////////////
+FrameCapture::~FrameCapture() = default;
+
+
+////////////////////////////////////////////////////////////
+FrameCapture::FrameCapture(FrameCapture&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+FrameCapture& FrameCapture::operator=(FrameCapture&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+bool FrameCapture::capture(RenderTarget& target)
+{
+    const Vector2u size = target.getSize();
+
+    if (!target.setActive(true))
+    {
+        err() << "Failed to activate the render target to capture" << std::endl;
+        return false;
+    }
+
+    const std::uint64_t index = m_impl->frameCount++;
+
+    if (!m_impl->asynchronous)
+    {
+        // Read the pixels back immediately, only the encoding is asynchronous
+        FrameCaptureImpl::Job job{index, size, {}};
+        job.pixels.resize(FrameCaptureImpl::getByteCount(size));
+
+        glCheck(glPixelStorei(GL_PACK_ALIGNMENT, 4));
+        glCheck(glReadPixels(0,
+                             0,
+                             static_cast<GLsizei>(size.x),
+                             static_cast<GLsizei>(size.y),
+                             GL_RGBA,
+                             GL_UNSIGNED_BYTE,
+                             job.pixels.data()));
+
+        m_impl->push(std::move(job));
+        return true;
+    }
+
+    // Make room for the new capture, by waiting for the oldest one if it's still in flight
+    FrameCaptureImpl::Slot& slot = m_impl->slots[m_impl->nextSlot];
+    if (slot.fence)
+        m_impl->readBack(slot);
+
+    m_impl->nextSlot = (m_impl->nextSlot + 1) % m_impl->slots.size();
+
+    if (!slot.buffer)
+        glCheck(GLEXT_glGenBuffers(1, &slot.buffer));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, slot.buffer));
+
+    if (slot.size != size)
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_PACK_BUFFER,
+                                   static_cast<GLsizeiptr>(FrameCaptureImpl::getByteCount(size)),
+                                   nullptr,
+                                   GLEXT_GL_STREAM_READ));
+        slot.size = size;
+    }
+
+    // Start the transfer to the pixel buffer object, glReadPixels returns immediately in this case
+    glCheck(glPixelStorei(GL_PACK_ALIGNMENT, 4));
+    glCheck(glReadPixels(0,
+                         0,
+                         static_cast<GLsizei>(size.x),
+                         static_cast<GLsizei>(size.y),
+                         GL_RGBA,
+                         GL_UNSIGNED_BYTE,
+                         nullptr));
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+    slot.fence = glCheck(GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    slot.index = index;
+
+    // Hand the previous frames whose transfer is already complete to the worker threads
+    m_impl->readBackCompleted();
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void FrameCapture::flush()
+{
+    {
+        const TransientContextLock contextLock;
+
+        m_impl->readBackAll();
+    }
+
+    std::unique_lock lock(m_impl->mutex);
+    m_impl->jobDone.wait(lock, [this] { return m_impl->jobs.empty() && (m_impl->busyWorkers == 0); });
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t FrameCapture::getFrameCount() const
+{
+    return m_impl->frameCount;
+}
+
+
+////////////////////////////////////////////////////////////
+bool FrameCapture::isAsynchronousAvailable()
+{
+    const TransientContextLock contextLock;
+
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    return GLEXT_pixel_buffer_object && GLEXT_map_buffer_range && GLEXT_sync;
+}
+
+
+////////////////////////////////////////////////////////////
+FrameCapture::Callback FrameCapture::saveToFiles(const std::filesystem::path& directory, std::string_view extension)
+{
+    return [directory, extension = std::string(extension)](std::uint64_t index, const Image& frame)
+    {
+        // The frame couldn't be read back, which was already reported
+        if (frame.getSize() == Vector2u())
+            return;
+
+        std::ostringstream filename;
+        filename << "frame_" << std::setw(6) << std::setfill('0') << index << '.' << extension;
+
+        if (!frame.saveToFile(directory / filename.str()))
+            err() << "Failed to save captured frame " << index << std::endl;
+    };
+}
+
+
+////////////////////////////////////////////////////////////
+FrameCapture::Callback FrameCapture::appendToFile(const std::filesystem::path& filename)
+{
+    struct State
+    {
+        std::mutex                     mutex;
+        std::ofstream                  file;
+        std::uint64_t                  nextIndex{};
+        std::map<std::uint64_t, Image> pendingFrames;
+    };
+
+    auto state = std::make_shared<State>();
+    state->file.open(filename, std::ios::binary);
+
+    if (!state->file)
+        err() << "Failed to open file for writing captured frames\n" << formatDebugPathInfo(filename) << std::endl;
+
+    return [state](std::uint64_t index, const Image& frame)
+    {
+        const std::lock_guard lock(state->mutex);
+
+        // Frames may be completed out of order by several worker threads, keep
+        // the ones that arrive early until all the previous ones were written
+        state->pendingFrames.emplace(index, frame);
+
+        auto it = state->pendingFrames.begin();
+        while ((it != state->pendingFrames.end()) && (it->first == state->nextIndex))
+        {
+            // Frames that couldn't be read back are empty, and are skipped
+            const Image& image = it->second;
+            if (image.getSize() != Vector2u())
+                state->file.write(reinterpret_cast<const char*>(image.getPixelsPtr()),
+                                  static_cast<std::streamsize>(FrameCaptureImpl::getByteCount(image.getSize())));
+
+            it = state->pendingFrames.erase(it);
+            ++state->nextIndex;
+        }
+    };
+}
+
+} // namespace sf
@@ -75,11 +75,15 @@ void extensionSanityCheck()
     check(GLEXT_blend_func_separate_dependencies);
     check(GLEXT_vertex_buffer_object_dependencies);
     check(GLEXT_shader_objects_dependencies);
+    check(GLEXT_vertex_shader_dependencies);
     check(GLEXT_blend_equation_separate_dependencies);
     check(GLEXT_framebuffer_object_dependencies);
     check(GLEXT_framebuffer_blit_dependencies);
     check(GLEXT_framebuffer_multisample_dependencies);
+    check(GLEXT_map_buffer_range_dependencies);
     check(GLEXT_copy_buffer_dependencies);
+    check(GLEXT_sync_dependencies);
+    check(GLEXT_buffer_storage_dependencies);
 #endif
 }
 } // namespace
@@ -168,6 +168,58 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_glCopyBufferSubData \
     glCopyBufferSubData // Placeholder to satisfy the compiler, entry point is not loaded in GLES
 
+// Core since 3.0 - OES_vertex_half_float
+#define GLEXT_half_float_vertex false
+#define GLEXT_GL_HALF_FLOAT     0
+
+// Core since 3.0 - OES_texture_float
+#define GLEXT_texture_float false
+#define GLEXT_GL_RGBA16F    0
+#define GLEXT_GL_RGBA32F    0
+
+// Core since 3.0 - EXT_texture_rg
+#define GLEXT_texture_rg false
+#define GLEXT_GL_RED     0
+#define GLEXT_GL_RG      0
+#define GLEXT_GL_R8      0
+#define GLEXT_GL_RG8     0
+#define GLEXT_GL_R16F    0
+#define GLEXT_GL_R32F    0
+
+// Core since 3.0 - NV_pixel_buffer_object
+#define GLEXT_pixel_buffer_object  false
+#define GLEXT_GL_PIXEL_PACK_BUFFER 0
+#define GLEXT_GL_STREAM_READ       0
+#define GLEXT_glUnmapBuffer \
+    glUnmapBuffer // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - EXT_map_buffer_range
+#define GLEXT_map_buffer_range false
+#define GLEXT_glMapBufferRange \
+    glMapBufferRange // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_GL_MAP_READ_BIT  0
+#define GLEXT_GL_MAP_WRITE_BIT 0
+
+// Core since 3.0 - APPLE_sync
+#define GLEXT_sync false
+#define GLEXT_glFenceSync \
+    glFenceSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDeleteSync \
+    glDeleteSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glClientWaitSync \
+    glClientWaitSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE 0
+#define GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT    0
+#define GLEXT_GL_TIMEOUT_EXPIRED            0
+#define GLEXT_GL_WAIT_FAILED                0
+
+// EXT_buffer_storage
+#define GLEXT_buffer_storage false
+#define GLEXT_glBufferStorage \
+    glBufferStorage // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_GL_MAP_PERSISTENT_BIT 0
+#define GLEXT_GL_MAP_COHERENT_BIT   0
+
 // Core since 3.0 - EXT_sRGB
 #define GLEXT_texture_sRGB    false
 #define GLEXT_GL_SRGB8_ALPHA8 0
@@ -175,6 +227,10 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 // Core since 3.0 - ARB_framebuffer_sRGB
 #define GLEXT_framebuffer_sRGB false
 
+// Core since 3.0 - EXT_unpack_subimage
+#define GLEXT_unpack_subimage      false
+#define GLEXT_GL_UNPACK_ROW_LENGTH 0
+
 // Core since 3.0 - EXT_blend_minmax
 #define GLEXT_blend_minmax SF_GLAD_GL_EXT_blend_minmax
 // glBlendEquation is provided by OES_blend_subtract, see above
@@ -190,8 +246,10 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 // and has to be checked for prior to use
 
 // Core since 1.1
-#define GLEXT_GL_DEPTH_COMPONENT GL_DEPTH_COMPONENT
-#define GLEXT_GL_CLAMP           GL_CLAMP
+#define GLEXT_GL_DEPTH_COMPONENT   GL_DEPTH_COMPONENT
+#define GLEXT_GL_CLAMP             GL_CLAMP
+#define GLEXT_unpack_subimage      true
+#define GLEXT_GL_UNPACK_ROW_LENGTH GL_UNPACK_ROW_LENGTH
 
 // The following extensions are listed chronologically
 // Extension macro first, followed by tokens then
@@ -299,6 +357,14 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_vertex_shader                       SF_GLAD_GL_ARB_vertex_shader
 #define GLEXT_GL_VERTEX_SHADER                    GL_VERTEX_SHADER_ARB
 #define GLEXT_GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS_ARB
+#define GLEXT_glVertexAttribPointer               glVertexAttribPointerARB
+#define GLEXT_glEnableVertexAttribArray           glEnableVertexAttribArrayARB
+#define GLEXT_glDisableVertexAttribArray          glDisableVertexAttribArrayARB
+#define GLEXT_glGetAttribLocation                 glGetAttribLocationARB
+
+#define GLEXT_vertex_shader_dependencies                                                  \
+    SF_GLAD_GL_ARB_vertex_shader, glVertexAttribPointerARB, glEnableVertexAttribArrayARB, \
+        glDisableVertexAttribArrayARB, glGetAttribLocationARB
 
 // Core since 2.0 - ARB_fragment_shader
 #define GLEXT_fragment_shader                     SF_GLAD_GL_ARB_fragment_shader
@@ -317,6 +383,11 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_texture_sRGB                         SF_GLAD_GL_EXT_texture_sRGB
 #define GLEXT_GL_SRGB8_ALPHA8                      GL_SRGB8_ALPHA8_EXT
 
+// Core since 2.1 - ARB_pixel_buffer_object
+#define GLEXT_pixel_buffer_object  SF_GLAD_GL_ARB_pixel_buffer_object
+#define GLEXT_GL_PIXEL_PACK_BUFFER GL_PIXEL_PACK_BUFFER_ARB
+#define GLEXT_GL_STREAM_READ       GL_STREAM_READ_ARB
+
 // Core since 3.0 - ARB_framebuffer_sRGB
 #define GLEXT_framebuffer_sRGB                     SF_GLAD_GL_ARB_framebuffer_sRGB
 
@@ -370,6 +441,32 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_framebuffer_multisample_dependencies \
     SF_GLAD_GL_EXT_framebuffer_multisample, glRenderbufferStorageMultisampleEXT
 
+// Core since 3.0 - ARB_half_float_vertex
+#define GLEXT_half_float_vertex SF_GLAD_GL_ARB_half_float_vertex
+#define GLEXT_GL_HALF_FLOAT     GL_HALF_FLOAT_ARB
+
+// Core since 3.0 - ARB_texture_float
+#define GLEXT_texture_float SF_GLAD_GL_ARB_texture_float
+#define GLEXT_GL_RGBA16F    GL_RGBA16F_ARB
+#define GLEXT_GL_RGBA32F    GL_RGBA32F_ARB
+
+// Core since 3.0 - ARB_texture_rg
+#define GLEXT_texture_rg SF_GLAD_GL_ARB_texture_rg
+#define GLEXT_GL_RED     GL_RED
+#define GLEXT_GL_RG      GL_RG
+#define GLEXT_GL_R8      GL_R8
+#define GLEXT_GL_RG8     GL_RG8
+#define GLEXT_GL_R16F    GL_R16F
+#define GLEXT_GL_R32F    GL_R32F
+
+// Core since 3.0 - ARB_map_buffer_range
+#define GLEXT_map_buffer_range SF_GLAD_GL_ARB_map_buffer_range
+#define GLEXT_GL_MAP_READ_BIT  GL_MAP_READ_BIT
+#define GLEXT_GL_MAP_WRITE_BIT GL_MAP_WRITE_BIT
+#define GLEXT_glMapBufferRange glMapBufferRange
+
+#define GLEXT_map_buffer_range_dependencies SF_GLAD_GL_ARB_map_buffer_range, glMapBufferRange
+
 // Core since 3.1 - ARB_copy_buffer
 #define GLEXT_copy_buffer          SF_GLAD_GL_ARB_copy_buffer
 #define GLEXT_GL_COPY_READ_BUFFER  GL_COPY_READ_BUFFER
@@ -382,6 +479,26 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_geometry_shader4         SF_GLAD_GL_ARB_geometry_shader4
 #define GLEXT_GL_GEOMETRY_SHADER       GL_GEOMETRY_SHADER_ARB
 
+// Core since 3.2 - ARB_sync
+#define GLEXT_sync                          SF_GLAD_GL_ARB_sync
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT    GL_SYNC_FLUSH_COMMANDS_BIT
+#define GLEXT_GL_TIMEOUT_EXPIRED            GL_TIMEOUT_EXPIRED
+#define GLEXT_GL_WAIT_FAILED                GL_WAIT_FAILED
+#define GLEXT_glFenceSync                   glFenceSync
+#define GLEXT_glDeleteSync                  glDeleteSync
+#define GLEXT_glClientWaitSync              glClientWaitSync
+
+#define GLEXT_sync_dependencies SF_GLAD_GL_ARB_sync, glFenceSync, glDeleteSync, glClientWaitSync
+
+// Core since 4.4 - ARB_buffer_storage
+#define GLEXT_buffer_storage        SF_GLAD_GL_ARB_buffer_storage
+#define GLEXT_GL_MAP_PERSISTENT_BIT GL_MAP_PERSISTENT_BIT
+#define GLEXT_GL_MAP_COHERENT_BIT   GL_MAP_COHERENT_BIT
+#define GLEXT_glBufferStorage       glBufferStorage
+
+#define GLEXT_buffer_storage_dependencies SF_GLAD_GL_ARB_buffer_storage, glBufferStorage
+
 #endif
 
 // OpenGL Versions
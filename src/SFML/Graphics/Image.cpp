@@ -26,10 +26,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/ImageView.hpp>
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/InputStream.hpp>
+#include <SFML/System/MappedFile.hpp>
+#include <SFML/System/OutputStream.hpp>
 #include <SFML/System/Utils.hpp>
 #ifdef SFML_SYSTEM_ANDROID
 #include <SFML/System/Android/Activity.hpp>
@@ -51,13 +54,20 @@
 #include <array>
 #include <fstream>
 #include <iomanip>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include <cassert>
+#include <cerrno>
+#include <cstdlib>
 #include <cstring>
 
 
@@ -92,6 +102,24 @@ void bufferFromCallback(void* context, void* data, int size)
     std::copy(source, source + size, std::back_inserter(*dest));
 }
 
+// State of stb_image_write callbacks that operate on a sf::OutputStream
+struct StreamWriter
+{
+    sf::OutputStream& stream;
+    bool              failed{};
+};
+
+// stb_image_write callback that operates on a sf::OutputStream
+void writeToStream(void* context, void* data, int size)
+{
+    auto& writer = *static_cast<StreamWriter*>(context);
+    if (writer.failed)
+        return;
+
+    const std::optional count = writer.stream.write(data, static_cast<std::size_t>(size));
+    writer.failed             = (count != static_cast<std::size_t>(size));
+}
+
 // Deleter for STB pointers
 struct StbDeleter
 {
@@ -113,6 +141,517 @@ struct MallocPointerDeleter
 };
 using MallocPtr = std::unique_ptr<void, MallocPointerDeleter>;
 
+// Append a 32-bit integer in big-endian byte order, as used by PNG
+void appendBigEndian(std::vector<unsigned char>& buffer, std::uint32_t value)
+{
+    buffer.push_back(static_cast<unsigned char>(value >> 24));
+    buffer.push_back(static_cast<unsigned char>(value >> 16));
+    buffer.push_back(static_cast<unsigned char>(value >> 8));
+    buffer.push_back(static_cast<unsigned char>(value));
+}
+
+// Table of the CRC-32 used by PNG chunks, one entry per byte value
+constexpr std::array<std::uint32_t, 256> crcTable = []
+{
+    std::array<std::uint32_t, 256> table{};
+    for (std::uint32_t i = 0; i < table.size(); ++i)
+    {
+        std::uint32_t value = i;
+        for (int bit = 0; bit < 8; ++bit)
+            value = (value & 1) ? (0xEDB88320 ^ (value >> 1)) : (value >> 1);
+        table[i] = value;
+    }
+    return table;
+}();
+
+// Update a CRC-32 with the given data; the CRC starts at 0xFFFFFFFF and is inverted once complete
+std::uint32_t updateCrc32(std::uint32_t crc, const unsigned char* data, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i)
+        crc = crcTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return crc;
+}
+
+// Update an Adler-32 checksum, as used by zlib streams, with the given data
+std::uint32_t updateAdler32(std::uint32_t adler, const unsigned char* data, std::size_t size)
+{
+    constexpr std::uint32_t modulo = 65521;
+
+    // 5552 is the largest number of bytes that can be summed before the sums overflow
+    std::uint32_t sum1 = adler & 0xFFFF;
+    std::uint32_t sum2 = adler >> 16;
+    while (size > 0)
+    {
+        const std::size_t count = std::min<std::size_t>(size, 5552);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sum1 += data[i];
+            sum2 += sum1;
+        }
+        sum1 %= modulo;
+        sum2 %= modulo;
+        data += count;
+        size -= count;
+    }
+    return (sum2 << 16) | sum1;
+}
+
+// Compute the Adler-32 checksum of two consecutive blocks of data from the checksums of each block
+std::uint32_t combineAdler32(std::uint32_t first, std::uint32_t second, std::size_t secondSize)
+{
+    constexpr std::uint32_t modulo = 65521;
+
+    const auto          remainder = static_cast<std::uint32_t>(secondSize % modulo);
+    const std::uint32_t sum1      = ((first & 0xFFFF) + (second & 0xFFFF) + modulo - 1) % modulo;
+    const std::uint32_t sum2      = static_cast<std::uint32_t>(
+        (std::uint64_t{remainder} * (first & 0xFFFF) + (first >> 16) + (second >> 16) + modulo - remainder) % modulo);
+    return (sum2 << 16) | sum1;
+}
+
+// Write a PNG chunk through a stb_image_write callback
+void writePngChunk(stbi_write_func* func, void* context, std::string_view type, unsigned char* data, std::size_t size)
+{
+    std::vector<unsigned char> header;
+    appendBigEndian(header, static_cast<std::uint32_t>(size));
+    header.insert(header.end(), type.begin(), type.end());
+    func(context, header.data(), static_cast<int>(header.size()));
+
+    if (size > 0)
+        func(context, data, static_cast<int>(size));
+
+    // The CRC covers the type and the data of the chunk
+    std::vector<unsigned char> footer;
+    appendBigEndian(footer, ~updateCrc32(updateCrc32(0xFFFFFFFF, header.data() + 4, 4), data, size));
+    func(context, footer.data(), static_cast<int>(footer.size()));
+}
+
+// Apply a PNG filter to a row of RGBA pixels; previous is null for the first row of the image
+void filterPngRow(const std::uint8_t* row, const std::uint8_t* previous, std::size_t stride, int filter, unsigned char* out)
+{
+    constexpr std::size_t bytesPerPixel = 4;
+
+    for (std::size_t i = 0; i < stride; ++i)
+    {
+        const int left   = (i >= bytesPerPixel) ? row[i - bytesPerPixel] : 0;
+        const int up     = previous ? previous[i] : 0;
+        const int upLeft = (previous && (i >= bytesPerPixel)) ? previous[i - bytesPerPixel] : 0;
+
+        int predictor = 0;
+        switch (filter)
+        {
+            case 1:
+                predictor = left;
+                break;
+            case 2:
+                predictor = up;
+                break;
+            case 3:
+                predictor = (left + up) / 2;
+                break;
+            case 4:
+            {
+                // Paeth predictor: the neighbor closest to left + up - upLeft
+                const int estimate  = left + up - upLeft;
+                const int leftDelta = std::abs(estimate - left);
+                const int upDelta   = std::abs(estimate - up);
+                const int diagDelta = std::abs(estimate - upLeft);
+                if ((leftDelta <= upDelta) && (leftDelta <= diagDelta))
+                    predictor = left;
+                else if (upDelta <= diagDelta)
+                    predictor = up;
+                else
+                    predictor = upLeft;
+                break;
+            }
+            default:
+                break;
+        }
+
+        out[i] = static_cast<unsigned char>(row[i] - predictor);
+    }
+}
+
+// Writer of the bits of a deflate stream, least significant bit first
+struct DeflateBitWriter
+{
+    // Append the given number of bits
+    void write(std::uint32_t bits, int count)
+    {
+        buffer |= bits << pending;
+        pending += count;
+        while (pending >= 8)
+        {
+            output.push_back(static_cast<unsigned char>(buffer));
+            buffer >>= 8;
+            pending -= 8;
+        }
+    }
+
+    // Append a Huffman code, which is stored most significant bit first
+    void writeCode(std::uint32_t code, int count)
+    {
+        std::uint32_t reversed = 0;
+        for (int i = 0; i < count; ++i)
+            reversed |= ((code >> i) & 1) << (count - 1 - i);
+        write(reversed, count);
+    }
+
+    // Append a literal/length symbol with the fixed Huffman codes of deflate
+    void writeSymbol(int symbol)
+    {
+        const auto value = static_cast<std::uint32_t>(symbol);
+        if (symbol <= 143)
+            writeCode(0x30 + value, 8);
+        else if (symbol <= 255)
+            writeCode(0x190 + value - 144, 9);
+        else if (symbol <= 279)
+            writeCode(value - 256, 7);
+        else
+            writeCode(0xC0 + value - 280, 8);
+    }
+
+    // Pad the output with zero bits up to the next byte boundary
+    void align()
+    {
+        if (pending > 0)
+            output.push_back(static_cast<unsigned char>(buffer));
+        buffer  = 0;
+        pending = 0;
+    }
+
+    std::vector<unsigned char>& output;    //!< Bytes of the stream
+    std::uint32_t               buffer{};  //!< Bits not written to the output yet
+    int                         pending{}; //!< Number of bits in the buffer
+};
+
+// Compress data to non-final deflate blocks that are self-contained: matches never reach before the
+// start of the data, and the blocks end with an empty stored block (a "sync flush") that aligns the
+// output on a byte boundary, so that the outputs of consecutive calls form a single deflate stream
+void deflateBand(const unsigned char* data, std::size_t size, int level, std::vector<unsigned char>& output)
+{
+    constexpr std::array<std::uint16_t, 30> lengthBases{3,  4,  5,  6,  7,  8,  9,  10,  11,  13,  15,  17,  19,  23,  27,
+                                                        31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258, 259};
+    constexpr std::array<std::uint8_t, 29>  lengthExtraBits{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                                           2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+    constexpr std::array<std::uint16_t, 31> distanceBases{1,    2,    3,    4,    5,    7,     9,     13,    17,    25,   33,
+                                                          49,   65,   97,   129,  193,  257,   385,   513,   769,   1025, 1537,
+                                                          2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577, 32769};
+    constexpr std::array<std::uint8_t, 30>  distanceExtraBits{0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+                                                             6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+    constexpr std::size_t windowSize = 32768;
+    constexpr std::size_t minMatch   = 3;
+    constexpr std::size_t maxMatch   = 258;
+    constexpr std::size_t none       = std::numeric_limits<std::size_t>::max();
+    constexpr int         hashBits   = 15;
+
+    const std::size_t start = output.size();
+
+    if (level > 0)
+    {
+        // Chains of the earlier positions that start with the same 3 bytes, most recent first
+        std::vector<std::size_t> head(std::size_t{1} << hashBits, none);
+        std::vector<std::size_t> previous(windowSize, none);
+
+        const auto hash = [data](std::size_t position)
+        {
+            const std::uint32_t value = data[position] | (std::uint32_t{data[position + 1]} << 8) |
+                                        (std::uint32_t{data[position + 2]} << 16);
+            return (value * 2654435761U) >> (32 - hashBits);
+        };
+
+        const auto insert = [&](std::size_t position)
+        {
+            std::size_t& first               = head[hash(position)];
+            previous[position % windowSize] = first;
+            first                            = position;
+        };
+
+        // The compression level bounds the number of earlier positions tried for each match
+        const int  maxCandidates = level * 4;
+        const auto findMatch     = [&](std::size_t position)
+        {
+            std::pair<std::size_t, std::size_t> best; // length and distance
+            const std::size_t limit = std::min(maxMatch, size - position);
+            if (limit < minMatch)
+                return best;
+
+            std::size_t candidate = head[hash(position)];
+            for (int tries = 0; (tries < maxCandidates) && (candidate != none) && (position - candidate < windowSize); ++tries)
+            {
+                if (data[candidate + best.first] == data[position + best.first])
+                {
+                    std::size_t length = 0;
+                    while ((length < limit) && (data[candidate + length] == data[position + length]))
+                        ++length;
+
+                    if (length > best.first)
+                    {
+                        best = {length, position - candidate};
+                        if (length == limit)
+                            break;
+                    }
+                }
+                candidate = previous[candidate % windowSize];
+            }
+
+            if (best.first < minMatch)
+                best.first = 0;
+            return best;
+        };
+
+        DeflateBitWriter writer{output};
+        writer.write(0, 1); // Not the final block
+        writer.write(1, 2); // Fixed Huffman codes
+
+        std::size_t position = 0;
+        while (position < size)
+        {
+            std::pair<std::size_t, std::size_t> match;
+            if (position + minMatch <= size)
+            {
+                match = findMatch(position);
+                insert(position);
+
+                // Lazy matching: prefer a literal when the next position starts a longer match
+                if ((match.first > 0) && (findMatch(position + 1).first > match.first))
+                    match.first = 0;
+            }
+
+            if (match.first == 0)
+            {
+                writer.writeSymbol(data[position]);
+                ++position;
+                continue;
+            }
+
+            const auto [length, distance] = match;
+
+            std::size_t lengthCode = 0;
+            while (length >= lengthBases[lengthCode + 1])
+                ++lengthCode;
+            writer.writeSymbol(257 + static_cast<int>(lengthCode));
+            writer.write(static_cast<std::uint32_t>(length - lengthBases[lengthCode]), lengthExtraBits[lengthCode]);
+
+            std::size_t distanceCode = 0;
+            while (distance >= distanceBases[distanceCode + 1])
+                ++distanceCode;
+            writer.writeCode(static_cast<std::uint32_t>(distanceCode), 5);
+            writer.write(static_cast<std::uint32_t>(distance - distanceBases[distanceCode]), distanceExtraBits[distanceCode]);
+
+            for (std::size_t i = 1; (i < length) && (position + i + minMatch <= size); ++i)
+                insert(position + i);
+            position += length;
+        }
+
+        writer.writeSymbol(256); // End of block
+
+        // Sync flush
+        writer.write(0, 3);
+        writer.align();
+        output.insert(output.end(), {0x00, 0x00, 0xFF, 0xFF});
+    }
+
+    // Store the data uncompressed when compressing it doesn't pay off
+    constexpr std::size_t maxStoredBlock = 65535;
+    const std::size_t     storedSize     = size + (size + maxStoredBlock - 1) / maxStoredBlock * 5;
+    if ((level > 0) && (output.size() - start <= storedSize))
+        return;
+
+    output.resize(start);
+    for (std::size_t offset = 0; offset < size; offset += maxStoredBlock)
+    {
+        const auto length = static_cast<std::uint16_t>(std::min(maxStoredBlock, size - offset));
+        output.insert(output.end(),
+                      {0x00, // Not the final block, stored
+                       static_cast<unsigned char>(length),
+                       static_cast<unsigned char>(length >> 8),
+                       static_cast<unsigned char>(~length),
+                       static_cast<unsigned char>(~length >> 8)});
+        output.insert(output.end(), data + offset, data + offset + length);
+    }
+}
+
+// Compressed rows of a PNG image
+struct PngBand
+{
+    std::vector<unsigned char> compressed; //!< Deflate blocks of the filtered rows
+    std::uint32_t              adler{};    //!< Adler-32 checksum of the filtered rows
+    std::size_t                size{};     //!< Size of the filtered rows, in bytes
+};
+
+// Filter and compress consecutive rows of a PNG image
+PngBand encodePngBand(const std::uint8_t*               pixels,
+                      std::size_t                       stride,
+                      std::size_t                       firstRow,
+                      std::size_t                       rowCount,
+                      const sf::Image::EncodingOptions& options)
+{
+    // The filter options start with Adaptive, then follow the order of the PNG filter types
+    const int forcedFilter = static_cast<int>(options.pngFilter) - 1;
+
+    // Filter each row, and prefix it with its filter type
+    std::vector<unsigned char> filtered(rowCount * (stride + 1));
+    std::vector<unsigned char> trial(forcedFilter < 0 ? stride : 0);
+    for (std::size_t y = firstRow; y < firstRow + rowCount; ++y)
+    {
+        const std::uint8_t* row      = pixels + y * stride;
+        const std::uint8_t* previous = (y > 0) ? row - stride : nullptr;
+
+        int filter = forcedFilter;
+        if (filter < 0)
+        {
+            // Keep the filter that minimizes the sum of the absolute differences
+            std::size_t bestEstimate = std::numeric_limits<std::size_t>::max();
+            for (int candidate = 0; candidate < 5; ++candidate)
+            {
+                filterPngRow(row, previous, stride, candidate, trial.data());
+
+                std::size_t estimate = 0;
+                for (const unsigned char value : trial)
+                    estimate += static_cast<std::size_t>(std::abs(static_cast<signed char>(value)));
+
+                if (estimate < bestEstimate)
+                {
+                    bestEstimate = estimate;
+                    filter       = candidate;
+                }
+            }
+        }
+
+        unsigned char* out = &filtered[(y - firstRow) * (stride + 1)];
+        out[0]             = static_cast<unsigned char>(filter);
+        filterPngRow(row, previous, stride, filter, out + 1);
+    }
+
+    PngBand band;
+    band.adler = updateAdler32(1, filtered.data(), filtered.size());
+    band.size  = filtered.size();
+    deflateBand(filtered.data(), filtered.size(), options.compressionLevel, band.compressed);
+    return band;
+}
+
+// Writer of the zlib stream of a PNG image, in IDAT chunks of bounded size
+struct PngDataWriter
+{
+    // Append data to the stream, writing the chunks that are complete
+    void write(const unsigned char* data, std::size_t size)
+    {
+        constexpr std::size_t maxChunkSize = 64 * 1024;
+
+        while (size > 0)
+        {
+            const std::size_t count = std::min(size, maxChunkSize - chunk.size());
+            chunk.insert(chunk.end(), data, data + count);
+            data += count;
+            size -= count;
+
+            if (chunk.size() == maxChunkSize)
+                flush();
+        }
+    }
+
+    // Write the data that is not part of a chunk yet
+    void flush()
+    {
+        if (!chunk.empty())
+            writePngChunk(func, context, "IDAT", chunk.data(), chunk.size());
+        chunk.clear();
+    }
+
+    stbi_write_func*           func;    //!< Callback receiving the encoded data
+    void*                      context; //!< Context of the callback
+    std::vector<unsigned char> chunk;   //!< Data of the chunk being filled
+};
+
+// Encode an image to PNG with the given options
+// This replaces stbi_write_png_to_func, which reads its settings from global variables that can't be
+// changed safely while other threads encode images, and compresses the whole image on a single thread
+// before writing anything. Here the rows are split in bands that are filtered and compressed in parallel,
+// and the compressed data is written as soon as the bands that precede it are complete.
+void writePng(stbi_write_func*                  func,
+              void*                             context,
+              sf::Vector2i                      size,
+              const std::uint8_t*               pixels,
+              const sf::Image::EncodingOptions& options)
+{
+    const std::size_t stride = static_cast<std::size_t>(size.x) * 4;
+    const auto        height = static_cast<std::size_t>(size.y);
+
+    std::array<unsigned char, 8> signature{137, 80, 78, 71, 13, 10, 26, 10};
+    func(context, signature.data(), static_cast<int>(signature.size()));
+
+    // 8-bit RGBA pixels, without interlacing
+    std::vector<unsigned char> header;
+    appendBigEndian(header, static_cast<std::uint32_t>(size.x));
+    appendBigEndian(header, static_cast<std::uint32_t>(size.y));
+    header.insert(header.end(), {8, 6, 0, 0, 0});
+    writePngChunk(func, context, "IHDR", header.data(), header.size());
+
+    // Bands of about 256 KiB of filtered data: big enough for the compression not to suffer much
+    // from matches being limited to their own band, small enough to spread most images over threads
+    constexpr std::size_t bandSize    = 256 * 1024;
+    const std::size_t     bandRows    = std::max<std::size_t>(1, bandSize / (stride + 1));
+    const std::size_t     bandCount   = (height + bandRows - 1) / bandRows;
+    const std::size_t     threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    PngDataWriter writer{func, context, {}};
+
+    // zlib header: deflate with a 32 KiB window, no preset dictionary
+    const std::array<unsigned char, 2> zlibHeader{0x78, 0x01};
+    writer.write(zlibHeader.data(), zlibHeader.size());
+
+    // Encode the bands in groups of one band per thread, so that only
+    // the bands of the current group are held in memory at any time
+    std::uint32_t        adler = 1;
+    std::vector<PngBand> bands;
+    for (std::size_t group = 0; group < bandCount; group += threadCount)
+    {
+        bands.clear();
+        bands.resize(std::min(threadCount, bandCount - group));
+
+        std::vector<std::thread> workers;
+        for (std::size_t i = 0; i < bands.size(); ++i)
+        {
+            const std::size_t firstRow = (group + i) * bandRows;
+            const auto        encode   = [&, i, firstRow]
+            { bands[i] = encodePngBand(pixels, stride, firstRow, std::min(bandRows, height - firstRow), options); };
+
+            // The last band of the group is encoded by the calling thread, as well as
+            // the bands for which no thread can be started
+            if (i + 1 < bands.size())
+            {
+                try
+                {
+                    workers.emplace_back(encode);
+                    continue;
+                }
+                catch (const std::system_error&)
+                {
+                }
+            }
+            encode();
+        }
+
+        for (std::thread& worker : workers)
+            worker.join();
+
+        for (const PngBand& band : bands)
+        {
+            writer.write(band.compressed.data(), band.compressed.size());
+            adler = combineAdler32(adler, band.adler, band.size);
+        }
+    }
+
+    // Empty final block with fixed Huffman codes, then the checksum of the uncompressed data
+    std::vector<unsigned char> trailer{0x03, 0x00};
+    appendBigEndian(trailer, adler);
+    writer.write(trailer.data(), trailer.size());
+    writer.flush();
+
+    writePngChunk(func, context, "IEND", nullptr, 0);
+}
+
 // A helper to check if the given buffer is a valid QOI file magic number
 bool isQoiMagicNumber(std::string_view buffer)
 {
@@ -140,6 +679,18 @@ Image::Image(Vector2u size, const std::uint8_t* pixels)
 }
 
 
+////////////////////////////////////////////////////////////
+Image::Image(const ImageView& view)
+{
+    resize(view.getSize());
+
+    // Copy the rows one by one, the view may not be contiguous
+    const std::size_t pitch = static_cast<std::size_t>(m_size.x) * 4;
+    for (unsigned int y = 0; y < m_size.y; ++y)
+        std::memcpy(m_pixels.data() + y * pitch, view.getRowPtr(y), pitch);
+}
+
+
 ////////////////////////////////////////////////////////////
 Image::Image(const std::filesystem::path& filename)
 {
@@ -240,29 +791,10 @@ bool Image::loadFromFile(const std::filesystem::path& filename)
 
 #endif
 
-    // Set up the stb_image callbacks for the std::ifstream
-    const auto readStdIfStream = [](void* user, char* data, int size)
-    {
-        auto& file = *static_cast<std::ifstream*>(user);
-        file.read(data, size);
-        return static_cast<int>(file.gcount());
-    };
-    const auto skipStdIfStream = [](void* user, int size)
-    {
-        auto& file = *static_cast<std::ifstream*>(user);
-        if (!file.seekg(size, std::ios_base::cur))
-            err() << "Failed to seek image loader std::ifstream" << std::endl;
-    };
-    const auto eofStdIfStream = [](void* user)
-    {
-        auto& file = *static_cast<std::ifstream*>(user);
-        return static_cast<int>(file.eof());
-    };
-    const stbi_io_callbacks callbacks{readStdIfStream, skipStdIfStream, eofStdIfStream};
-
-    // Open file
-    std::ifstream file(filename, std::ios::binary);
-    if (!file.is_open())
+    // Map the file in memory, so that the decoders read its contents in place
+    priv::MappedFile file;
+    const bool       mapped = file.open(filename);
+    if (!mapped && errno != ENODEV)
     {
         // Error, failed to open the file
         err() << "Failed to load image\n"
@@ -270,27 +802,42 @@ bool Image::loadFromFile(const std::filesystem::path& filename)
         return false;
     }
 
-    // Read a (possible) QOI magic number
-    std::array<char, 4> qoiMagicNumber{};
-    file.read(qoiMagicNumber.data(), static_cast<std::streamsize>(qoiMagicNumber.size()));
+    // Pipes and files that are being written can't be mapped safely and procfs-style files report a size
+    // of 0 even though they have contents, read them sequentially instead
+    std::vector<std::uint8_t> buffer;
+    if (!mapped || file.getSize() == 0)
+    {
+        std::ifstream stream(filename, std::ios::binary);
+        if (!stream)
+        {
+            err() << "Failed to load image\n" << formatDebugPathInfo(filename) << std::endl;
+            return false;
+        }
 
-    // Seek back to the start of the file for reading
-    file.seekg(0, std::ios::beg);
+        buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
 
-    // Read the QOI file if it's valid
-    if (isQoiMagicNumber(std::string_view(qoiMagicNumber.data(), static_cast<size_t>(file.gcount()))))
+    const auto* const mappedData = reinterpret_cast<const std::uint8_t*>(file.getData());
+    const std::size_t fileSize   = buffer.empty() ? file.getSize() : buffer.size();
+
+    // The decoders take the size of their input as an int
+    if (fileSize > static_cast<std::size_t>(std::numeric_limits<int>::max()))
     {
-        // Get the size of the file
-        file.seekg(0, std::ios::end);
-        const auto streamSize = static_cast<std::streamsize>(file.tellg());
-        file.seekg(0, std::ios::beg);
+        err() << "Failed to load image\n"
+              << formatDebugPathInfo(filename) << "\nReason: File is too large" << std::endl;
+        return false;
+    }
 
-        // Read in the file contents since QOI doesn't support streams
-        std::vector<uint8_t> buffer(static_cast<size_t>(streamSize));
-        file.read(reinterpret_cast<char*>(buffer.data()), streamSize);
+    // Empty files are mapped to a null pointer, give the decoders a valid (empty) buffer instead
+    const std::uint8_t empty{};
+    const auto* const  data = !buffer.empty() ? buffer.data() : (mappedData ? mappedData : &empty);
+    const int          size = static_cast<int>(fileSize);
 
+    // Read the QOI file if it's valid
+    if (isQoiMagicNumber(std::string_view(reinterpret_cast<const char*>(data), fileSize)))
+    {
         qoi_desc formatDesc = {};
-        if (const auto ptr = MallocPtr(qoi_decode(buffer.data(), static_cast<int>(streamSize), &formatDesc, 4)))
+        if (const auto ptr = MallocPtr(qoi_decode(data, size, &formatDesc, 4)))
         {
             const Vector2u imageSize = {formatDesc.width, formatDesc.height};
             resize(imageSize, static_cast<const uint8_t*>(ptr.get()));
@@ -302,7 +849,7 @@ bool Image::loadFromFile(const std::filesystem::path& filename)
     sf::Vector2i imageSize;
     int          channels = 0;
     if (const auto ptr = StbPtr(
-            stbi_load_from_callbacks(&callbacks, &file, &imageSize.x, &imageSize.y, &channels, STBI_rgb_alpha)))
+            stbi_load_from_memory(data, size, &imageSize.x, &imageSize.y, &channels, STBI_rgb_alpha)))
     {
         resize(Vector2u(imageSize), ptr.get());
         return true;
@@ -458,8 +1005,8 @@ bool Image::saveToFile(const std::filesystem::path& filename) const
         {
             // PNG format
             std::ofstream file(filename, std::ios::binary);
-            if (stbi_write_png_to_func(writeStdOfstream, &file, convertedSize.x, convertedSize.y, 4, m_pixels.data(), 0) &&
-                file)
+            writePng(writeStdOfstream, &file, convertedSize, m_pixels.data(), {});
+            if (file)
                 return true;
         }
         else if (extension == ".jpg" || extension == ".jpeg")
@@ -524,8 +1071,8 @@ std::optional<std::vector<std::uint8_t>> Image::saveToMemory(std::string_view fo
         else if (specified == "png")
         {
             // PNG format
-            if (stbi_write_png_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, m_pixels.data(), 0))
-                return buffer;
+            writePng(bufferFromCallback, &buffer, convertedSize, m_pixels.data(), {});
+            return buffer;
         }
         else if (specified == "jpg" || specified == "jpeg")
         {
@@ -558,6 +1105,80 @@ std::optional<std::vector<std::uint8_t>> Image::saveToMemory(std::string_view fo
 }
 
 
+////////////////////////////////////////////////////////////
+bool Image::saveToStream(OutputStream& stream, std::string_view format) const
+{
+    return saveToStream(stream, format, {});
+}
+
+
+////////////////////////////////////////////////////////////
+bool Image::saveToStream(OutputStream& stream, std::string_view format, const EncodingOptions& options) const
+{
+    // Make sure the image is not empty
+    if (!m_pixels.empty() && m_size.x > 0 && m_size.y > 0)
+    {
+        // Choose function based on format
+        const std::string specified     = toLower(std::string(format));
+        const Vector2i    convertedSize = Vector2i(m_size);
+
+        // The BMP, TGA, JPG and PNG encoders hand the data over as soon as it's produced (band by band
+        // for PNG), while the QOI encoder compresses the whole image in memory before writing it to the stream
+        StreamWriter writer{stream};
+        bool         encoded = false;
+
+        if (specified == "bmp")
+        {
+            // BMP format
+            encoded = stbi_write_bmp_to_func(writeToStream, &writer, convertedSize.x, convertedSize.y, 4, m_pixels.data());
+        }
+        else if (specified == "tga")
+        {
+            // TGA format
+            encoded = stbi_write_tga_to_func(writeToStream, &writer, convertedSize.x, convertedSize.y, 4, m_pixels.data());
+        }
+        else if (specified == "png")
+        {
+            // PNG format
+            writePng(writeToStream, &writer, convertedSize, m_pixels.data(), options);
+            encoded = true;
+        }
+        else if (specified == "jpg" || specified == "jpeg")
+        {
+            // JPG format
+            encoded = stbi_write_jpg_to_func(writeToStream,
+                                             &writer,
+                                             convertedSize.x,
+                                             convertedSize.y,
+                                             4,
+                                             m_pixels.data(),
+                                             options.jpgQuality);
+        }
+        else if (specified == "qoi")
+        {
+            qoi_desc desc;
+            desc.width      = m_size.x;
+            desc.height     = m_size.y;
+            desc.channels   = 4;
+            desc.colorspace = QOI_LINEAR;
+
+            int dataSize = 0;
+            if (const auto ptr = MallocPtr(qoi_encode(m_pixels.data(), &desc, &dataSize)))
+            {
+                writeToStream(&writer, ptr.get(), dataSize);
+                encoded = true;
+            }
+        }
+
+        if (encoded && !writer.failed)
+            return true;
+    }
+
+    err() << "Failed to save image to stream with format " << std::quoted(format) << std::endl;
+    return false;
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2u Image::getSize() const
 {
@@ -611,20 +1232,32 @@ bool Image::copy(const Image& source, Vector2u dest, const IntRect& sourceRect,
             return false;
     }
 
+    return copy(ImageView(source).getSubView(IntRect(srcRect)), dest, applyAlpha);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Image::copy(const ImageView& source, Vector2u dest, bool applyAlpha)
+{
+    // Make sure that both the view and this image are valid
+    if (source.getSize().x == 0 || source.getSize().y == 0 || m_size.x == 0 || m_size.y == 0)
+        return false;
+
     // Make sure the destination position is within this image bounds
     if (m_size.x <= dest.x || m_size.y <= dest.y)
         return false;
 
     // Then find the valid size of the destination rectangle
-    const Vector2u dstSize(std::min(m_size.x - dest.x, srcRect.size.x), std::min(m_size.y - dest.y, srcRect.size.y));
+    const Vector2u srcSize = source.getSize();
+    const Vector2u dstSize(std::min(m_size.x - dest.x, srcSize.x), std::min(m_size.y - dest.y, srcSize.y));
 
     // Precompute as much as possible
     const std::size_t  pitch     = static_cast<std::size_t>(dstSize.x) * 4;
-    const unsigned int srcStride = source.m_size.x * 4;
+    const std::size_t  srcStride = static_cast<std::size_t>(source.getStride()) * 4;
     const unsigned int dstStride = m_size.x * 4;
 
-    const std::uint8_t* srcPixels = source.m_pixels.data() + (srcRect.position.x + srcRect.position.y * source.m_size.x) * 4;
-    std::uint8_t* dstPixels = m_pixels.data() + (dest.x + dest.y * m_size.x) * 4;
+    const std::uint8_t* srcPixels = source.getPixelsPtr();
+    std::uint8_t*       dstPixels = m_pixels.data() + (dest.x + dest.y * m_size.x) * 4;
 
     // Copy the pixels
     if (applyAlpha)
@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/ImageView.hpp>
+
+#include <cassert>
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+ImageView::ImageView(const std::uint8_t* pixels, Vector2u size, unsigned int stride) :
+m_pixels(pixels),
+m_size(size),
+m_stride(stride == 0 ? size.x : stride)
+{
+    assert(m_stride >= m_size.x && "ImageView::ImageView() Stride is smaller than the width of the view");
+
+    // An empty view doesn't point to any pixel
+    if (!m_pixels || m_size.x == 0 || m_size.y == 0)
+        *this = ImageView();
+}
+
+
+////////////////////////////////////////////////////////////
+ImageView::ImageView(const Image& image) : ImageView(image.getPixelsPtr(), image.getSize())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+ImageView ImageView::getSubView(const IntRect& area) const
+{
+    assert(area.position.x >= 0 && area.position.y >= 0 && area.size.x >= 0 && area.size.y >= 0 &&
+           "ImageView::getSubView() Area is negative");
+    assert(static_cast<unsigned int>(area.position.x + area.size.x) <= m_size.x &&
+           static_cast<unsigned int>(area.position.y + area.size.y) <= m_size.y &&
+           "ImageView::getSubView() Area is out of bounds");
+
+    const Rect<unsigned int> rect(area);
+    if (rect.size.x == 0 || rect.size.y == 0)
+        return {};
+
+    return {getRowPtr(rect.position.y) + std::size_t{rect.position.x} * 4, rect.size, m_stride};
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u ImageView::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int ImageView::getStride() const
+{
+    return m_stride;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ImageView::isContiguous() const
+{
+    return m_stride == m_size.x;
+}
+
+
+////////////////////////////////////////////////////////////
+Color ImageView::getPixel(Vector2u coords) const
+{
+    assert(coords.x < m_size.x && "ImageView::getPixel() x coordinate is out of bounds");
+    assert(coords.y < m_size.y && "ImageView::getPixel() y coordinate is out of bounds");
+
+    const std::uint8_t* pixel = getRowPtr(coords.y) + std::size_t{coords.x} * 4;
+    return {pixel[0], pixel[1], pixel[2], pixel[3]};
+}
+
+
+////////////////////////////////////////////////////////////
+const std::uint8_t* ImageView::getPixelsPtr() const
+{
+    return m_pixels;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::uint8_t* ImageView::getRowPtr(unsigned int y) const
+{
+    assert(y < m_size.y && "ImageView::getRowPtr() Row is out of bounds");
+
+    return m_pixels + std::size_t{y} * m_stride * 4;
+}
+
+} // namespace sf
@@ -191,6 +191,50 @@ std::uint32_t stencilFunctionToGlConstant(sf::StencilComparison comparison)
     assert(false);
     return GL_ALWAYS;
 }
+
+
+// Convert a VertexLayout::ComponentType constant to the corresponding OpenGL constant.
+GLenum componentTypeToGlConstant(sf::VertexLayout::ComponentType type)
+{
+    // clang-format off
+    switch (type)
+    {
+        case sf::VertexLayout::ComponentType::Float:         return GL_FLOAT;
+        case sf::VertexLayout::ComponentType::HalfFloat:     return GLEXT_GL_HALF_FLOAT;
+        case sf::VertexLayout::ComponentType::Short:         return GL_SHORT;
+        case sf::VertexLayout::ComponentType::UnsignedShort: return GL_UNSIGNED_SHORT;
+        case sf::VertexLayout::ComponentType::UnsignedByte:  return GL_UNSIGNED_BYTE;
+    }
+    // clang-format on
+
+    sf::err() << "Invalid value for sf::VertexLayout::ComponentType! Fallback to GL_FLOAT." << std::endl;
+    assert(false);
+    return GL_FLOAT;
+}
+
+
+// Check whether a vertex layout can be drawn with the current context
+bool isLayoutSupported(const sf::VertexLayout& layout)
+{
+    if (!layout.isValid())
+        return false;
+
+    // Make sure that extensions are initialized
+    sf::priv::ensureExtensionsInit();
+
+    if (GLEXT_half_float_vertex)
+        return true;
+
+    const auto isHalfFloat = [](const sf::VertexLayout::Attribute& attribute)
+    { return attribute.type == sf::VertexLayout::ComponentType::HalfFloat; };
+
+    return !isHalfFloat(layout.position) && !(layout.color && isHalfFloat(*layout.color)) &&
+           !(layout.texCoords && isHalfFloat(*layout.texCoords)) &&
+           std::none_of(layout.shaderAttributes.begin(),
+                        layout.shaderAttributes.end(),
+                        [&isHalfFloat](const sf::VertexLayout::ShaderAttribute& shaderAttribute)
+                        { return isHalfFloat(shaderAttribute.attribute); });
+}
 } // namespace RenderTargetImpl
 } // namespace
 
@@ -414,6 +458,39 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const void*         vertices,
+                        std::size_t         vertexCount,
+                        PrimitiveType       type,
+                        const VertexLayout& layout,
+                        const RenderStates& states)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0))
+        return;
+
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        if (!RenderTargetImpl::isLayoutSupported(layout))
+        {
+            err() << "Vertex layout is invalid or not supported, drawing skipped" << std::endl;
+            return;
+        }
+
+        setupDraw(false, states);
+        setupVertexLayout(layout, reinterpret_cast<std::uintptr_t>(vertices), states);
+
+        drawPrimitives(type, 0, vertexCount);
+
+        cleanupVertexLayout(layout);
+        cleanupDraw(states);
+
+        // Update the cache
+        m_cache.useVertexCache = false;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
 {
@@ -444,20 +521,23 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
 
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
+        if (!RenderTargetImpl::isLayoutSupported(vertexBuffer.getLayout()))
+        {
+            err() << "Vertex layout is invalid or not supported, drawing skipped" << std::endl;
+            return;
+        }
+
         setupDraw(false, states);
 
         // Bind vertex buffer
         VertexBuffer::bind(&vertexBuffer);
 
-        // Always enable texture coordinates
-        if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
-            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+        // Attribute pointers are offsets into the bound vertex buffer
+        setupVertexLayout(vertexBuffer.getLayout(), 0, states);
 
-        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
-        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
-        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
+        drawPrimitives(vertexBuffer.getPrimitiveType(), vertexBuffer.getRegionOffset() + firstVertex, vertexCount);
 
-        drawPrimitives(vertexBuffer.getPrimitiveType(), firstVertex, vertexCount);
+        cleanupVertexLayout(vertexBuffer.getLayout());
 
         // Unbind vertex buffer
         VertexBuffer::bind(nullptr);
@@ -465,8 +545,7 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
         cleanupDraw(states);
 
         // Update the cache
-        m_cache.useVertexCache        = false;
-        m_cache.texCoordsArrayEnabled = true;
+        m_cache.useVertexCache = false;
     }
 }
 
@@ -886,6 +965,103 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::setupVertexLayout(const VertexLayout&                  layout,
+                                     std::uintptr_t                       address,
+                                     [[maybe_unused]] const RenderStates& states)
+{
+    const auto pointer = [address](std::size_t offset) { return reinterpret_cast<const void*>(address + offset); };
+    const auto stride  = static_cast<GLsizei>(layout.stride);
+
+    // Check if texture coordinates array is needed, and update client state accordingly
+    const bool enableTexCoordsArray = layout.texCoords.has_value();
+    if (!m_cache.enable || (enableTexCoordsArray != m_cache.texCoordsArrayEnabled))
+    {
+        if (enableTexCoordsArray)
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+        else
+            glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
+    }
+
+    m_cache.texCoordsArrayEnabled = enableTexCoordsArray;
+
+    glCheck(glVertexPointer(static_cast<GLint>(layout.position.componentCount),
+                            RenderTargetImpl::componentTypeToGlConstant(layout.position.type),
+                            stride,
+                            pointer(layout.position.offset)));
+
+    // Vertices without color are drawn in white
+    if (layout.color)
+    {
+        glCheck(glColorPointer(static_cast<GLint>(layout.color->componentCount),
+                               RenderTargetImpl::componentTypeToGlConstant(layout.color->type),
+                               stride,
+                               pointer(layout.color->offset)));
+    }
+    else
+    {
+        glCheck(glDisableClientState(GL_COLOR_ARRAY));
+        glCheck(glColor4ub(255, 255, 255, 255));
+    }
+
+    if (layout.texCoords)
+    {
+        glCheck(glTexCoordPointer(static_cast<GLint>(layout.texCoords->componentCount),
+                                  RenderTargetImpl::componentTypeToGlConstant(layout.texCoords->type),
+                                  stride,
+                                  pointer(layout.texCoords->offset)));
+    }
+
+#ifndef SFML_OPENGL_ES
+
+    // Bind the additional attributes that are used by the current shader
+    if (states.shader && !layout.shaderAttributes.empty())
+    {
+        const GLEXT_GLhandle program = glCheck(GLEXT_glGetHandle(GLEXT_GL_PROGRAM_OBJECT));
+
+        for (const auto& [name, attribute] : layout.shaderAttributes)
+        {
+            const GLint location = glCheck(GLEXT_glGetAttribLocation(program, name.c_str()));
+
+            // Attributes the shader doesn't use are optimized out
+            if (location < 0)
+                continue;
+
+            const auto index = static_cast<GLuint>(location);
+
+            glCheck(GLEXT_glVertexAttribPointer(index,
+                                                static_cast<GLint>(attribute.componentCount),
+                                                RenderTargetImpl::componentTypeToGlConstant(attribute.type),
+                                                attribute.normalized ? GL_TRUE : GL_FALSE,
+                                                stride,
+                                                pointer(attribute.offset)));
+            glCheck(GLEXT_glEnableVertexAttribArray(index));
+
+            m_cache.enabledAttributes.push_back(index);
+        }
+    }
+
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::cleanupVertexLayout(const VertexLayout& layout)
+{
+#ifndef SFML_OPENGL_ES
+
+    for (const unsigned int index : m_cache.enabledAttributes)
+        glCheck(GLEXT_glDisableVertexAttribArray(index));
+
+#endif
+
+    m_cache.enabledAttributes.clear();
+
+    if (!layout.color)
+        glCheck(glEnableClientState(GL_COLOR_ARRAY));
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount)
 {
@@ -52,6 +52,14 @@ RenderTexture::RenderTexture(Vector2u size, const ContextSettings& settings)
 }
 
 
+////////////////////////////////////////////////////////////
+RenderTexture::RenderTexture(Vector2u size, Texture::Format format, const ContextSettings& settings)
+{
+    if (!resize(size, format, settings))
+        throw Exception("Failed to create render texture");
+}
+
+
 ////////////////////////////////////////////////////////////
 RenderTexture::~RenderTexture() = default;
 
@@ -66,10 +74,17 @@ RenderTexture& RenderTexture::operator=(RenderTexture&&) noexcept = default;
 
 ////////////////////////////////////////////////////////////
 bool RenderTexture::resize(Vector2u size, const ContextSettings& settings)
+{
+    return resize(size, Texture::Format::RGBA8, settings);
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTexture::resize(Vector2u size, Texture::Format format, const ContextSettings& settings)
 {
     // Create the texture
     // Set texture to be in sRGB scale if requested
-    if (!m_texture.resize(size, settings.sRgbCapable))
+    if (!m_texture.resize(size, format, settings.sRgbCapable))
     {
         err() << "Impossible to create render texture (failed to create the target texture)" << std::endl;
         return false;
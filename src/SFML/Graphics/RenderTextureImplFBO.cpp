@@ -28,6 +28,7 @@
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/RenderTextureImplFBO.hpp>
+#include <SFML/Graphics/TextureSaver.hpp>
 
 #include <SFML/Window/Context.hpp>
 #include <SFML/Window/ContextSettings.hpp>
@@ -249,6 +250,15 @@ bool RenderTextureImplFBO::create(Vector2u size, unsigned int textureId, const C
 
 #ifndef SFML_OPENGL_ES
 
+            // The multisample color buffer must have the same format as the target texture
+            // (RGBA, sRGB, floating point...) so that it can be resolved into it
+            GLint internalFormat = 0;
+            {
+                const TextureSaver save;
+                glCheck(glBindTexture(GL_TEXTURE_2D, textureId));
+                glCheck(glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &internalFormat));
+            }
+
             // Create the multisample color buffer
             GLuint color = 0;
             glCheck(GLEXT_glGenRenderbuffers(1, &color));
@@ -262,7 +272,7 @@ bool RenderTextureImplFBO::create(Vector2u size, unsigned int textureId, const C
             glCheck(GLEXT_glBindRenderbuffer(GLEXT_GL_RENDERBUFFER, m_colorBuffer));
             glCheck(GLEXT_glRenderbufferStorageMultisample(GLEXT_GL_RENDERBUFFER,
                                                            static_cast<GLsizei>(settings.antiAliasingLevel),
-                                                           m_sRgb ? GL_SRGB8_ALPHA8_EXT : GL_RGBA,
+                                                           static_cast<GLenum>(internalFormat),
                                                            static_cast<GLsizei>(size.x),
                                                            static_cast<GLsizei>(size.y)));
 
@@ -0,0 +1,162 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTexturePool.hpp>
+
+#include <algorithm>
+
+#include <cassert>
+
+
+namespace
+{
+// A "RenderTexturePoolImpl" namespace is required to avoid ambiguity in unity builds
+namespace RenderTexturePoolImpl
+{
+// Check whether two pixel formats and sets of settings result in compatible render textures
+[[nodiscard]] bool isCompatible(sf::Texture::Format        formatA,
+                                const sf::ContextSettings& a,
+                                sf::Texture::Format        formatB,
+                                const sf::ContextSettings& b)
+{
+    return (formatA == formatB) && (a.depthBits == b.depthBits) && (a.stencilBits == b.stencilBits) &&
+           (a.antiAliasingLevel == b.antiAliasingLevel) && (a.sRgbCapable == b.sRgbCapable);
+}
+} // namespace RenderTexturePoolImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+RenderTexturePool::RenderTexturePool(unsigned int maxUnusedFrames) : m_maxUnusedFrames(std::max(maxUnusedFrames, 1u))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexture* RenderTexturePool::acquire(Vector2u size, const ContextSettings& settings)
+{
+    return acquire(size, Texture::Format::RGBA8, settings);
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexture* RenderTexturePool::acquire(Vector2u size, Texture::Format format, const ContextSettings& settings)
+{
+    // Look for a released render texture matching the request
+    const auto it = std::find_if(m_entries.begin(),
+                                 m_entries.end(),
+                                 [&](const std::unique_ptr<Entry>& entry)
+                                 {
+                                     return !entry->inUse && (entry->renderTexture.getSize() == size) &&
+                                            RenderTexturePoolImpl::isCompatible(entry->format,
+                                                                                entry->settings,
+                                                                                format,
+                                                                                settings);
+                                 });
+
+    Entry* entry = nullptr;
+    if (it != m_entries.end())
+    {
+        entry = it->get();
+
+        // Reset the state that the previous user may have changed
+        entry->renderTexture.setView(entry->renderTexture.getDefaultView());
+        entry->renderTexture.setSmooth(false);
+        entry->renderTexture.setRepeated(false);
+    }
+    else
+    {
+        auto newEntry = std::make_unique<Entry>();
+        if (!newEntry->renderTexture.resize(size, format, settings))
+            return nullptr;
+
+        newEntry->format   = format;
+        newEntry->settings = settings;
+        entry              = m_entries.emplace_back(std::move(newEntry)).get();
+    }
+
+    entry->inUse         = true;
+    entry->lastUsedFrame = m_frame;
+
+    return &entry->renderTexture;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::release(RenderTexture& renderTexture)
+{
+    const auto it = std::find_if(m_entries.begin(),
+                                 m_entries.end(),
+                                 [&](const std::unique_ptr<Entry>& entry)
+                                 { return &entry->renderTexture == &renderTexture; });
+
+    assert(it != m_entries.end() && "RenderTexturePool::release() Render texture doesn't belong to the pool");
+    assert((*it)->inUse && "RenderTexturePool::release() Render texture was already released");
+
+    (*it)->inUse = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::endFrame()
+{
+    // Destroy the render textures that were not used recently, never the ones acquired during this frame
+    m_entries.erase(std::remove_if(m_entries.begin(),
+                                   m_entries.end(),
+                                   [this](const std::unique_ptr<Entry>& entry)
+                                   { return !entry->inUse && (m_frame - entry->lastUsedFrame >= m_maxUnusedFrames); }),
+                    m_entries.end());
+
+    // Release the render textures that are still in use
+    for (const auto& entry : m_entries)
+        entry->inUse = false;
+
+    ++m_frame;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::clear()
+{
+    assert(std::none_of(m_entries.begin(),
+                        m_entries.end(),
+                        [](const std::unique_ptr<Entry>& entry) { return entry->inUse; }) &&
+           "RenderTexturePool::clear() Render textures are still in use");
+
+    m_entries.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getSize() const
+{
+    return m_entries.size();
+}
+
+} // namespace sf
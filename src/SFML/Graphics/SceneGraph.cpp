@@ -0,0 +1,238 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/SceneGraph.hpp>
+
+#include <algorithm>
+
+#include <cassert>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SceneGraph::Id SceneGraph::add(Id parent, const Transform& localTransform)
+{
+    // Nodes are appended, so that they are always stored after their parent
+    const std::size_t index = m_ids.size();
+
+    Id id = m_indices.size();
+    if (!m_freeIds.empty())
+    {
+        id = m_freeIds.back();
+        m_freeIds.pop_back();
+        m_indices[id] = index;
+    }
+    else
+    {
+        m_indices.push_back(index);
+    }
+
+    m_localTransforms.push_back(localTransform);
+    m_worldTransforms.emplace_back();
+    m_parents.push_back(parent == NoParent ? NoParent : getIndex(parent));
+    m_drawables.push_back(nullptr);
+    m_ids.push_back(id);
+    m_dirty.push_back(true);
+    m_needUpdate = true;
+
+    return id;
+}
+
+
+////////////////////////////////////////////////////////////
+void SceneGraph::remove(Id id)
+{
+    const std::size_t first = getIndex(id);
+
+    // Descendants are always stored after their ancestors, so a single pass finds them all:
+    // a node is removed if it is the removed node, or if its parent was removed
+    std::vector<std::size_t> newIndices(m_ids.size() - first);
+    std::size_t              newIndex = first;
+    for (std::size_t index = first; index < m_ids.size(); ++index)
+    {
+        const std::size_t parent      = m_parents[index];
+        const bool        movedParent = (parent != NoParent) && (parent >= first);
+
+        if ((index == first) || (movedParent && (newIndices[parent - first] == NoParent)))
+        {
+            newIndices[index - first] = NoParent;
+            m_indices[m_ids[index]]   = NoParent;
+            m_freeIds.push_back(m_ids[index]);
+            continue;
+        }
+
+        // Move the node to its new position, its parent was already moved if needed
+        newIndices[index - first]   = newIndex;
+        m_localTransforms[newIndex] = m_localTransforms[index];
+        m_worldTransforms[newIndex] = m_worldTransforms[index];
+        m_parents[newIndex]         = movedParent ? newIndices[parent - first] : parent;
+        m_drawables[newIndex]       = m_drawables[index];
+        m_ids[newIndex]             = m_ids[index];
+        m_dirty[newIndex]           = m_dirty[index];
+        m_indices[m_ids[newIndex]]  = newIndex;
+        ++newIndex;
+    }
+
+    m_localTransforms.resize(newIndex);
+    m_worldTransforms.resize(newIndex);
+    m_parents.resize(newIndex);
+    m_drawables.resize(newIndex);
+    m_ids.resize(newIndex);
+    m_dirty.resize(newIndex);
+}
+
+
+////////////////////////////////////////////////////////////
+void SceneGraph::clear()
+{
+    m_localTransforms.clear();
+    m_worldTransforms.clear();
+    m_parents.clear();
+    m_drawables.clear();
+    m_ids.clear();
+    m_dirty.clear();
+    m_needUpdate = false;
+    m_indices.clear();
+    m_freeIds.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SceneGraph::getSize() const
+{
+    return m_ids.size();
+}
+
+
+////////////////////////////////////////////////////////////
+SceneGraph::Id SceneGraph::getParent(Id id) const
+{
+    const std::size_t parent = m_parents[getIndex(id)];
+    return parent == NoParent ? NoParent : m_ids[parent];
+}
+
+
+////////////////////////////////////////////////////////////
+void SceneGraph::setLocalTransform(Id id, const Transform& localTransform)
+{
+    const std::size_t index = getIndex(id);
+
+    m_localTransforms[index] = localTransform;
+    m_dirty[index]           = true;
+    m_needUpdate             = true;
+}
+
+
+////////////////////////////////////////////////////////////
+const Transform& SceneGraph::getLocalTransform(Id id) const
+{
+    return m_localTransforms[getIndex(id)];
+}
+
+
+////////////////////////////////////////////////////////////
+const Transform& SceneGraph::getWorldTransform(Id id) const
+{
+    const std::size_t index = getIndex(id);
+
+    if (m_needUpdate)
+        updateWorldTransforms();
+
+    return m_worldTransforms[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void SceneGraph::setDrawable(Id id, const Drawable* drawable)
+{
+    m_drawables[getIndex(id)] = drawable;
+}
+
+
+////////////////////////////////////////////////////////////
+const Drawable* SceneGraph::getDrawable(Id id) const
+{
+    return m_drawables[getIndex(id)];
+}
+
+
+////////////////////////////////////////////////////////////
+void SceneGraph::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_needUpdate)
+        updateWorldTransforms();
+
+    const Transform transform = states.transform;
+
+    for (std::size_t index = 0; index < m_ids.size(); ++index)
+    {
+        if (!m_drawables[index])
+            continue;
+
+        states.transform = transform * m_worldTransforms[index];
+        target.draw(*m_drawables[index], states);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SceneGraph::getIndex(Id id) const
+{
+    assert(id < m_indices.size() && m_indices[id] != NoParent && "SceneGraph::getIndex() Invalid identifier");
+
+    return m_indices[id];
+}
+
+
+////////////////////////////////////////////////////////////
+void SceneGraph::updateWorldTransforms() const
+{
+    // Parents are stored before their children, so their world transform
+    // and dirty flag are always up to date when their children are visited
+    for (std::size_t index = 0; index < m_ids.size(); ++index)
+    {
+        const std::size_t parent = m_parents[index];
+
+        if (parent == NoParent)
+        {
+            if (m_dirty[index])
+                m_worldTransforms[index] = m_localTransforms[index];
+        }
+        else if (m_dirty[index] || m_dirty[parent])
+        {
+            m_dirty[index]           = true;
+            m_worldTransforms[index] = m_worldTransforms[parent] * m_localTransforms[index];
+        }
+    }
+
+    std::fill(m_dirty.begin(), m_dirty.end(), std::uint8_t{0});
+    m_needUpdate = false;
+}
+
+} // namespace sf
@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/ShapeGeometry.hpp>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+ShapeGeometry::ShapeGeometry(const Shape& shape) :
+    m_texture(shape.m_texture),
+    m_vertices(shape.m_vertices),
+    m_outlineVertices(shape.m_outlineVertices),
+    m_bounds(shape.m_bounds)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture* ShapeGeometry::getTexture() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect ShapeGeometry::getLocalBounds() const
+{
+    return m_bounds;
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeGeometry::draw(RenderTarget& target, RenderStates states) const
+{
+    states.coordinateType = CoordinateType::Pixels;
+
+    // Render the inside
+    states.texture = m_texture;
+    target.draw(m_vertices, states);
+
+    // Render the outline
+    if (m_outlineVertices.getVertexCount() > 0)
+    {
+        states.texture = nullptr;
+        target.draw(m_outlineVertices, states);
+    }
+}
+
+} // namespace sf
@@ -0,0 +1,319 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/SpatialIndex.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <algorithm>
+
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+// A "SpatialIndexImpl" namespace is required to avoid ambiguity in unity builds
+namespace SpatialIndexImpl
+{
+// Objects covering more cells than this are tested by every query instead of being stored in cells
+constexpr int maxCellsPerObject = 64;
+
+// Cell coordinates are clamped to this range to avoid overflows with huge or infinite bounds
+constexpr float maxCellCoordinate = 1 << 29;
+
+[[nodiscard]] int toCellCoordinate(float coordinate, float cellSize)
+{
+    // Converting NaN to an integer is undefined behavior, put NaN bounds in the cell at the origin instead
+    const float cell = std::floor(coordinate / cellSize);
+    if (std::isnan(cell))
+        return 0;
+
+    return static_cast<int>(std::clamp(cell, -maxCellCoordinate, maxCellCoordinate));
+}
+
+[[nodiscard]] std::uint64_t getCellKey(int x, int y)
+{
+    return (std::uint64_t{static_cast<std::uint32_t>(x)} << 32) | static_cast<std::uint32_t>(y);
+}
+
+[[nodiscard]] bool intersects(const sf::FloatRect& a, const sf::FloatRect& b)
+{
+    return (a.position.x < b.position.x + b.size.x) && (b.position.x < a.position.x + a.size.x) &&
+           (a.position.y < b.position.y + b.size.y) && (b.position.y < a.position.y + a.size.y);
+}
+
+[[nodiscard]] bool isOversized(const sf::IntRect& cells)
+{
+    return static_cast<long long>(cells.size.x) * cells.size.y > maxCellsPerObject;
+}
+} // namespace SpatialIndexImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SpatialIndex::SpatialIndex(Vector2f cellSize) : m_cellSize(cellSize)
+{
+    assert(cellSize.x > 0.f && cellSize.y > 0.f && "SpatialIndex::SpatialIndex() Cell size must be positive");
+}
+
+
+////////////////////////////////////////////////////////////
+SpatialIndex::Id SpatialIndex::insert(const Drawable& drawable, const FloatRect& bounds)
+{
+    Id id = m_entries.size();
+    if (m_freeIds.empty())
+    {
+        m_entries.emplace_back();
+    }
+    else
+    {
+        id = m_freeIds.back();
+        m_freeIds.pop_back();
+    }
+
+    Entry& entry    = m_entries[id];
+    entry.drawable  = &drawable;
+    entry.bounds    = bounds;
+    entry.cells     = getCellRange(bounds);
+    entry.order     = m_nextOrder++;
+    entry.oversized = SpatialIndexImpl::isOversized(entry.cells);
+
+    link(id);
+    ++m_size;
+
+    return id;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::update(Id id, const FloatRect& bounds)
+{
+    assert(id < m_entries.size() && m_entries[id].drawable && "SpatialIndex::update() Invalid identifier");
+
+    Entry&        entry = m_entries[id];
+    const IntRect cells = getCellRange(bounds);
+    entry.bounds        = bounds;
+
+    // Nothing else to do if the object stays in the same cells
+    if (cells == entry.cells)
+        return;
+
+    unlink(id);
+    entry.cells     = cells;
+    entry.oversized = SpatialIndexImpl::isOversized(cells);
+    link(id);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::remove(Id id)
+{
+    assert(id < m_entries.size() && m_entries[id].drawable && "SpatialIndex::remove() Invalid identifier");
+
+    unlink(id);
+    m_entries[id].drawable = nullptr;
+    m_freeIds.push_back(id);
+    --m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::clear()
+{
+    m_entries.clear();
+    m_freeIds.clear();
+    m_cells.clear();
+    m_oversizedEntries.clear();
+    m_candidates.clear();
+    m_nextOrder = 0;
+    m_size      = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialIndex::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+const FloatRect& SpatialIndex::getBounds(Id id) const
+{
+    assert(id < m_entries.size() && m_entries[id].drawable && "SpatialIndex::getBounds() Invalid identifier");
+
+    return m_entries[id].bounds;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::query(const FloatRect& area, std::vector<const Drawable*>& result) const
+{
+    if (m_size == 0)
+        return;
+
+    // Reuse the storage of the previous queries
+    std::vector<Id>& candidates = m_candidates;
+    candidates.clear();
+
+    const IntRect range = getCellRange(area);
+
+    // An object covering several cells must only be reported once: it is reported
+    // by the first cell (in row-major order) that it shares with the queried area
+    const auto addCandidates = [&](int x, int y, const std::vector<Id>& ids)
+    {
+        for (const Id id : ids)
+        {
+            const Entry& entry = m_entries[id];
+            if ((x == std::max(entry.cells.position.x, range.position.x)) &&
+                (y == std::max(entry.cells.position.y, range.position.y)) &&
+                SpatialIndexImpl::intersects(entry.bounds, area))
+                candidates.push_back(id);
+        }
+    };
+
+    const long long rangeCellCount = static_cast<long long>(range.size.x) * range.size.y;
+    if (rangeCellCount > static_cast<long long>(m_cells.size()))
+    {
+        // The area covers more cells than there are non-empty cells: visit those directly
+        for (const auto& [key, ids] : m_cells)
+        {
+            const auto x = static_cast<int>(static_cast<std::uint32_t>(key >> 32));
+            const auto y = static_cast<int>(static_cast<std::uint32_t>(key));
+            if (range.contains({x, y}))
+                addCandidates(x, y, ids);
+        }
+    }
+    else
+    {
+        for (int y = range.position.y; y < range.position.y + range.size.y; ++y)
+        {
+            for (int x = range.position.x; x < range.position.x + range.size.x; ++x)
+            {
+                if (const auto it = m_cells.find(SpatialIndexImpl::getCellKey(x, y)); it != m_cells.end())
+                    addCandidates(x, y, it->second);
+            }
+        }
+    }
+
+    for (const Id id : m_oversizedEntries)
+    {
+        if (SpatialIndexImpl::intersects(m_entries[id].bounds, area))
+            candidates.push_back(id);
+    }
+
+    // Return the objects in draw order
+    std::sort(candidates.begin(),
+              candidates.end(),
+              [this](Id a, Id b) { return m_entries[a].order < m_entries[b].order; });
+
+    result.reserve(result.size() + candidates.size());
+    for (const Id id : candidates)
+        result.push_back(m_entries[id].drawable);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::query(const View& view, std::vector<const Drawable*>& result) const
+{
+    query(getVisibleArea(view), result);
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect SpatialIndex::getVisibleArea(const View& view)
+{
+    // The inverse transform of the view maps normalized device coordinates to world coordinates
+    return view.getInverseTransform().transformRect(FloatRect({-1.f, -1.f}, {2.f, 2.f}));
+}
+
+
+////////////////////////////////////////////////////////////
+IntRect SpatialIndex::getCellRange(const FloatRect& area) const
+{
+    const int left   = SpatialIndexImpl::toCellCoordinate(area.position.x, m_cellSize.x);
+    const int top    = SpatialIndexImpl::toCellCoordinate(area.position.y, m_cellSize.y);
+    const int right  = SpatialIndexImpl::toCellCoordinate(area.position.x + area.size.x, m_cellSize.x);
+    const int bottom = SpatialIndexImpl::toCellCoordinate(area.position.y + area.size.y, m_cellSize.y);
+
+    return {{std::min(left, right), std::min(top, bottom)},
+            {std::abs(right - left) + 1, std::abs(bottom - top) + 1}};
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::link(Id id)
+{
+    const Entry& entry = m_entries[id];
+
+    if (entry.oversized)
+    {
+        m_oversizedEntries.push_back(id);
+        return;
+    }
+
+    for (int y = entry.cells.position.y; y < entry.cells.position.y + entry.cells.size.y; ++y)
+        for (int x = entry.cells.position.x; x < entry.cells.position.x + entry.cells.size.x; ++x)
+            m_cells[SpatialIndexImpl::getCellKey(x, y)].push_back(id);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialIndex::unlink(Id id)
+{
+    const Entry& entry = m_entries[id];
+
+    const auto removeId = [id](std::vector<Id>& ids)
+    {
+        const auto it = std::find(ids.begin(), ids.end(), id);
+        assert(it != ids.end());
+        *it = ids.back();
+        ids.pop_back();
+    };
+
+    if (entry.oversized)
+    {
+        removeId(m_oversizedEntries);
+        return;
+    }
+
+    for (int y = entry.cells.position.y; y < entry.cells.position.y + entry.cells.size.y; ++y)
+    {
+        for (int x = entry.cells.position.x; x < entry.cells.position.x + entry.cells.size.x; ++x)
+        {
+            const auto it = m_cells.find(SpatialIndexImpl::getCellKey(x, y));
+            assert(it != m_cells.end());
+            removeId(it->second);
+            if (it->second.empty())
+                m_cells.erase(it);
+        }
+    }
+}
+
+} // namespace sf
@@ -0,0 +1,390 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/SpriteBatch.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Transform.hpp>
+
+#include <algorithm>
+
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+// A "SpriteBatchImpl" namespace is required to avoid ambiguity in unity builds
+namespace SpriteBatchImpl
+{
+// Number of vertices used to draw a sprite (two triangles)
+constexpr std::size_t verticesPerSprite = 6;
+} // namespace SpriteBatchImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::add(const Texture& texture, const IntRect& textureRect)
+{
+    const std::size_t index = m_positions.size();
+
+    m_positions.emplace_back();
+    m_rotations.emplace_back();
+    m_scales.emplace_back(1.f, 1.f);
+    m_origins.emplace_back();
+    m_textureRects.push_back(textureRect);
+    m_colors.push_back(Color::White);
+    m_textures.push_back(&texture);
+
+    invalidate(index);
+
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::add(const Sprite& sprite)
+{
+    const std::size_t index = add(sprite.getTexture(), sprite.getTextureRect());
+
+    m_positions[index] = sprite.getPosition();
+    m_rotations[index] = sprite.getRotation().asRadians();
+    m_scales[index]    = sprite.getScale();
+    m_origins[index]   = sprite.getOrigin();
+    m_colors[index]    = sprite.getColor();
+
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::remove(std::size_t index)
+{
+    assert(index < m_positions.size() && "SpriteBatch::remove() Index out of range");
+
+    const auto offset = static_cast<std::ptrdiff_t>(index);
+    m_positions.erase(m_positions.begin() + offset);
+    m_rotations.erase(m_rotations.begin() + offset);
+    m_scales.erase(m_scales.begin() + offset);
+    m_origins.erase(m_origins.begin() + offset);
+    m_textureRects.erase(m_textureRects.begin() + offset);
+    m_colors.erase(m_colors.begin() + offset);
+    m_textures.erase(m_textures.begin() + offset);
+
+    // Remove the vertices of the sprite if they were generated, the following ones are still valid
+    const std::size_t vertexBegin = std::min(index * SpriteBatchImpl::verticesPerSprite, m_vertices.size());
+    const std::size_t vertexEnd   = std::min(vertexBegin + SpriteBatchImpl::verticesPerSprite, m_vertices.size());
+    m_vertices.erase(m_vertices.begin() + static_cast<std::ptrdiff_t>(vertexBegin),
+                     m_vertices.begin() + static_cast<std::ptrdiff_t>(vertexEnd));
+
+    if (m_dirtyBegin > index)
+        --m_dirtyBegin;
+    if (m_dirtyEnd > index)
+        --m_dirtyEnd;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::clear()
+{
+    m_positions.clear();
+    m_rotations.clear();
+    m_scales.clear();
+    m_origins.clear();
+    m_textureRects.clear();
+    m_colors.clear();
+    m_textures.clear();
+    m_vertices.clear();
+    m_dirtyBegin = 0;
+    m_dirtyEnd   = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::getSize() const
+{
+    return m_positions.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::reserve(std::size_t count)
+{
+    m_positions.reserve(count);
+    m_rotations.reserve(count);
+    m_scales.reserve(count);
+    m_origins.reserve(count);
+    m_textureRects.reserve(count);
+    m_colors.reserve(count);
+    m_textures.reserve(count);
+    m_vertices.reserve(count * SpriteBatchImpl::verticesPerSprite);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setPosition(std::size_t index, Vector2f position)
+{
+    assert(index < m_positions.size() && "SpriteBatch::setPosition() Index out of range");
+
+    m_positions[index] = position;
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setRotation(std::size_t index, Angle angle)
+{
+    assert(index < m_rotations.size() && "SpriteBatch::setRotation() Index out of range");
+
+    m_rotations[index] = angle.wrapUnsigned().asRadians();
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setScale(std::size_t index, Vector2f factors)
+{
+    assert(index < m_scales.size() && "SpriteBatch::setScale() Index out of range");
+
+    m_scales[index] = factors;
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setOrigin(std::size_t index, Vector2f origin)
+{
+    assert(index < m_origins.size() && "SpriteBatch::setOrigin() Index out of range");
+
+    m_origins[index] = origin;
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setTexture(std::size_t index, const Texture& texture)
+{
+    assert(index < m_textures.size() && "SpriteBatch::setTexture() Index out of range");
+
+    // The vertices don't depend on the texture, they don't need to be updated
+    m_textures[index] = &texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setTextureRect(std::size_t index, const IntRect& rectangle)
+{
+    assert(index < m_textureRects.size() && "SpriteBatch::setTextureRect() Index out of range");
+
+    m_textureRects[index] = rectangle;
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setColor(std::size_t index, Color color)
+{
+    assert(index < m_colors.size() && "SpriteBatch::setColor() Index out of range");
+
+    m_colors[index] = color;
+    invalidate(index);
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f SpriteBatch::getPosition(std::size_t index) const
+{
+    assert(index < m_positions.size() && "SpriteBatch::getPosition() Index out of range");
+
+    return m_positions[index];
+}
+
+
+////////////////////////////////////////////////////////////
+Angle SpriteBatch::getRotation(std::size_t index) const
+{
+    assert(index < m_rotations.size() && "SpriteBatch::getRotation() Index out of range");
+
+    return radians(m_rotations[index]);
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f SpriteBatch::getScale(std::size_t index) const
+{
+    assert(index < m_scales.size() && "SpriteBatch::getScale() Index out of range");
+
+    return m_scales[index];
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f SpriteBatch::getOrigin(std::size_t index) const
+{
+    assert(index < m_origins.size() && "SpriteBatch::getOrigin() Index out of range");
+
+    return m_origins[index];
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& SpriteBatch::getTexture(std::size_t index) const
+{
+    assert(index < m_textures.size() && "SpriteBatch::getTexture() Index out of range");
+
+    return *m_textures[index];
+}
+
+
+////////////////////////////////////////////////////////////
+const IntRect& SpriteBatch::getTextureRect(std::size_t index) const
+{
+    assert(index < m_textureRects.size() && "SpriteBatch::getTextureRect() Index out of range");
+
+    return m_textureRects[index];
+}
+
+
+////////////////////////////////////////////////////////////
+Color SpriteBatch::getColor(std::size_t index) const
+{
+    assert(index < m_colors.size() && "SpriteBatch::getColor() Index out of range");
+
+    return m_colors[index];
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect SpriteBatch::getGlobalBounds(std::size_t index) const
+{
+    assert(index < m_positions.size() && "SpriteBatch::getGlobalBounds() Index out of range");
+
+    Transform transform;
+    transform.translate(m_positions[index]);
+    transform.rotate(radians(m_rotations[index]));
+    transform.scale(m_scales[index]);
+    transform.translate(-m_origins[index]);
+
+    const Vector2f size(m_textureRects[index].size);
+    return transform.transformRect({{0.f, 0.f}, {std::abs(size.x), std::abs(size.y)}});
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_dirtyBegin != m_dirtyEnd)
+        updateVertices();
+
+    states.coordinateType = CoordinateType::Pixels;
+
+    // Draw each run of consecutive sprites sharing the same texture with a single call
+    const std::size_t count = m_textures.size();
+    for (std::size_t begin = 0; begin < count;)
+    {
+        std::size_t end = begin + 1;
+        while ((end < count) && (m_textures[end] == m_textures[begin]))
+            ++end;
+
+        states.texture = m_textures[begin];
+        target.draw(m_vertices.data() + begin * SpriteBatchImpl::verticesPerSprite,
+                    (end - begin) * SpriteBatchImpl::verticesPerSprite,
+                    PrimitiveType::Triangles,
+                    states);
+
+        begin = end;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::invalidate(std::size_t index)
+{
+    if (m_dirtyBegin == m_dirtyEnd)
+    {
+        m_dirtyBegin = index;
+        m_dirtyEnd   = index + 1;
+    }
+    else
+    {
+        m_dirtyBegin = std::min(m_dirtyBegin, index);
+        m_dirtyEnd   = std::max(m_dirtyEnd, index + 1);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::updateVertices() const
+{
+    m_vertices.resize(m_positions.size() * SpriteBatchImpl::verticesPerSprite);
+
+    // Single pass over the attribute arrays: each iteration only reads the
+    // attributes of one sprite and writes its vertices, without branches
+    Vertex* vertices = m_vertices.data() + m_dirtyBegin * SpriteBatchImpl::verticesPerSprite;
+    for (std::size_t i = m_dirtyBegin; i < m_dirtyEnd; ++i)
+    {
+        // Same transform as sf::Transformable
+        const float cosine = std::cos(-m_rotations[i]);
+        const float sine   = std::sin(-m_rotations[i]);
+        const float sxc    = m_scales[i].x * cosine;
+        const float syc    = m_scales[i].y * cosine;
+        const float sxs    = m_scales[i].x * sine;
+        const float sys    = m_scales[i].y * sine;
+        const float tx     = -m_origins[i].x * sxc - m_origins[i].y * sys + m_positions[i].x;
+        const float ty     = m_origins[i].x * sxs - m_origins[i].y * syc + m_positions[i].y;
+
+        // Absolute value is used to support negative texture rect sizes, like sf::Sprite
+        const auto [texPosition, texSize] = FloatRect(m_textureRects[i]);
+
+        const float width  = std::abs(texSize.x);
+        const float height = std::abs(texSize.y);
+
+        const Vector2f topLeft(tx, ty);
+        const Vector2f topRight(sxc * width + tx, -sxs * width + ty);
+        const Vector2f bottomLeft(sys * height + tx, syc * height + ty);
+        const Vector2f bottomRight(topRight + bottomLeft - topLeft);
+
+        const Color color = m_colors[i];
+
+        vertices[0] = {topLeft, color, texPosition};
+        vertices[1] = {topRight, color, texPosition + Vector2f(texSize.x, 0.f)};
+        vertices[2] = {bottomLeft, color, texPosition + Vector2f(0.f, texSize.y)};
+        vertices[3] = vertices[2];
+        vertices[4] = vertices[1];
+        vertices[5] = {bottomRight, color, texPosition + texSize};
+
+        vertices += SpriteBatchImpl::verticesPerSprite;
+    }
+
+    m_dirtyBegin = 0;
+    m_dirtyEnd   = 0;
+}
+
+} // namespace sf
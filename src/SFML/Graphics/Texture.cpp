@@ -28,6 +28,7 @@
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/ImageView.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/TextureSaver.hpp>
 
@@ -60,6 +61,45 @@ std::uint64_t getUniqueId() noexcept
 
     return id.fetch_add(1);
 }
+
+// OpenGL description of a texture pixel format
+struct FormatInfo
+{
+    GLint        internalFormat; //!< Internal format of the texture
+    GLenum       pixelFormat;    //!< Format of the pixels transferred to or from the texture
+    unsigned int channelCount;   //!< Number of channels stored by the format
+};
+
+FormatInfo getFormatInfo(sf::Texture::Format format, bool sRgb)
+{
+    switch (format)
+    {
+        case sf::Texture::Format::RGBA8:
+            return {sRgb ? GLEXT_GL_SRGB8_ALPHA8 : GL_RGBA, GL_RGBA, 4};
+        case sf::Texture::Format::R8:
+            return {GLEXT_GL_R8, GLEXT_GL_RED, 1};
+        case sf::Texture::Format::RG8:
+            return {GLEXT_GL_RG8, GLEXT_GL_RG, 2};
+        case sf::Texture::Format::R16F:
+            return {GLEXT_GL_R16F, GLEXT_GL_RED, 1};
+        case sf::Texture::Format::RGBA16F:
+            return {GLEXT_GL_RGBA16F, GL_RGBA, 4};
+        case sf::Texture::Format::R32F:
+            return {GLEXT_GL_R32F, GLEXT_GL_RED, 1};
+        case sf::Texture::Format::RGBA32F:
+            return {GLEXT_GL_RGBA32F, GL_RGBA, 4};
+    }
+
+    assert(false && "Texture::Format is invalid");
+    return {GL_RGBA, GL_RGBA, 4};
+}
+
+// Get the size, in bytes, of a pixel transferred to or from a texture
+std::size_t getPixelSize(GLenum pixelFormat, GLenum pixelType)
+{
+    const std::size_t channelCount = (pixelFormat == GL_RGBA) ? 4 : ((pixelFormat == GLEXT_GL_RG) ? 2 : 1);
+    return channelCount * ((pixelType == GL_FLOAT) ? sizeof(float) : sizeof(std::uint8_t));
+}
 } // namespace TextureImpl
 } // namespace
 
@@ -144,6 +184,14 @@ Texture::Texture(Vector2u size, bool sRgb) : Texture()
 }
 
 
+////////////////////////////////////////////////////////////
+Texture::Texture(Vector2u size, Format format) : Texture()
+{
+    if (!resize(size, format))
+        throw Exception("Failed to create texture");
+}
+
+
 ////////////////////////////////////////////////////////////
 Texture::Texture(const Texture& copy) :
     GlResource(copy),
@@ -157,7 +205,7 @@ Texture::Texture(const Texture& copy) :
         return;
     }
 
-    if (resize(copy.getSize(), copy.isSrgb()))
+    if (resize(copy.getSize(), copy.m_format, copy.isSrgb()))
     {
         update(copy);
     }
@@ -193,6 +241,7 @@ Texture::Texture(Texture&& right) noexcept :
     m_size(std::exchange(right.m_size, {})),
     m_actualSize(std::exchange(right.m_actualSize, {})),
     m_texture(std::exchange(right.m_texture, 0)),
+    m_format(std::exchange(right.m_format, Format::RGBA8)),
     m_isSmooth(std::exchange(right.m_isSmooth, false)),
     m_sRgb(std::exchange(right.m_sRgb, false)),
     m_isRepeated(std::exchange(right.m_isRepeated, false)),
@@ -225,6 +274,7 @@ Texture& Texture::operator=(Texture&& right) noexcept
     m_size          = std::exchange(right.m_size, {});
     m_actualSize    = std::exchange(right.m_actualSize, {});
     m_texture       = std::exchange(right.m_texture, 0);
+    m_format        = std::exchange(right.m_format, Format::RGBA8);
     m_isSmooth      = std::exchange(right.m_isSmooth, false);
     m_sRgb          = std::exchange(right.m_sRgb, false);
     m_isRepeated    = std::exchange(right.m_isRepeated, false);
@@ -238,6 +288,20 @@ Texture& Texture::operator=(Texture&& right) noexcept
 
 ////////////////////////////////////////////////////////////
 bool Texture::resize(Vector2u size, bool sRgb)
+{
+    return resize(size, Format::RGBA8, sRgb);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::resize(Vector2u size, Format format)
+{
+    return resize(size, format, false);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::resize(Vector2u size, Format format, bool sRgb)
 {
     // Check if texture parameters are valid before creating it
     if ((size.x == 0) || (size.y == 0))
@@ -264,8 +328,16 @@ bool Texture::resize(Vector2u size, bool sRgb)
         return false;
     }
 
+    // Check that the driver can store the requested pixel format
+    if (!isFormatAvailable(format))
+    {
+        err() << "Failed to create texture, its pixel format is not supported by the graphics driver" << std::endl;
+        return false;
+    }
+
     // All the validity checks passed, we can store the new texture settings
     m_size          = size;
+    m_format        = format;
     m_actualSize    = actualSize;
     m_pixelsFlipped = false;
     m_fboAttachment = false;
@@ -300,7 +372,8 @@ bool Texture::resize(Vector2u size, bool sRgb)
 
     static const bool textureSrgb = GLEXT_texture_sRGB;
 
-    m_sRgb = sRgb;
+    // Only RGBA8 textures have an sRGB variant
+    m_sRgb = sRgb && (format == Format::RGBA8);
 
     if (m_sRgb && !textureSrgb)
     {
@@ -327,15 +400,17 @@ bool Texture::resize(Vector2u size, bool sRgb)
     const GLint textureWrapParam = m_isRepeated ? GL_REPEAT : GLEXT_GL_CLAMP_TO_EDGE;
 #endif
 
+    const TextureImpl::FormatInfo formatInfo = TextureImpl::getFormatInfo(m_format, m_sRgb);
+
     // Initialize the texture
     glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
     glCheck(glTexImage2D(GL_TEXTURE_2D,
                          0,
-                         (m_sRgb ? GLEXT_GL_SRGB8_ALPHA8 : GL_RGBA),
+                         formatInfo.internalFormat,
                          static_cast<GLsizei>(m_actualSize.x),
                          static_cast<GLsizei>(m_actualSize.y),
                          0,
-                         GL_RGBA,
+                         formatInfo.pixelFormat,
                          GL_UNSIGNED_BYTE,
                          nullptr));
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, textureWrapParam));
@@ -408,30 +483,10 @@ bool Texture::loadFromImage(const Image& image, bool sRgb, const IntRect& area)
     rectangle.size.x     = std::min(rectangle.size.x, size.x - rectangle.position.x);
     rectangle.size.y     = std::min(rectangle.size.y, size.y - rectangle.position.y);
 
-    // Create the texture and upload the pixels
+    // Create the texture and upload the pixels straight from the image
     if (resize(Vector2u(rectangle.size), sRgb))
     {
-        const TransientContextLock lock;
-
-        // Make sure that the current texture binding will be preserved
-        const priv::TextureSaver save;
-
-        // Copy the pixels to the texture, row by row
-        const std::uint8_t* pixels = image.getPixelsPtr() + 4 * (rectangle.position.x + (size.x * rectangle.position.y));
-        glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
-        for (int i = 0; i < rectangle.size.y; ++i)
-        {
-            glCheck(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, i, rectangle.size.x, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
-            pixels += 4 * size.x;
-        }
-
-        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
-        m_hasMipmap = false;
-
-        // Force an OpenGL flush, so that the texture will appear updated
-        // in all contexts immediately (solves problems in multi-threaded apps)
-        glCheck(glFlush());
-
+        update(ImageView(image).getSubView(rectangle));
         return true;
     }
 
@@ -447,6 +502,13 @@ Vector2u Texture::getSize() const
 }
 
 
+////////////////////////////////////////////////////////////
+Texture::Format Texture::getFormat() const
+{
+    return m_format;
+}
+
+
 ////////////////////////////////////////////////////////////
 Image Texture::copyToImage() const
 {
@@ -557,6 +619,33 @@ void Texture::update(const std::uint8_t* pixels)
 
 ////////////////////////////////////////////////////////////
 void Texture::update(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
+{
+    updatePixels(pixels, size, dest, TextureImpl::getFormatInfo(m_format, m_sRgb).pixelFormat, GL_UNSIGNED_BYTE);
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::update(const float* pixels)
+{
+    // Update the whole texture
+    update(pixels, m_size, {0, 0});
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::update(const float* pixels, Vector2u size, Vector2u dest)
+{
+    updatePixels(pixels, size, dest, TextureImpl::getFormatInfo(m_format, m_sRgb).pixelFormat, GL_FLOAT);
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::updatePixels(const void*  pixels,
+                           Vector2u     size,
+                           Vector2u     dest,
+                           unsigned int pixelFormat,
+                           unsigned int pixelType,
+                           unsigned int rowLength)
 {
     assert(dest.x + size.x <= m_size.x && "Destination x coordinate is outside of texture");
     assert(dest.y + size.y <= m_size.y && "Destination y coordinate is outside of texture");
@@ -571,17 +660,57 @@ void Texture::update(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
     // Make sure that the current texture binding will be preserved
     const priv::TextureSaver save;
 
+    // Rows of 1 and 2 bytes pixels are tightly packed, they are not necessarily aligned on 4 bytes
+    const bool unalignedRows = (pixelType == GL_UNSIGNED_BYTE) && (pixelFormat != GL_RGBA);
+    if (unalignedRows)
+        glCheck(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+
     // Copy pixels from the given array to the texture
     glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
-    glCheck(glTexSubImage2D(GL_TEXTURE_2D,
-                            0,
-                            static_cast<GLint>(dest.x),
-                            static_cast<GLint>(dest.y),
-                            static_cast<GLsizei>(size.x),
-                            static_cast<GLsizei>(size.y),
-                            GL_RGBA,
-                            GL_UNSIGNED_BYTE,
-                            pixels));
+
+    const bool strided = (rowLength != 0) && (rowLength != size.x);
+    if (!strided || GLEXT_unpack_subimage)
+    {
+        // Let the driver skip the end of each row itself
+        if (strided)
+            glCheck(glPixelStorei(GLEXT_GL_UNPACK_ROW_LENGTH, static_cast<GLint>(rowLength)));
+
+        glCheck(glTexSubImage2D(GL_TEXTURE_2D,
+                                0,
+                                static_cast<GLint>(dest.x),
+                                static_cast<GLint>(dest.y),
+                                static_cast<GLsizei>(size.x),
+                                static_cast<GLsizei>(size.y),
+                                static_cast<GLenum>(pixelFormat),
+                                static_cast<GLenum>(pixelType),
+                                pixels));
+
+        if (strided)
+            glCheck(glPixelStorei(GLEXT_GL_UNPACK_ROW_LENGTH, 0));
+    }
+    else
+    {
+        // The driver can't skip the end of the rows, upload them one by one
+        const std::size_t pitch = rowLength * TextureImpl::getPixelSize(pixelFormat, pixelType);
+        const auto*       row   = static_cast<const std::uint8_t*>(pixels);
+        for (unsigned int y = 0; y < size.y; ++y)
+        {
+            glCheck(glTexSubImage2D(GL_TEXTURE_2D,
+                                    0,
+                                    static_cast<GLint>(dest.x),
+                                    static_cast<GLint>(dest.y + y),
+                                    static_cast<GLsizei>(size.x),
+                                    1,
+                                    static_cast<GLenum>(pixelFormat),
+                                    static_cast<GLenum>(pixelType),
+                                    row));
+            row += pitch;
+        }
+    }
+
+    if (unalignedRows)
+        glCheck(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
     m_hasMipmap     = false;
     m_pixelsFlipped = false;
@@ -726,14 +855,30 @@ void Texture::update(const Texture& texture, Vector2u dest)
 void Texture::update(const Image& image)
 {
     // Update the whole texture
-    update(image.getPixelsPtr(), image.getSize(), {0, 0});
+    update(image, {0, 0});
 }
 
 
 ////////////////////////////////////////////////////////////
 void Texture::update(const Image& image, Vector2u dest)
 {
-    update(image.getPixelsPtr(), image.getSize(), dest);
+    update(ImageView(image), dest);
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::update(const ImageView& view)
+{
+    // Update the whole texture
+    update(view, {0, 0});
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::update(const ImageView& view, Vector2u dest)
+{
+    // Images are always RGBA, whatever the format of the texture
+    updatePixels(view.getPixelsPtr(), view.getSize(), dest, GL_RGBA, GL_UNSIGNED_BYTE, view.getStride());
 }
 
 
@@ -1031,6 +1176,33 @@ unsigned int Texture::getMaximumSize()
 }
 
 
+////////////////////////////////////////////////////////////
+bool Texture::isFormatAvailable(Format format)
+{
+    const TransientContextLock lock;
+
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    switch (format)
+    {
+        case Format::RGBA8:
+            return true;
+        case Format::R8:
+        case Format::RG8:
+            return GLEXT_texture_rg != 0;
+        case Format::RGBA16F:
+        case Format::RGBA32F:
+            return GLEXT_texture_float != 0;
+        case Format::R16F:
+        case Format::R32F:
+            return (GLEXT_texture_rg != 0) && (GLEXT_texture_float != 0);
+    }
+
+    return false;
+}
+
+
 ////////////////////////////////////////////////////////////
 Texture& Texture::operator=(const Texture& right)
 {
@@ -1048,6 +1220,7 @@ void Texture::swap(Texture& right) noexcept
     std::swap(m_size, right.m_size);
     std::swap(m_actualSize, right.m_actualSize);
     std::swap(m_texture, right.m_texture);
+    std::swap(m_format, right.m_format);
     std::swap(m_isSmooth, right.m_isSmooth);
     std::swap(m_sRgb, right.m_sRgb);
     std::swap(m_isRepeated, right.m_isRepeated);
@@ -0,0 +1,290 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/SpatialIndex.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TileMap.hpp>
+
+#include <algorithm>
+
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+// A "TileMapImpl" namespace is required to avoid ambiguity in unity builds
+namespace TileMapImpl
+{
+// Number of vertices used to draw a tile (two triangles)
+constexpr std::size_t verticesPerTile = 6;
+
+// Clamp a chunk index computed from a coordinate to [0, chunkCount]
+[[nodiscard]] unsigned int clampChunkIndex(float index, unsigned int chunkCount)
+{
+    return static_cast<unsigned int>(std::clamp(index, 0.f, static_cast<float>(chunkCount)));
+}
+} // namespace TileMapImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TileMap::TileMap(const Texture& tileset, Vector2u tileSize, Vector2u mapSize, unsigned int chunkSize) :
+m_texture(&tileset),
+m_tileSize(tileSize),
+m_mapSize(mapSize),
+m_chunkSize(chunkSize),
+m_chunkCount((mapSize.x + chunkSize - 1) / chunkSize, (mapSize.y + chunkSize - 1) / chunkSize),
+m_tiles(std::size_t{mapSize.x} * mapSize.y)
+{
+    assert(tileSize.x > 0 && tileSize.y > 0 && "TileMap::TileMap() Tile size must be positive");
+    assert(chunkSize > 0 && "TileMap::TileMap() Chunk size must be positive");
+
+    m_chunks.resize(std::size_t{m_chunkCount.x} * m_chunkCount.y);
+    for (unsigned int y = 0; y < m_chunkCount.y; ++y)
+    {
+        for (unsigned int x = 0; x < m_chunkCount.x; ++x)
+        {
+            Chunk& chunk   = m_chunks[x + std::size_t{y} * m_chunkCount.x];
+            chunk.position = {x * chunkSize, y * chunkSize};
+            chunk.size     = {std::min(chunkSize, mapSize.x - chunk.position.x),
+                              std::min(chunkSize, mapSize.y - chunk.position.y)};
+            chunk.vertexBuffer.setPrimitiveType(PrimitiveType::Triangles);
+            chunk.vertexBuffer.setUsage(VertexBuffer::Usage::Static);
+        }
+    }
+
+    invalidateChunks();
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTexture(const Texture& tileset)
+{
+    if (&tileset == m_texture)
+        return;
+
+    m_texture = &tileset;
+    invalidateChunks();
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTile(Vector2u position, unsigned int tile)
+{
+    assert(position.x < m_mapSize.x && position.y < m_mapSize.y && "TileMap::setTile() Position out of range");
+
+    unsigned int& current = m_tiles[position.x + std::size_t{position.y} * m_mapSize.x];
+    if (current == tile)
+        return;
+
+    current = tile;
+
+    // Extend the range of tiles of the chunk that must be uploaded
+    Chunk& chunk = m_chunks[position.x / m_chunkSize + std::size_t{position.y / m_chunkSize} * m_chunkCount.x];
+    const std::size_t index = (position.x - chunk.position.x) +
+                              std::size_t{position.y - chunk.position.y} * chunk.size.x;
+    if (chunk.dirtyBegin == chunk.dirtyEnd)
+    {
+        chunk.dirtyBegin = index;
+        chunk.dirtyEnd   = index + 1;
+    }
+    else
+    {
+        chunk.dirtyBegin = std::min(chunk.dirtyBegin, index);
+        chunk.dirtyEnd   = std::max(chunk.dirtyEnd, index + 1);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TileMap::getTile(Vector2u position) const
+{
+    assert(position.x < m_mapSize.x && position.y < m_mapSize.y && "TileMap::getTile() Position out of range");
+
+    return m_tiles[position.x + std::size_t{position.y} * m_mapSize.x];
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TileMap::getTexture() const
+{
+    return *m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getTileSize() const
+{
+    return m_tileSize;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getMapSize() const
+{
+    return m_mapSize;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TileMap::getChunkSize() const
+{
+    return m_chunkSize;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getLocalBounds() const
+{
+    return {{0.f, 0.f}, Vector2f(m_mapSize.componentWiseMul(m_tileSize))};
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::draw(RenderTarget& target, RenderStates states) const
+{
+    states.transform *= getTransform();
+    states.texture        = m_texture;
+    states.coordinateType = CoordinateType::Pixels;
+
+    // Find the chunks that intersect the visible area, in local coordinates
+    const FloatRect area = states.transform.getInverse().transformRect(SpatialIndex::getVisibleArea(target.getView()));
+    const Vector2f  chunkSize(m_tileSize * m_chunkSize);
+
+    const Vector2f begin = area.position.componentWiseDiv(chunkSize);
+    const Vector2f end   = (area.position + area.size).componentWiseDiv(chunkSize);
+
+    const unsigned int left   = TileMapImpl::clampChunkIndex(std::floor(begin.x), m_chunkCount.x);
+    const unsigned int top    = TileMapImpl::clampChunkIndex(std::floor(begin.y), m_chunkCount.y);
+    const unsigned int right  = TileMapImpl::clampChunkIndex(std::ceil(end.x), m_chunkCount.x);
+    const unsigned int bottom = TileMapImpl::clampChunkIndex(std::ceil(end.y), m_chunkCount.y);
+
+    const bool useVertexBuffers = VertexBuffer::isAvailable();
+
+    for (unsigned int y = top; y < bottom; ++y)
+    {
+        for (unsigned int x = left; x < right; ++x)
+        {
+            Chunk& chunk = m_chunks[x + std::size_t{y} * m_chunkCount.x];
+            if (chunk.dirtyBegin != chunk.dirtyEnd)
+                updateChunk(chunk);
+
+            if (useVertexBuffers)
+                target.draw(chunk.vertexBuffer, states);
+            else
+                target.draw(chunk.vertices.data(), chunk.vertices.size(), PrimitiveType::Triangles, states);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::updateChunk(Chunk& chunk) const
+{
+    const std::size_t vertexCount = std::size_t{chunk.size.x} * chunk.size.y * TileMapImpl::verticesPerTile;
+
+    const bool useVertexBuffers = VertexBuffer::isAvailable();
+    if (useVertexBuffers)
+    {
+        // The whole chunk must be uploaded when its buffer is created
+        if (chunk.vertexBuffer.getVertexCount() != vertexCount)
+        {
+            if (!chunk.vertexBuffer.create(vertexCount))
+                return;
+
+            chunk.dirtyBegin = 0;
+            chunk.dirtyEnd   = vertexCount / TileMapImpl::verticesPerTile;
+        }
+
+        m_uploadBuffer.resize((chunk.dirtyEnd - chunk.dirtyBegin) * TileMapImpl::verticesPerTile);
+    }
+    else
+    {
+        chunk.vertices.resize(vertexCount);
+    }
+
+    Vertex* vertices = useVertexBuffers ? m_uploadBuffer.data()
+                                        : chunk.vertices.data() + chunk.dirtyBegin * TileMapImpl::verticesPerTile;
+
+    const unsigned int tilesPerRow = std::max(m_texture->getSize().x / m_tileSize.x, 1u);
+    const Vector2f     tileSize(m_tileSize);
+
+    for (std::size_t index = chunk.dirtyBegin; index < chunk.dirtyEnd; ++index)
+    {
+        const Vector2u tilePosition(chunk.position.x + static_cast<unsigned int>(index % chunk.size.x),
+                                    chunk.position.y + static_cast<unsigned int>(index / chunk.size.x));
+
+        const unsigned int tile = m_tiles[tilePosition.x + std::size_t{tilePosition.y} * m_mapSize.x];
+        const Vector2u     tileCoords(tile % tilesPerRow, tile / tilesPerRow);
+
+        const Vector2f position  = Vector2f(tilePosition).componentWiseMul(tileSize);
+        const Vector2f texCoords = Vector2f(tileCoords).componentWiseMul(tileSize);
+
+        // Two triangles per tile
+        vertices[0] = {position, Color::White, texCoords};
+        vertices[1] = {position + Vector2f(tileSize.x, 0.f), Color::White, texCoords + Vector2f(tileSize.x, 0.f)};
+        vertices[2] = {position + Vector2f(0.f, tileSize.y), Color::White, texCoords + Vector2f(0.f, tileSize.y)};
+        vertices[3] = vertices[2];
+        vertices[4] = vertices[1];
+        vertices[5] = {position + tileSize, Color::White, texCoords + tileSize};
+
+        vertices += TileMapImpl::verticesPerTile;
+    }
+
+    if (useVertexBuffers &&
+        !chunk.vertexBuffer.update(m_uploadBuffer.data(),
+                                   m_uploadBuffer.size(),
+                                   static_cast<unsigned int>(chunk.dirtyBegin * TileMapImpl::verticesPerTile)))
+        return;
+
+    chunk.dirtyBegin = 0;
+    chunk.dirtyEnd   = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::invalidateChunks()
+{
+    for (Chunk& chunk : m_chunks)
+    {
+        chunk.dirtyBegin = 0;
+        chunk.dirtyEnd   = std::size_t{chunk.size.x} * chunk.size.y;
+    }
+}
+
+} // namespace sf
@@ -26,6 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 
 #include <SFML/System/Angle.hpp>
 
@@ -67,4 +68,42 @@ Transform& Transform::rotate(Angle angle, Vector2f center)
     return combine(rotation);
 }
 
+
+////////////////////////////////////////////////////////////
+void Transform::transformPoints(const Vector2f* points, std::size_t count, Vector2f* result) const
+{
+    // Copy the coefficients to local variables, so that the compiler
+    // knows that writing the results doesn't modify them and can vectorize the loop
+    const float a00 = m_matrix[0];
+    const float a01 = m_matrix[4];
+    const float a02 = m_matrix[12];
+    const float a10 = m_matrix[1];
+    const float a11 = m_matrix[5];
+    const float a12 = m_matrix[13];
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const Vector2f point = points[i];
+        result[i]            = {a00 * point.x + a01 * point.y + a02, a10 * point.x + a11 * point.y + a12};
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Transform::transformVertices(Vertex* vertices, std::size_t count) const
+{
+    const float a00 = m_matrix[0];
+    const float a01 = m_matrix[4];
+    const float a02 = m_matrix[12];
+    const float a10 = m_matrix[1];
+    const float a11 = m_matrix[5];
+    const float a12 = m_matrix[13];
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const Vector2f point = vertices[i].position;
+        vertices[i].position = {a00 * point.x + a01 * point.y + a02, a10 * point.x + a11 * point.y + a12};
+    }
+}
+
 } // namespace sf
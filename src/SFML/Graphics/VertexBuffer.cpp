@@ -57,6 +57,31 @@ GLenum usageToGlEnum(sf::VertexBuffer::Usage usage)
             return GLEXT_GL_STREAM_DRAW;
     }
 }
+
+// Requires an active context
+bool isPersistentMappingAvailable()
+{
+    // Make sure that extensions are initialized
+    sf::priv::ensureExtensionsInit();
+
+    return GLEXT_buffer_storage && GLEXT_map_buffer_range && GLEXT_sync;
+}
+
+void waitForFence(void*& fence)
+{
+    auto* const sync = static_cast<GLsync>(fence);
+
+    // Flushing guarantees that the fence eventually gets signaled
+    GLenum result = GLEXT_GL_TIMEOUT_EXPIRED;
+    while (result == GLEXT_GL_TIMEOUT_EXPIRED)
+        result = glCheck(GLEXT_glClientWaitSync(sync, GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000));
+
+    if (result == GLEXT_GL_WAIT_FAILED)
+        sf::err() << "Failed to wait for vertex buffer region to become available" << std::endl;
+
+    glCheck(GLEXT_glDeleteSync(sync));
+    fence = nullptr;
+}
 } // namespace VertexBufferImpl
 } // namespace
 
@@ -85,7 +110,8 @@ VertexBuffer::VertexBuffer(PrimitiveType type, Usage usage) : m_primitiveType(ty
 VertexBuffer::VertexBuffer(const VertexBuffer& copy) :
     GlResource(copy),
     m_primitiveType(copy.m_primitiveType),
-    m_usage(copy.m_usage)
+    m_usage(copy.m_usage),
+    m_layout(copy.m_layout)
 {
     if (copy.m_buffer && copy.m_size)
     {
@@ -108,7 +134,10 @@ VertexBuffer::~VertexBuffer()
     {
         const TransientContextLock contextLock;
 
-        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+        releaseRegions();
+
+        if (m_buffer)
+            glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
     }
 }
 
@@ -121,6 +150,8 @@ bool VertexBuffer::create(std::size_t vertexCount)
 
     const TransientContextLock contextLock;
 
+    releaseRegions();
+
     if (!m_buffer)
         glCheck(GLEXT_glGenBuffers(1, &m_buffer));
 
@@ -132,7 +163,7 @@ bool VertexBuffer::create(std::size_t vertexCount)
 
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
     glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
-                               static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                               static_cast<GLsizeiptrARB>(m_layout.stride * vertexCount),
                                nullptr,
                                VertexBufferImpl::usageToGlEnum(m_usage)));
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
@@ -144,58 +175,99 @@ bool VertexBuffer::create(std::size_t vertexCount)
 
 
 ////////////////////////////////////////////////////////////
-std::size_t VertexBuffer::getVertexCount() const
+bool VertexBuffer::create(std::size_t vertexCount, std::size_t regionCount)
 {
-    return m_size;
-}
+    if ((regionCount < 2) || (vertexCount == 0))
+        return create(vertexCount);
 
+    if (!isAvailable())
+        return false;
 
-////////////////////////////////////////////////////////////
-bool VertexBuffer::update(const Vertex* vertices)
-{
-    return update(vertices, m_size, 0);
-}
+    const TransientContextLock contextLock;
 
+    releaseRegions();
 
-////////////////////////////////////////////////////////////
-bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsigned int offset)
-{
-    // Sanity checks
-    if (!m_buffer)
-        return false;
+    // Storage created with glBufferStorage is immutable, so always start from a fresh buffer
+    if (m_buffer)
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
 
-    if (!vertices)
-        return false;
+    m_buffer = 0;
+    glCheck(GLEXT_glGenBuffers(1, &m_buffer));
 
-    if (offset && (offset + vertexCount > m_size))
+    if (!m_buffer)
+    {
+        err() << "Could not create vertex buffer, generation failed" << std::endl;
+        m_size = 0;
         return false;
+    }
 
-    const TransientContextLock contextLock;
+    const auto bufferSize = static_cast<GLsizeiptr>(m_layout.stride * vertexCount * regionCount);
 
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
 
-    // Check if we need to resize or orphan the buffer
-    if (vertexCount >= m_size)
+    const bool persistentMappingAvailable = VertexBufferImpl::isPersistentMappingAvailable();
+
+    if (persistentMappingAvailable)
     {
-        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
-                                   static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
-                                   nullptr,
-                                   VertexBufferImpl::usageToGlEnum(m_usage)));
+        // Coherent mapping makes writes visible to the GPU without explicit flushes,
+        // the fences take care of not overwriting regions that are still being read
+        const GLbitfield flags = GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_PERSISTENT_BIT | GLEXT_GL_MAP_COHERENT_BIT;
 
-        m_size = vertexCount;
+        glCheck(GLEXT_glBufferStorage(GLEXT_GL_ARRAY_BUFFER, bufferSize, nullptr, flags));
+        m_persistentMapping = glCheck(GLEXT_glMapBufferRange(GLEXT_GL_ARRAY_BUFFER, 0, bufferSize, flags));
+
+        if (!m_persistentMapping)
+            err() << "Could not persistently map vertex buffer, falling back to buffered uploads" << std::endl;
     }
 
-    glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
-                                  static_cast<GLintptrARB>(sizeof(Vertex) * offset),
-                                  static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
-                                  vertices));
+    if (!m_persistentMapping)
+    {
+        // The buffer might have been created immutable above, start over with a mutable one
+        if (persistentMappingAvailable)
+        {
+            glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+            glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+            glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+            glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+        }
+
+        glCheck(
+            GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER, bufferSize, nullptr, VertexBufferImpl::usageToGlEnum(m_usage)));
+        m_stagingData.resize(m_layout.stride * vertexCount);
+    }
 
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
 
+    m_size          = vertexCount;
+    m_regionCount   = regionCount;
+    m_currentRegion = 0;
+    m_fences.assign(regionCount, nullptr);
+
     return true;
 }
 
 
+////////////////////////////////////////////////////////////
+std::size_t VertexBuffer::getVertexCount() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::update(const Vertex* vertices)
+{
+    return update(vertices, m_size, 0);
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsigned int offset)
+{
+    return updateData(vertices, sizeof(Vertex), vertexCount, offset);
+}
+
+
 ////////////////////////////////////////////////////////////
 bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
 {
@@ -205,9 +277,14 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
 
 #else
 
-    if (!m_buffer || !vertexBuffer.m_buffer)
+    if (!m_buffer || !vertexBuffer.m_buffer || (m_regionCount > 1))
+        return false;
+
+    if (m_layout.stride != vertexBuffer.m_layout.stride)
         return false;
 
+    const std::size_t sourceOffset = m_layout.stride * vertexBuffer.getRegionOffset();
+
     const TransientContextLock contextLock;
 
     // Make sure that extensions are initialized
@@ -220,9 +297,9 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
 
         glCheck(GLEXT_glCopyBufferSubData(GLEXT_GL_COPY_READ_BUFFER,
                                           GLEXT_GL_COPY_WRITE_BUFFER,
+                                          static_cast<GLintptr>(sourceOffset),
                                           0,
-                                          0,
-                                          static_cast<GLsizeiptr>(sizeof(Vertex) * vertexBuffer.m_size)));
+                                          static_cast<GLsizeiptr>(m_layout.stride * vertexBuffer.m_size)));
 
         glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, 0));
         glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_READ_BUFFER, 0));
@@ -232,7 +309,7 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
 
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
     glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
-                               static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexBuffer.m_size),
+                               static_cast<GLsizeiptrARB>(m_layout.stride * vertexBuffer.m_size),
                                nullptr,
                                VertexBufferImpl::usageToGlEnum(m_usage)));
 
@@ -240,9 +317,10 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
 
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, vertexBuffer.m_buffer));
 
-    const void* const source = glCheck(GLEXT_glMapBuffer(GLEXT_GL_ARRAY_BUFFER, GLEXT_GL_READ_ONLY));
+    const auto* const source = static_cast<const std::byte*>(
+        glCheck(GLEXT_glMapBuffer(GLEXT_GL_ARRAY_BUFFER, GLEXT_GL_READ_ONLY)));
 
-    std::memcpy(destination, source, sizeof(Vertex) * vertexBuffer.m_size);
+    std::memcpy(destination, source + sourceOffset, m_layout.stride * vertexBuffer.m_size);
 
     const GLboolean sourceResult = glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER));
 
@@ -258,6 +336,60 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
 }
 
 
+////////////////////////////////////////////////////////////
+Vertex* VertexBuffer::mapRegion()
+{
+    return static_cast<Vertex*>(mapRegionData(sizeof(Vertex)));
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::unmapRegion()
+{
+    if (!m_mappedRegion)
+        return false;
+
+    const std::size_t region = (m_currentRegion + 1) % m_regionCount;
+
+    const TransientContextLock contextLock;
+
+    if (m_persistentMapping)
+    {
+        // All draw calls sourcing the current region have been issued by now,
+        // fence it so that it doesn't get overwritten while the GPU still reads it
+        m_fences[m_currentRegion] = glCheck(GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    }
+    else
+    {
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+        glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                      static_cast<GLintptrARB>(m_layout.stride * region * m_size),
+                                      static_cast<GLsizeiptrARB>(m_layout.stride * m_size),
+                                      m_stagingData.data()));
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+    }
+
+    m_currentRegion = region;
+    m_mappedRegion  = nullptr;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t VertexBuffer::getRegionCount() const
+{
+    return m_regionCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t VertexBuffer::getRegionOffset() const
+{
+    return m_currentRegion * m_size;
+}
+
+
 ////////////////////////////////////////////////////////////
 VertexBuffer& VertexBuffer::operator=(const VertexBuffer& right)
 {
@@ -276,6 +408,13 @@ void VertexBuffer::swap(VertexBuffer& right) noexcept
     std::swap(m_buffer, right.m_buffer);
     std::swap(m_primitiveType, right.m_primitiveType);
     std::swap(m_usage, right.m_usage);
+    std::swap(m_regionCount, right.m_regionCount);
+    std::swap(m_currentRegion, right.m_currentRegion);
+    std::swap(m_persistentMapping, right.m_persistentMapping);
+    std::swap(m_mappedRegion, right.m_mappedRegion);
+    std::swap(m_fences, right.m_fences);
+    std::swap(m_stagingData, right.m_stagingData);
+    std::swap(m_layout, right.m_layout);
 }
 
 
@@ -326,6 +465,26 @@ VertexBuffer::Usage VertexBuffer::getUsage() const
 }
 
 
+////////////////////////////////////////////////////////////
+void VertexBuffer::setLayout(const VertexLayout& layout)
+{
+    const bool strideChanged = (layout.stride != m_layout.stride);
+    m_layout                 = layout;
+
+    // The storage of an existing buffer is sized for the previous stride: create it again with the same
+    // number of vertices and regions, so that updates and mapped regions never write past its end
+    if (m_buffer && strideChanged && !create(m_size, m_regionCount))
+        m_size = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+const VertexLayout& VertexBuffer::getLayout() const
+{
+    return m_layout;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool VertexBuffer::isAvailable()
 {
@@ -351,6 +510,131 @@ void VertexBuffer::draw(RenderTarget& target, RenderStates states) const
 }
 
 
+////////////////////////////////////////////////////////////
+bool VertexBuffer::updateData(const void*  vertices,
+                              std::size_t  vertexSize,
+                              std::size_t  vertexCount,
+                              unsigned int offset)
+{
+    // Sanity checks
+    if (!m_buffer)
+        return false;
+
+    if (!vertices)
+        return false;
+
+    if (vertexSize != m_layout.stride)
+    {
+        err() << "Failed to update vertex buffer, vertex size (" << vertexSize
+              << ") does not match the stride of the vertex layout (" << m_layout.stride << ")" << std::endl;
+        return false;
+    }
+
+    if (offset && (offset + vertexCount > m_size))
+        return false;
+
+    if (m_regionCount > 1)
+    {
+        if (offset || (vertexCount > m_size))
+            return false;
+
+        void* const region = mapRegionData(vertexSize);
+
+        if (!region)
+            return false;
+
+        std::memcpy(region, vertices, vertexSize * vertexCount);
+
+        return unmapRegion();
+    }
+
+    const TransientContextLock contextLock;
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+
+    // Check if we need to resize or orphan the buffer
+    if (vertexCount >= m_size)
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                   static_cast<GLsizeiptrARB>(m_layout.stride * vertexCount),
+                                   nullptr,
+                                   VertexBufferImpl::usageToGlEnum(m_usage)));
+
+        m_size = vertexCount;
+    }
+
+    glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                  static_cast<GLintptrARB>(m_layout.stride * offset),
+                                  static_cast<GLsizeiptrARB>(m_layout.stride * vertexCount),
+                                  vertices));
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void* VertexBuffer::mapRegionData(std::size_t vertexSize)
+{
+    if (!m_buffer || (m_regionCount < 2) || m_mappedRegion)
+        return nullptr;
+
+    if (vertexSize != m_layout.stride)
+    {
+        err() << "Failed to map vertex buffer region, vertex size (" << vertexSize
+              << ") does not match the stride of the vertex layout (" << m_layout.stride << ")" << std::endl;
+        return nullptr;
+    }
+
+    const std::size_t region = (m_currentRegion + 1) % m_regionCount;
+
+    if (m_persistentMapping)
+    {
+        if (m_fences[region])
+        {
+            const TransientContextLock contextLock;
+
+            VertexBufferImpl::waitForFence(m_fences[region]);
+        }
+
+        m_mappedRegion = static_cast<std::byte*>(m_persistentMapping) + m_layout.stride * region * m_size;
+    }
+    else
+    {
+        m_mappedRegion = m_stagingData.data();
+    }
+
+    return m_mappedRegion;
+}
+
+
+////////////////////////////////////////////////////////////
+void VertexBuffer::releaseRegions()
+{
+    for (void*& fence : m_fences)
+    {
+        if (fence)
+            glCheck(GLEXT_glDeleteSync(static_cast<GLsync>(fence)));
+    }
+
+    // Deleting the buffer implicitly unmaps it
+    if (m_persistentMapping)
+    {
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+        m_buffer = 0;
+        m_size   = 0;
+    }
+
+    m_fences.clear();
+    m_stagingData.clear();
+    m_persistentMapping = nullptr;
+    m_mappedRegion      = nullptr;
+    m_regionCount       = 1;
+    m_currentRegion     = 0;
+}
+
+
 ////////////////////////////////////////////////////////////
 void swap(VertexBuffer& left, VertexBuffer& right) noexcept
 {
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/VertexLayout.hpp>
+
+#include <algorithm>
+
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+bool VertexLayout::isValid() const
+{
+    // Check that an attribute has a supported size and lies within the vertex
+    const auto fits = [this](const Attribute& attribute)
+    {
+        return (attribute.componentCount >= 1) && (attribute.componentCount <= 4) &&
+               (attribute.offset + attribute.componentCount * getComponentSize(attribute.type) <= stride);
+    };
+
+    // Positions and texture coordinates are not normalized by the fixed-function pipeline,
+    // restrict them to the types it accepts
+    const auto isUnnormalizedType = [](ComponentType type)
+    { return (type == ComponentType::Float) || (type == ComponentType::HalfFloat) || (type == ComponentType::Short); };
+
+    if (stride == 0)
+        return false;
+
+    if (!fits(position) || (position.componentCount < 2) || !isUnnormalizedType(position.type))
+        return false;
+
+    if (color && (!fits(*color) || (color->componentCount < 3)))
+        return false;
+
+    if (texCoords && (!fits(*texCoords) || !isUnnormalizedType(texCoords->type)))
+        return false;
+
+    return std::all_of(shaderAttributes.begin(),
+                       shaderAttributes.end(),
+                       [&fits](const ShaderAttribute& shaderAttribute)
+                       { return !shaderAttribute.name.empty() && fits(shaderAttribute.attribute); });
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t VertexLayout::getComponentSize(ComponentType type)
+{
+    switch (type)
+    {
+        case ComponentType::Float:
+            return 4;
+        case ComponentType::HalfFloat:
+        case ComponentType::Short:
+        case ComponentType::UnsignedShort:
+            return 2;
+        case ComponentType::UnsignedByte:
+            return 1;
+    }
+
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint16_t VertexLayout::toHalfFloat(float value)
+{
+    std::uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const std::uint32_t sign     = (bits >> 16) & 0x8000u;
+    const std::uint32_t exponent = (bits >> 23) & 0xFFu;
+    std::uint32_t       mantissa = bits & 0x7FFFFFu;
+
+    // Infinity and NaN, keep NaN quiet
+    if (exponent == 0xFF)
+        return static_cast<std::uint16_t>(sign | 0x7C00u | (mantissa ? 0x200u : 0u));
+
+    const int halfExponent = static_cast<int>(exponent) - 127 + 15;
+
+    // Too large to be represented
+    if (halfExponent >= 31)
+        return static_cast<std::uint16_t>(sign | 0x7C00u);
+
+    // Subnormal half, including values that round to zero
+    if (halfExponent <= 0)
+    {
+        if (halfExponent < -10)
+            return static_cast<std::uint16_t>(sign);
+
+        mantissa |= 0x800000u;
+
+        const auto          shift        = static_cast<unsigned int>(14 - halfExponent);
+        const std::uint32_t remainder    = mantissa & ((1u << shift) - 1u);
+        const std::uint32_t halfway      = 1u << (shift - 1u);
+        std::uint32_t       halfMantissa = mantissa >> shift;
+
+        // Round to nearest, ties to even
+        if ((remainder > halfway) || ((remainder == halfway) && (halfMantissa & 1u)))
+            ++halfMantissa;
+
+        return static_cast<std::uint16_t>(sign | halfMantissa);
+    }
+
+    std::uint32_t half = sign | (static_cast<std::uint32_t>(halfExponent) << 10) | (mantissa >> 13);
+
+    // Round to nearest, ties to even, a carry into the exponent correctly rounds up to infinity
+    const std::uint32_t remainder = mantissa & 0x1FFFu;
+    if ((remainder > 0x1000u) || ((remainder == 0x1000u) && (half & 1u)))
+        ++half;
+
+    return static_cast<std::uint16_t>(half);
+}
+
+} // namespace sf
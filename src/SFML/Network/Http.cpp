@@ -41,6 +41,191 @@
 
 #include <cctype>
 #include <cstddef>
+#include <cstdlib>
+
+
+namespace
+{
+// A "HttpImpl" namespace is required to avoid ambiguity in unity builds
+namespace HttpImpl
+{
+// Maximum number of idle connections kept alive by a HTTP client
+constexpr std::size_t maxIdleConnections = 8;
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> parseSize(const std::string& str, int base)
+{
+    const char* begin = str.c_str();
+    char*       end   = nullptr;
+    const auto  size  = std::strtoull(begin, &end, base);
+
+    if ((end == begin) || (str.find('-') != std::string::npos))
+        return std::nullopt;
+
+    return static_cast<std::size_t>(size);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::string> getHeaderField(const std::string& header, const std::string& field)
+{
+    // The header was converted to lower case, and starts with the status line
+    const std::string::size_type begin = header.find("\r\n" + field + ":");
+    if (begin == std::string::npos)
+        return std::nullopt;
+
+    const std::string::size_type valueBegin = begin + field.size() + 3;
+    return header.substr(valueBegin, header.find("\r\n", valueBegin) - valueBegin);
+}
+
+
+////////////////////////////////////////////////////////////
+/// Progress of the search for the end of a response, so that
+/// the received data is not parsed again after each receive
+///
+////////////////////////////////////////////////////////////
+struct ResponseFraming
+{
+    enum class Stage
+    {
+        Header,  //!< Looking for the end of the header
+        Length,  //!< The body has a known length
+        Chunks,  //!< Skipping the chunks of the body
+        Trailer, //!< Looking for the end of the trailer fields
+        Close    //!< The body ends with the connection
+    };
+
+    Stage       stage{Stage::Header}; //!< What is being looked for
+    std::size_t position{};           //!< Position in the received data where the search resumes
+    std::size_t end{};                //!< End of the response, when its body has a known length
+};
+
+
+////////////////////////////////////////////////////////////
+/// Parse the header of the first response contained in `data`,
+/// once it was received completely
+///
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> parseResponseHeader(const std::string& data, bool head, ResponseFraming& framing)
+{
+    // Only the bytes received since the last search can complete the end of the header
+    const std::string::size_type headerEnd = data.find("\r\n\r\n", framing.position);
+    if (headerEnd == std::string::npos)
+    {
+        framing.position = (data.size() > 3) ? data.size() - 3 : 0;
+        return std::nullopt;
+    }
+
+    const std::string header    = sf::toLower(data.substr(0, headerEnd + 2));
+    const std::size_t bodyBegin = headerEnd + 4;
+
+    // Extract the status code from the first line
+    std::istringstream in(header);
+    std::string        version;
+    int                status = 0;
+    if (!(in >> version >> status))
+        return bodyBegin;
+
+    // These responses never have a body
+    if (head || ((status >= 100) && (status < 200)) || (status == 204) || (status == 304))
+        return bodyBegin;
+
+    // Without any of the fields below, the body ends with the connection
+    framing.stage = ResponseFraming::Stage::Close;
+
+    if (const auto transferEncoding = getHeaderField(header, "transfer-encoding"))
+    {
+        // Other encodings than chunked are only delimited by the end of the connection
+        if (transferEncoding->find("chunked") != std::string::npos)
+        {
+            framing.stage    = ResponseFraming::Stage::Chunks;
+            framing.position = bodyBegin;
+        }
+    }
+    else if (const auto contentLength = getHeaderField(header, "content-length"))
+    {
+        const std::optional<std::size_t> bodySize = parseSize(*contentLength, 10);
+        if (bodySize && (*bodySize <= std::numeric_limits<std::size_t>::max() - bodyBegin))
+        {
+            framing.stage = ResponseFraming::Stage::Length;
+            framing.end   = bodyBegin + *bodySize;
+        }
+    }
+
+    return std::nullopt;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Get the size of the first response contained in `data`,
+/// if it was completely received and its size can be known
+/// without waiting for the connection to be closed
+///
+/// `framing` must be the same for all the calls made for a
+/// response, while more data is appended to `data`.
+///
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> getResponseSize(const std::string& data, bool head, ResponseFraming& framing)
+{
+    if (framing.stage == ResponseFraming::Stage::Header)
+    {
+        if (const std::optional<std::size_t> size = parseResponseHeader(data, head, framing))
+            return size;
+    }
+
+    // Skip the chunks, until the last one which has a size of 0
+    while (framing.stage == ResponseFraming::Stage::Chunks)
+    {
+        const std::string::size_type lineEnd = data.find("\r\n", framing.position);
+        if (lineEnd == std::string::npos)
+            return std::nullopt;
+
+        const std::string                sizeLine  = data.substr(framing.position, lineEnd - framing.position);
+        const std::optional<std::size_t> chunkSize = parseSize(sizeLine, 16);
+        if (!chunkSize)
+        {
+            framing.stage = ResponseFraming::Stage::Close;
+            return std::nullopt;
+        }
+
+        const std::size_t chunkBegin = lineEnd + 2;
+        if (*chunkSize == 0)
+        {
+            framing.stage    = ResponseFraming::Stage::Trailer;
+            framing.position = chunkBegin;
+            break;
+        }
+
+        // The chunk data is followed by a \r\n, wait until it's received to move to the next chunk
+        if ((*chunkSize > data.size() - chunkBegin) || (data.size() - chunkBegin - *chunkSize < 2))
+            return std::nullopt;
+
+        framing.position = chunkBegin + *chunkSize + 2;
+    }
+
+    switch (framing.stage)
+    {
+        case ResponseFraming::Stage::Length:
+            return (data.size() >= framing.end) ? std::optional(framing.end) : std::nullopt;
+        case ResponseFraming::Stage::Trailer:
+        {
+            // The trailer fields (if present) end with an empty line
+            if (data.compare(framing.position, 2, "\r\n") == 0)
+                return framing.position + 2;
+
+            const std::string::size_type trailerEnd = data.find("\r\n\r\n", framing.position);
+            if (trailerEnd == std::string::npos)
+                return std::nullopt;
+
+            return trailerEnd + 4;
+        }
+        default:
+            return std::nullopt;
+    }
+}
+} // namespace HttpImpl
+} // namespace
 
 
 namespace sf
@@ -329,6 +514,12 @@ bool Http::setHost(const std::string& host, unsigned short port, std::optional<I
     m_hosts       = Dns::resolve(m_hostName).value_or(decltype(m_hosts){});
     m_addressType = addressType;
 
+    // The idle connections were opened to the previous host
+    {
+        const std::lock_guard lock(m_mutex);
+        m_idleConnections.clear();
+    }
+
     return !m_hosts.empty();
 }
 
@@ -336,7 +527,101 @@ bool Http::setHost(const std::string& host, unsigned short port, std::optional<I
 ////////////////////////////////////////////////////////////
 Http::Response Http::sendRequest(const Http::Request& request, Time timeout, bool verifyServer) const
 {
-    // First make sure that the request is valid -- add missing mandatory fields
+    return sendRequests({request}, timeout, verifyServer).front();
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<Http::Response> Http::sendRequests(const std::vector<Request>& requests,
+                                              Time                        timeout,
+                                              bool                        verifyServer) const
+{
+    // First make sure that the requests are valid -- add missing mandatory fields
+    std::vector<Request> toSend;
+    toSend.reserve(requests.size());
+    for (const Request& request : requests)
+        toSend.push_back(completeRequest(request));
+
+    std::vector<Response> responses;
+    responses.reserve(requests.size());
+
+    // Only the requests that don't change anything on the server can be pipelined, and sent again when the
+    // connection fails before they are answered: the server may already have processed the other ones
+    const auto isIdempotent = [](const Request& request)
+    { return (request.m_method == Request::Method::Get) || (request.m_method == Request::Method::Head); };
+
+    // Index of the host address that new connections start with
+    std::size_t hostIndex = 0;
+
+    while (responses.size() < toSend.size())
+    {
+        // Reuse an idle connection if possible, otherwise connect to the host
+        auto       connection = takeIdleConnection(verifyServer);
+        const bool reused     = (connection != nullptr);
+        if (!reused)
+            connection = openConnection(timeout, verifyServer, hostIndex);
+
+        if (!connection)
+            break;
+
+        // Pipeline the idempotent requests that have not been answered yet, the other ones are sent alone
+        const std::size_t first      = responses.size();
+        const bool        idempotent = isIdempotent(toSend[first]);
+        std::size_t       last       = first + 1;
+        while (idempotent && (last < toSend.size()) && isIdempotent(toSend[last]))
+            ++last;
+
+        std::string requestStr;
+        for (std::size_t i = first; i < last; ++i)
+            requestStr += toSend[i].prepare();
+
+        const Socket::Status sendStatus = connection->socket.send(requestStr.c_str(), requestStr.size());
+        bool                 keepAlive  = (sendStatus == Socket::Status::Done);
+        std::string          receivedStr;
+
+        // Receive the responses in the order of the requests
+        while (keepAlive && (responses.size() < last))
+        {
+            Response response;
+            keepAlive = receiveResponse(*connection, receivedStr, toSend[responses.size()], response);
+
+            // Nothing was received, the request has to be sent again if that's safe
+            if ((response.m_status == Response::Status::ConnectionFailed) && idempotent)
+                break;
+
+            responses.push_back(std::move(response));
+        }
+
+        // A request that is not idempotent and got no response could not be sent: send it again if the
+        // connection was an idle one, which the server may have closed in the meantime, otherwise give up
+        if (!idempotent && (responses.size() == first))
+        {
+            if (reused)
+                continue;
+
+            responses.emplace_back();
+        }
+
+        // Keep the connection for the next requests, unless unexpected data is still pending
+        if (keepAlive && receivedStr.empty())
+            releaseConnection(std::move(connection));
+
+        // An idle connection may have been closed by the server in the meantime, and is simply
+        // replaced; when a new connection doesn't answer any request, try the next host address
+        if ((responses.size() == first) && !reused)
+            ++hostIndex;
+    }
+
+    // The requests that could not be sent are reported as failed
+    responses.resize(toSend.size());
+
+    return responses;
+}
+
+
+////////////////////////////////////////////////////////////
+Http::Request Http::completeRequest(const Request& request) const
+{
     Request toSend(request);
     if (!toSend.hasField("From"))
     {
@@ -360,86 +645,143 @@ Http::Response Http::sendRequest(const Http::Request& request, Time timeout, boo
     {
         toSend.setField("Content-Type", "application/x-www-form-urlencoded");
     }
-    if ((toSend.m_majorVersion * 10 + toSend.m_minorVersion >= 11) && !toSend.hasField("Connection"))
+    if ((toSend.m_majorVersion * 10 + toSend.m_minorVersion < 11) && !toSend.hasField("Connection"))
     {
-        toSend.setField("Connection", "close");
+        // Connections are persistent by default since HTTP 1.1 only
+        toSend.setField("Connection", "keep-alive");
     }
 
-    auto hosts = m_hosts;
+    return toSend;
+}
 
-    if (m_addressType == IpAddress::Type::IpV4)
-        hosts.erase(std::remove_if(hosts.begin(), hosts.end(), [](const auto& host) { return host.isV6(); }), hosts.end());
 
-    if (m_addressType == IpAddress::Type::IpV6)
-        hosts.erase(std::remove_if(hosts.begin(), hosts.end(), [](const auto& host) { return host.isV4(); }), hosts.end());
+////////////////////////////////////////////////////////////
+std::unique_ptr<Http::Connection> Http::takeIdleConnection(bool verifyServer) const
+{
+    const std::lock_guard lock(m_mutex);
+
+    // Start with the most recently used connections, which are the least likely to have been closed by the server
+    for (auto it = m_idleConnections.rbegin(); it != m_idleConnections.rend(); ++it)
+    {
+        // A connection that skipped the verification of the server can't serve requests that require it
+        if (!m_https || (*it)->verifyServer || !verifyServer)
+        {
+            auto connection = std::move(*it);
+            m_idleConnections.erase(std::next(it).base());
+            return connection;
+        }
+    }
+
+    return nullptr;
+}
 
-    // Prepare the response
-    Response received;
 
-    for (const auto& host : m_hosts)
+////////////////////////////////////////////////////////////
+std::unique_ptr<Http::Connection> Http::openConnection(Time timeout, bool verifyServer, std::size_t& hostIndex) const
+{
+    for (; hostIndex < m_hosts.size(); ++hostIndex)
     {
+        const IpAddress& host = m_hosts[hostIndex];
         if ((m_addressType.has_value()) && (host.getType() != m_addressType))
             continue;
 
-        TcpSocket connection;
+        auto connection = std::make_unique<Connection>();
+        connection->socket.setTlsSessionCache(&m_tlsSessionCache);
+        connection->verifyServer = m_https && verifyServer;
 
         // Connect the socket to the host
-        if (connection.connect(host, m_port, timeout) == Socket::Status::Done)
+        if (connection->socket.connect(host, m_port, timeout) != Socket::Status::Done)
+            continue;
+
+        if (m_https && (connection->socket.setupTlsClient(m_hostName, verifyServer) !=
+                        sf::TcpSocket::TlsStatus::HandshakeComplete))
+            continue;
+
+        return connection;
+    }
+
+    return nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+void Http::releaseConnection(std::unique_ptr<Connection> connection) const
+{
+    const std::lock_guard lock(m_mutex);
+
+    // Close the least recently used connection if there are too many of them
+    if (m_idleConnections.size() >= HttpImpl::maxIdleConnections)
+        m_idleConnections.erase(m_idleConnections.begin());
+
+    m_idleConnections.push_back(std::move(connection));
+}
+
+
+////////////////////////////////////////////////////////////
+bool Http::receiveResponse(Connection& connection, std::string& data, const Request& request, Response& response)
+{
+    const bool                head = (request.m_method == Request::Method::Head);
+    HttpImpl::ResponseFraming framing;
+    std::array<char, 16384>   buffer{};
+
+    while (true)
+    {
+        if (const std::optional<std::size_t> size = HttpImpl::getResponseSize(data, head, framing))
         {
-            if (m_https &&
-                (connection.setupTlsClient(m_hostName, verifyServer) != sf::TcpSocket::TlsStatus::HandshakeComplete))
+            // Build the Response object from the received data
+            response = Response();
+            response.parse(data.substr(0, *size));
+            data.erase(0, *size);
+            framing = {};
+
+            const auto status = static_cast<int>(response.m_status);
+
+            // Skip the interim responses (100 Continue, ...) that precede the final one
+            if ((status >= 100) && (status < 200) && (status != 101))
                 continue;
 
-            // Convert the request to string and send it through the connected socket
-            const std::string requestStr = toSend.prepare();
+            // A connection whose protocol was switched can't be used for HTTP anymore
+            if (status == 101)
+                return false;
 
-            if (!requestStr.empty())
+            // Persistent connections are the default since HTTP 1.1, and an option before
+            const std::string connectionField = toLower(response.getField("Connection"));
+            if (connectionField.find("close") != std::string::npos)
+                return false;
+
+            if (const auto it = request.m_fields.find("connection");
+                (it != request.m_fields.end()) && (toLower(it->second).find("close") != std::string::npos))
+                return false;
+
+            return (response.m_majorVersion * 10 + response.m_minorVersion >= 11) ||
+                   (connectionField.find("keep-alive") != std::string::npos);
+        }
+
+        // When the HTTPS connection makes use of TLS 1.3 new session ticket
+        // messages can be received by the client from the server at any time
+        // When these messages are received the receive function will return Socket::Status::Partial
+        // In this case We just continue to call receive until actual payload
+        // data is available, the connection is closed or an error occurs
+        std::size_t          received = 0;
+        const Socket::Status result   = connection.socket.receive(buffer.data(), buffer.size(), received);
+
+        if (result == Socket::Status::Done)
+        {
+            data.append(buffer.data(), buffer.data() + received);
+        }
+        else if (result != Socket::Status::Partial)
+        {
+            // The response ends with the connection if its size is unknown
+            if (!data.empty())
             {
-                // Send it through the socket
-                if (connection.send(requestStr.c_str(), requestStr.size()) == Socket::Status::Done)
-                {
-                    // Wait for the server's response
-                    std::string            receivedStr;
-                    std::size_t            size = 0;
-                    std::array<char, 1024> buffer{};
-
-                    // When the HTTPS connection makes use of TLS 1.3 new session ticket
-                    // messages can be received by the client from the server at any time
-                    // When these messages are received the receive function will return Socket::Status::Partial
-                    // In this case We just continue to call receive until actual payload
-                    // data is available, the connection is closed or an error occurs
-                    auto result = connection.receive(buffer.data(), buffer.size(), size);
-
-                    while ((result == Socket::Status::Done) || (result == Socket::Status::Partial))
-                    {
-                        // Only append payload data when it has been completely received
-                        if (result == Socket::Status::Done)
-                            receivedStr.append(buffer.data(), buffer.data() + size);
-
-                        result = connection.receive(buffer.data(), buffer.size(), size);
-                    }
-
-                    // Build the Response object from the received data
-                    received.parse(receivedStr);
-
-                    // If we received any data (even if it doesn't contain a HTTP 200 response)
-                    // we successfully found a host that we can connect to under the hostname
-                    // Stop attempting to connect to further addresses in this case
-                    if (!receivedStr.empty())
-                    {
-                        // Close the connection
-                        connection.disconnect();
-                        break;
-                    }
-                }
+                response = Response();
+                response.parse(data);
+                data.clear();
             }
 
-            // Close the connection
-            connection.disconnect();
+            return false;
         }
     }
-
-    return received;
 }
 
 } // namespace sf
@@ -0,0 +1,1332 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/IoContext.hpp>
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/SocketImpl.hpp>
+#include <SFML/Network/SocketSelector.hpp>
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Err.hpp>
+
+#if defined(SFML_SYSTEM_LINUX) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+// Waiting with a timeout requires IORING_FEAT_EXT_ARG (Linux 5.11)
+#if defined(IORING_FEAT_EXT_ARG)
+#define SFML_IO_CONTEXT_IO_URING
+#endif
+#endif
+
+#if defined(SFML_IO_CONTEXT_IO_URING)
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#include <csignal>
+#endif
+
+#include <algorithm>
+#include <limits>
+#include <list>
+#include <ostream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+
+#if defined(SFML_IO_CONTEXT_IO_URING)
+namespace
+{
+// A "IoUringImpl" namespace is required to avoid ambiguity in unity builds
+namespace IoUringImpl
+{
+////////////////////////////////////////////////////////////
+// Minimal io_uring instance: submission and completion
+// rings mapped in memory, driven by raw system calls
+////////////////////////////////////////////////////////////
+struct IoUring
+{
+    IoUring() = default;
+
+    IoUring(const IoUring&)            = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    ~IoUring()
+    {
+        if (sqes != MAP_FAILED)
+            munmap(sqes, sqesSize);
+        if (ring != MAP_FAILED)
+            munmap(ring, ringSize);
+        if (handle >= 0)
+            close(handle);
+    }
+
+    [[nodiscard]] bool setup(unsigned int entries)
+    {
+        io_uring_params params{};
+        handle = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        if (handle < 0)
+            return false;
+
+        if (!(params.features & IORING_FEAT_EXT_ARG) || !(params.features & IORING_FEAT_SINGLE_MMAP))
+            return false;
+
+        // Both rings share a single mapping
+        ringSize = std::max(params.sq_off.array + params.sq_entries * sizeof(unsigned int),
+                            params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+        ring = mmap(nullptr, ringSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, handle, IORING_OFF_SQ_RING);
+        if (ring == MAP_FAILED)
+            return false;
+
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        sqes     = mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, handle, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED)
+            return false;
+
+        auto* const bytes = static_cast<std::byte*>(ring);
+        sqHead            = reinterpret_cast<unsigned int*>(bytes + params.sq_off.head);
+        sqTail            = reinterpret_cast<unsigned int*>(bytes + params.sq_off.tail);
+        sqMask            = *reinterpret_cast<unsigned int*>(bytes + params.sq_off.ring_mask);
+        sqArray           = reinterpret_cast<unsigned int*>(bytes + params.sq_off.array);
+        sqEntries         = params.sq_entries;
+        cqHead            = reinterpret_cast<unsigned int*>(bytes + params.cq_off.head);
+        cqTail            = reinterpret_cast<unsigned int*>(bytes + params.cq_off.tail);
+        cqMask            = *reinterpret_cast<unsigned int*>(bytes + params.cq_off.ring_mask);
+        cqes              = reinterpret_cast<io_uring_cqe*>(bytes + params.cq_off.cqes);
+        localTail         = *sqTail;
+
+        return true;
+    }
+
+    // Get a blank submission queue entry, or a null pointer if the queue is full
+    [[nodiscard]] io_uring_sqe* getSqe()
+    {
+        if (localTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= sqEntries)
+            return nullptr;
+
+        const unsigned int index = localTail & sqMask;
+        auto* const        sqe   = static_cast<io_uring_sqe*>(sqes) + index;
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqArray[index] = index;
+        ++localTail;
+        ++unsubmitted;
+
+        return sqe;
+    }
+
+    // Submit the queued entries and optionally wait for completions; returns 0 or an errno value
+    int enter(unsigned int minComplete, sf::Time timeout)
+    {
+        if ((unsubmitted == 0) && (minComplete == 0))
+            return 0;
+
+        __atomic_store_n(sqTail, localTail, __ATOMIC_RELEASE);
+
+        unsigned int           flags = 0;
+        io_uring_getevents_arg arg{};
+        __kernel_timespec      time{};
+        if (minComplete > 0)
+        {
+            flags = IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+            if (timeout != sf::Time::Zero)
+            {
+                time.tv_sec  = timeout.asMicroseconds() / 1'000'000;
+                time.tv_nsec = (timeout.asMicroseconds() % 1'000'000) * 1'000;
+                arg.ts       = reinterpret_cast<std::uintptr_t>(&time);
+            }
+        }
+
+        const long result = syscall(__NR_io_uring_enter,
+                                    handle,
+                                    unsubmitted,
+                                    minComplete,
+                                    flags,
+                                    (minComplete > 0) ? &arg : nullptr,
+                                    (minComplete > 0) ? sizeof(arg) : 0);
+        if (result < 0)
+            return errno;
+
+        unsubmitted -= static_cast<unsigned int>(result);
+        return 0;
+    }
+
+    // Call a function for each available completion queue entry
+    template <typename F>
+    void reap(F&& function)
+    {
+        unsigned int       head = *cqHead;
+        const unsigned int tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+        while (head != tail)
+        {
+            const io_uring_cqe cqe = cqes[head & cqMask];
+            __atomic_store_n(cqHead, ++head, __ATOMIC_RELEASE);
+            function(cqe.user_data, cqe.res);
+        }
+    }
+
+    int           handle{-1};
+    void*         ring{MAP_FAILED};
+    std::size_t   ringSize{};
+    void*         sqes{MAP_FAILED};
+    std::size_t   sqesSize{};
+    unsigned int* sqHead{};
+    unsigned int* sqTail{};
+    unsigned int  sqMask{};
+    unsigned int* sqArray{};
+    unsigned int  sqEntries{};
+    unsigned int* cqHead{};
+    unsigned int* cqTail{};
+    unsigned int  cqMask{};
+    io_uring_cqe* cqes{};
+    unsigned int  localTail{};
+    unsigned int  unsubmitted{};
+};
+
+// Number of entries of the submission queue
+constexpr unsigned int queueSize = 256;
+
+// Convert an errno value to a socket status
+[[nodiscard]] sf::Socket::Status getStatus(int error)
+{
+    errno = error;
+    return sf::priv::SocketImpl::getErrorStatus();
+}
+} // namespace IoUringImpl
+} // namespace
+#endif
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct IoContext::IoContextImpl
+{
+    struct Operation
+    {
+        enum class Type
+        {
+            TcpReceive,
+            TcpSend,
+            TcpReceivePacket,
+            TcpSendPacket,
+            UdpReceive,
+            UdpSend,
+            Accept,
+            Connect
+        };
+
+        Type                                type{};              //!< Type of the operation
+        Socket*                             socket{};            //!< Socket the operation is performed on
+        TcpSocket*                          tcpSocket{};         //!< Socket accepted or connected by the operation
+        Packet*                             packet{};            //!< Packet sent or received by the operation
+        std::vector<std::byte>              buffer;              //!< Size and data of the packet
+        std::byte*                          data{};              //!< Buffer to send or to fill
+        std::size_t                         size{};              //!< Size of the buffer
+        std::size_t                         transferred{};       //!< Number of bytes sent or received so far
+        std::optional<IpAddress>            remoteAddress;       //!< Address of the peer of a UDP operation
+        unsigned short                      remotePort{};        //!< Port of the peer of a UDP operation
+        std::optional<Socket::Status>       result;              //!< Final status, set once the operation is completed
+        bool                                fresh{true};         //!< Was the operation not attempted yet? (readiness)
+        bool                                polling{};           //!< Is the operation polling its socket? (completion)
+        bool                                cancelled{};         //!< Was the operation cancelled? (completion)
+        std::optional<TimeoutWithPredicate> timeout;             //!< Timeout of the operation
+        Time                                deadline;            //!< Next check of the timeout predicate
+        TransferCallback                    transferCallback;    //!< Callback of send and receive operations
+        ReceiveFromCallback                 receiveFromCallback; //!< Callback of UDP receive operations
+        StatusCallback                      statusCallback;      //!< Callback of packet, accept and connect operations
+        sockaddr_in6                        address{};           //!< Address of the peer
+        priv::SocketImpl::AddrLength        addressSize{};       //!< Size of the address of the peer
+        std::list<Operation>::iterator      iterator;            //!< Position of the operation in its list
+#if defined(SFML_IO_CONTEXT_IO_URING)
+        msghdr message{}; //!< Message of UDP operations
+        iovec  vector{};  //!< Buffer of UDP operations
+#endif
+    };
+
+    // Socket registered in the selector of the readiness backend
+    struct Interest
+    {
+        std::size_t                   receiveCount{};
+        std::size_t                   sendCount{};
+        SocketSelector::ReadinessType ready{};
+    };
+
+    explicit IoContextImpl(Backend requestedBackend) : backend(Backend::Readiness)
+    {
+#if defined(SFML_IO_CONTEXT_IO_URING)
+        if ((requestedBackend != Backend::Readiness) && ring.setup(IoUringImpl::queueSize))
+            backend = Backend::Completion;
+#else
+        (void)requestedBackend;
+#endif
+    }
+
+    ~IoContextImpl()
+    {
+#if defined(SFML_IO_CONTEXT_IO_URING)
+        // The kernel writes into the pending operations until they are completed: cancel them and
+        // wait for their completion before they are freed, closing the ring would not wait for it
+        if (backend == Backend::Completion)
+            abandonAll();
+#endif
+    }
+
+    IoContextImpl(const IoContextImpl&)            = delete;
+    IoContextImpl& operator=(const IoContextImpl&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    // Operations common to both backends
+    ////////////////////////////////////////////////////////////
+    Operation& add(Operation::Type type, Socket& socket, const std::optional<TimeoutWithPredicate>& timeout)
+    {
+        Operation& operation = operations.emplace_back();
+        operation.type       = type;
+        operation.socket     = &socket;
+        operation.iterator   = std::prev(operations.end());
+
+        if (timeout)
+        {
+            operation.timeout  = timeout;
+            operation.deadline = clock.getElapsedTime() + timeout->getPeriod();
+            ++timeoutCount;
+        }
+
+        if (socket.isBlocking())
+            socket.setBlocking(false);
+
+        return operation;
+    }
+
+    void setAddress(Operation& operation, IpAddress address, unsigned short port)
+    {
+        if (address.isV4())
+        {
+            const sockaddr_in addressV4 = priv::SocketImpl::createAddress(address.toInteger(), port);
+            std::memcpy(&operation.address, &addressV4, sizeof(addressV4));
+            operation.addressSize = sizeof(addressV4);
+        }
+        else
+        {
+            operation.address     = priv::SocketImpl::createAddress(address.toBytes(), port);
+            operation.addressSize = sizeof(operation.address);
+        }
+    }
+
+    void finish(Operation& operation, Socket::Status status)
+    {
+        if ((backend == Backend::Readiness) && !operation.fresh)
+            unwatch(operation);
+
+        if (operation.timeout)
+            --timeoutCount;
+
+        operation.result = status;
+        completed.splice(completed.end(), operations, operation.iterator);
+    }
+
+    void start(Operation& operation)
+    {
+#if defined(SFML_IO_CONTEXT_IO_URING)
+        if (backend == Backend::Completion)
+            submit(operation);
+#else
+        (void)operation;
+#endif
+    }
+
+    void process(bool wait, Time timeout)
+    {
+        if (backend == Backend::Readiness)
+            processReadiness(wait, timeout);
+#if defined(SFML_IO_CONTEXT_IO_URING)
+        else
+            processCompletion(wait, timeout);
+#endif
+    }
+
+    std::size_t dispatch()
+    {
+        // New operations started by the callbacks go to the pending list
+        std::list<Operation> ready;
+        ready.swap(completed);
+
+        for (Operation& operation : ready)
+        {
+            switch (operation.type)
+            {
+                case Operation::Type::TcpReceive:
+                case Operation::Type::TcpSend:
+                case Operation::Type::UdpSend:
+                    if (operation.transferCallback)
+                        operation.transferCallback(*operation.result, operation.transferred);
+                    break;
+                case Operation::Type::UdpReceive:
+                    if (operation.receiveFromCallback)
+                        operation.receiveFromCallback(*operation.result,
+                                                      operation.transferred,
+                                                      operation.remoteAddress,
+                                                      operation.remotePort);
+                    break;
+                case Operation::Type::TcpReceivePacket:
+                case Operation::Type::TcpSendPacket:
+                case Operation::Type::Accept:
+                case Operation::Type::Connect:
+                    if (operation.statusCallback)
+                        operation.statusCallback(*operation.result);
+                    break;
+            }
+        }
+
+        return ready.size();
+    }
+
+    // Complete an operation that timed out
+    void abandon(Operation& operation)
+    {
+        // Keep the part of a packet received so far in its socket, like TcpSocket::receive(Packet&)
+        // does, so that the next packet receive operation resumes from it instead of losing the framing
+        if ((operation.type == Operation::Type::TcpReceivePacket) && (operation.transferred > 0))
+        {
+            TcpSocket::PendingPacket& pending = operation.tcpSocket->m_pendingPacket;
+            pending.sizeReceived              = std::min(operation.transferred, sizeof(pending.size));
+            std::memcpy(&pending.size, operation.buffer.data(), pending.sizeReceived);
+            pending.data.assign(operation.buffer.begin() + static_cast<std::ptrdiff_t>(pending.sizeReceived),
+                                operation.buffer.begin() + static_cast<std::ptrdiff_t>(operation.transferred));
+        }
+
+        const bool sending = (operation.type == Operation::Type::TcpSend) ||
+                             (operation.type == Operation::Type::TcpSendPacket);
+        finish(operation, (sending && (operation.transferred > 0)) ? Socket::Status::Partial : Socket::Status::NotReady);
+    }
+
+    // Give up on the operations whose timeout predicate returns false
+    void checkTimeouts()
+    {
+        if (timeoutCount == 0)
+            return;
+
+        const Time now = clock.getElapsedTime();
+        for (auto it = operations.begin(); it != operations.end();)
+        {
+            Operation& operation = *it++;
+            if (!operation.timeout || operation.cancelled || (operation.deadline > now))
+                continue;
+
+            if (operation.timeout->getPredicate()())
+            {
+                operation.deadline = now + operation.timeout->getPeriod();
+                continue;
+            }
+
+            if (backend == Backend::Readiness)
+                abandon(operation);
+#if defined(SFML_IO_CONTEXT_IO_URING)
+            else
+                cancel(operation);
+#endif
+        }
+    }
+
+    // Get the time to wait for, so that the timeouts are checked on time
+    [[nodiscard]] Time getWaitTime(Time timeout) const
+    {
+        if (timeoutCount == 0)
+            return timeout;
+
+        Time deadline = timeout;
+        for (const Operation& operation : operations)
+        {
+            if (operation.timeout && !operation.cancelled)
+            {
+                const Time remaining = std::max(operation.deadline - clock.getElapsedTime(), microseconds(1));
+                if ((deadline == Time::Zero) || (remaining < deadline))
+                    deadline = remaining;
+            }
+        }
+
+        return deadline;
+    }
+
+    // Account for bytes received by a packet operation, returns true if the packet is complete
+    [[nodiscard]] bool receivePacketData(Operation& operation, std::size_t received)
+    {
+        operation.transferred += received;
+        if (operation.transferred < operation.size)
+            return false;
+
+        // Once the size is known, receive the data of the packet
+        std::uint32_t packetSize = 0;
+        std::memcpy(&packetSize, operation.buffer.data(), sizeof(packetSize));
+        packetSize = ntohl(packetSize);
+
+        // Receive the data in chunks, the buffer grows with the data actually received
+        // (the announced size is not trusted)
+        const std::size_t dataReceived = operation.transferred - sizeof(std::uint32_t);
+        if (dataReceived < packetSize)
+        {
+            const std::size_t sizeToGet = std::min(packetSize - dataReceived, std::size_t{64 * 1024});
+            operation.buffer.resize(operation.transferred + sizeToGet);
+            operation.data = operation.buffer.data();
+            operation.size = operation.buffer.size();
+            return false;
+        }
+
+        operation.packet->onReceive(operation.buffer.data() + sizeof(std::uint32_t), dataReceived);
+        finish(operation, Socket::Status::Done);
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Readiness backend
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static SocketSelector::ReadinessType getReadiness(const Operation& operation)
+    {
+        switch (operation.type)
+        {
+            case Operation::Type::TcpSend:
+            case Operation::Type::TcpSendPacket:
+            case Operation::Type::UdpSend:
+            case Operation::Type::Connect:
+                return SocketSelector::Send;
+            default:
+                return SocketSelector::Receive;
+        }
+    }
+
+    [[nodiscard]] static SocketSelector::ReadinessType getReadiness(const Interest& interest)
+    {
+        SocketSelector::ReadinessType readiness{};
+        if (interest.receiveCount > 0)
+            readiness |= SocketSelector::Receive;
+        if (interest.sendCount > 0)
+            readiness |= SocketSelector::Send;
+        return readiness;
+    }
+
+    [[nodiscard]] static Socket::Status getConnectionStatus(const TcpSocket& socket)
+    {
+        // A socket whose connection failed has no remote peer
+        return socket.getRemoteAddress().has_value() ? Socket::Status::Done : Socket::Status::Error;
+    }
+
+    void updateSelector(const Socket& socket, Interest& interest, SocketSelector::ReadinessType previous)
+    {
+        const SocketSelector::ReadinessType readiness = getReadiness(interest);
+        if (readiness == previous)
+            return;
+
+        if (readiness == 0)
+        {
+            selector.remove(socket);
+            interests.erase(&socket);
+        }
+        else
+        {
+            const Socket* const target = &socket;
+            selector.add(socket,
+                         readiness,
+                         [this, target](SocketSelector::ReadinessType readinessType)
+                         {
+                             interests[target].ready = readinessType;
+                             readySockets.push_back(target);
+                         });
+        }
+    }
+
+    // Wait for the socket of an operation to become ready
+    void watch(Operation& operation)
+    {
+        Interest&                           interest = interests[operation.socket];
+        const SocketSelector::ReadinessType previous = getReadiness(interest);
+        ++(getReadiness(operation) == SocketSelector::Send ? interest.sendCount : interest.receiveCount);
+        updateSelector(*operation.socket, interest, previous);
+    }
+
+    void unwatch(Operation& operation)
+    {
+        const auto it = interests.find(operation.socket);
+        if (it == interests.end())
+            return;
+
+        Interest&                           interest = it->second;
+        const SocketSelector::ReadinessType previous = getReadiness(interest);
+        --(getReadiness(operation) == SocketSelector::Send ? interest.sendCount : interest.receiveCount);
+        updateSelector(*operation.socket, interest, previous);
+    }
+
+    // Try to perform an operation without blocking, returns false if it must wait for its socket
+    [[nodiscard]] bool attempt(Operation& operation)
+    {
+        switch (operation.type)
+        {
+            case Operation::Type::TcpReceive:
+            {
+                std::size_t          received = 0;
+                const Socket::Status status   = operation.tcpSocket->receive(operation.data, operation.size, received);
+                if (status == Socket::Status::NotReady)
+                    return false;
+
+                operation.transferred = received;
+                finish(operation, status);
+                return true;
+            }
+            case Operation::Type::TcpSend:
+            case Operation::Type::TcpSendPacket:
+            {
+                std::size_t          sent   = 0;
+                const Socket::Status status = operation.tcpSocket->send(operation.data + operation.transferred,
+                                                                        operation.size - operation.transferred,
+                                                                        sent);
+                operation.transferred += sent;
+                if ((status == Socket::Status::NotReady) || (status == Socket::Status::Partial))
+                    return false;
+
+                finish(operation, status);
+                return true;
+            }
+            case Operation::Type::TcpReceivePacket:
+            {
+                while (true)
+                {
+                    std::size_t          received = 0;
+                    const Socket::Status status   = operation.tcpSocket->receive(operation.data + operation.transferred,
+                                                                               operation.size - operation.transferred,
+                                                                               received);
+                    if (status == Socket::Status::NotReady)
+                        return false;
+
+                    if (status != Socket::Status::Done)
+                    {
+                        finish(operation, status);
+                        return true;
+                    }
+
+                    if (receivePacketData(operation, received))
+                        return true;
+                }
+            }
+            case Operation::Type::UdpReceive:
+            {
+                std::size_t          received = 0;
+                const Socket::Status status   = static_cast<UdpSocket*>(operation.socket)
+                                                  ->receive(operation.data,
+                                                            operation.size,
+                                                            received,
+                                                            operation.remoteAddress,
+                                                            operation.remotePort);
+                if (status == Socket::Status::NotReady)
+                    return false;
+
+                operation.transferred = received;
+                finish(operation, status);
+                return true;
+            }
+            case Operation::Type::UdpSend:
+            {
+                const Socket::Status status = static_cast<UdpSocket*>(operation.socket)
+                                                  ->send(operation.data,
+                                                         operation.size,
+                                                         *operation.remoteAddress,
+                                                         operation.remotePort);
+                if (status == Socket::Status::NotReady)
+                    return false;
+
+                if (status == Socket::Status::Done)
+                    operation.transferred = operation.size;
+                finish(operation, status);
+                return true;
+            }
+            case Operation::Type::Accept:
+            {
+                const Socket::Status status = static_cast<TcpListener*>(operation.socket)->accept(*operation.tcpSocket);
+                if (status == Socket::Status::NotReady)
+                    return false;
+
+                finish(operation, status);
+                return true;
+            }
+            case Operation::Type::Connect:
+            {
+                // The connection was started by asyncConnect, its socket is writable once it is established or failed
+                finish(operation, getConnectionStatus(*operation.tcpSocket));
+                return true;
+            }
+        }
+
+        return true;
+    }
+
+    void attemptAll(bool onlyReady)
+    {
+        for (auto it = operations.begin(); it != operations.end();)
+        {
+            Operation& operation = *it++;
+
+            if (operation.fresh)
+            {
+                if (!attempt(operation))
+                {
+                    operation.fresh = false;
+                    watch(operation);
+                }
+            }
+            else if (onlyReady)
+            {
+                const auto interest = interests.find(operation.socket);
+                if ((interest != interests.end()) && (interest->second.ready & getReadiness(operation)))
+                    (void)attempt(operation);
+            }
+        }
+    }
+
+    void processReadiness(bool wait, Time timeout)
+    {
+        attemptAll(false);
+        if (operations.empty())
+            return;
+
+        // Only check the sockets without blocking if some operations are already completed
+        if (!selector.wait((wait && completed.empty()) ? timeout : microseconds(1)))
+            return;
+
+        selector.dispatchReadyCallbacks();
+        attemptAll(true);
+
+        // Sockets without pending operations may have been removed in the meantime
+        for (const Socket* socket : readySockets)
+        {
+            const auto it = interests.find(socket);
+            if (it != interests.end())
+                it->second.ready = 0;
+        }
+        readySockets.clear();
+    }
+
+#if defined(SFML_IO_CONTEXT_IO_URING)
+    ////////////////////////////////////////////////////////////
+    // Completion backend
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] io_uring_sqe* getSqe(Operation& operation)
+    {
+        io_uring_sqe* sqe = ring.getSqe();
+        if (!sqe)
+        {
+            // The submission queue is full: flush it
+            (void)ring.enter(0, Time::Zero);
+            sqe = ring.getSqe();
+        }
+
+        if (!sqe)
+        {
+            err() << "Failed to submit a socket operation, the submission queue is full" << std::endl;
+            finish(operation, Socket::Status::Error);
+            return nullptr;
+        }
+
+        sqe->fd        = operation.socket->getNativeHandle();
+        sqe->user_data = reinterpret_cast<std::uintptr_t>(&operation);
+        return sqe;
+    }
+
+    void submit(Operation& operation)
+    {
+        // Don't continue an operation that timed out
+        if (operation.cancelled)
+        {
+            abandon(operation);
+            return;
+        }
+
+        io_uring_sqe* const sqe = getSqe(operation);
+        if (!sqe)
+            return;
+
+        constexpr std::size_t maxLength = std::numeric_limits<std::uint32_t>::max();
+
+        switch (operation.type)
+        {
+            case Operation::Type::TcpReceive:
+            case Operation::Type::TcpReceivePacket:
+            case Operation::Type::TcpSend:
+            case Operation::Type::TcpSendPacket:
+            {
+                const bool        sending   = (getReadiness(operation) == SocketSelector::Send);
+                const std::size_t remaining = operation.size - operation.transferred;
+
+                sqe->opcode    = sending ? IORING_OP_SEND : IORING_OP_RECV;
+                sqe->addr      = reinterpret_cast<std::uintptr_t>(operation.data + operation.transferred);
+                sqe->len       = static_cast<std::uint32_t>(std::min(remaining, maxLength));
+                sqe->msg_flags = sending ? MSG_NOSIGNAL : 0;
+                break;
+            }
+            case Operation::Type::UdpReceive:
+            case Operation::Type::UdpSend:
+                operation.vector.iov_base    = operation.data;
+                operation.vector.iov_len     = operation.size;
+                operation.message.msg_name   = &operation.address;
+                operation.message.msg_iov    = &operation.vector;
+                operation.message.msg_iovlen = 1;
+                if (operation.type == Operation::Type::UdpReceive)
+                {
+                    operation.message.msg_namelen = sizeof(operation.address);
+                    sqe->opcode                   = IORING_OP_RECVMSG;
+                }
+                else
+                {
+                    operation.message.msg_namelen = operation.addressSize;
+                    sqe->opcode                   = IORING_OP_SENDMSG;
+                    sqe->msg_flags                = MSG_NOSIGNAL;
+                }
+                sqe->addr = reinterpret_cast<std::uintptr_t>(&operation.message);
+                sqe->len  = 1;
+                break;
+            case Operation::Type::Accept:
+                operation.addressSize = sizeof(operation.address);
+                sqe->opcode           = IORING_OP_ACCEPT;
+                sqe->addr             = reinterpret_cast<std::uintptr_t>(&operation.address);
+                sqe->addr2            = reinterpret_cast<std::uintptr_t>(&operation.addressSize);
+                break;
+            case Operation::Type::Connect:
+                sqe->opcode = IORING_OP_CONNECT;
+                sqe->addr   = reinterpret_cast<std::uintptr_t>(&operation.address);
+                sqe->off    = operation.addressSize;
+                break;
+        }
+    }
+
+    // Wait until the socket of an operation is ready, for sockets that refuse to block
+    void submitPoll(Operation& operation)
+    {
+        if (operation.cancelled)
+        {
+            abandon(operation);
+            return;
+        }
+
+        io_uring_sqe* const sqe = getSqe(operation);
+        if (!sqe)
+            return;
+
+        std::uint32_t events = (getReadiness(operation) == SocketSelector::Send) ? POLLOUT : POLLIN;
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        events = (events << 16) | (events >> 16);
+#endif
+        sqe->opcode        = IORING_OP_POLL_ADD;
+        sqe->poll32_events = events;
+        operation.polling  = true;
+    }
+
+    void onCompletion(Operation& operation, int result)
+    {
+        if (operation.cancelled && (result == -ECANCELED))
+        {
+            abandon(operation);
+            return;
+        }
+
+        if (operation.polling)
+        {
+            operation.polling = false;
+            if (result < 0)
+                finish(operation, IoUringImpl::getStatus(-result));
+            else if (operation.type == Operation::Type::Connect)
+                finish(operation, getConnectionStatus(*operation.tcpSocket));
+            else
+                submit(operation);
+            return;
+        }
+
+        if ((result == -EAGAIN) || (result == -EINPROGRESS))
+        {
+            submitPoll(operation);
+            return;
+        }
+
+        if (result == -EINTR)
+        {
+            submit(operation);
+            return;
+        }
+
+        if (result < 0)
+        {
+            finish(operation, IoUringImpl::getStatus(-result));
+            return;
+        }
+
+        switch (operation.type)
+        {
+            case Operation::Type::TcpReceive:
+                operation.transferred = static_cast<std::size_t>(result);
+                finish(operation, (result == 0) ? Socket::Status::Disconnected : Socket::Status::Done);
+                break;
+            case Operation::Type::TcpSend:
+            case Operation::Type::TcpSendPacket:
+                operation.transferred += static_cast<std::size_t>(result);
+                if (operation.transferred < operation.size)
+                    submit(operation);
+                else
+                    finish(operation, Socket::Status::Done);
+                break;
+            case Operation::Type::TcpReceivePacket:
+                if (result == 0)
+                    finish(operation, Socket::Status::Disconnected);
+                else if (!receivePacketData(operation, static_cast<std::size_t>(result)))
+                    submit(operation);
+                break;
+            case Operation::Type::UdpReceive:
+                operation.transferred = static_cast<std::size_t>(result);
+                if (operation.address.sin6_family == AF_INET6)
+                {
+                    std::array<std::uint8_t, 16> bytes{};
+                    std::memcpy(bytes.data(), operation.address.sin6_addr.s6_addr, bytes.size());
+                    operation.remoteAddress = IpAddress(bytes);
+                    operation.remotePort    = ntohs(operation.address.sin6_port);
+                }
+                else
+                {
+                    sockaddr_in addressV4{};
+                    std::memcpy(&addressV4, &operation.address, sizeof(addressV4));
+                    operation.remoteAddress = IpAddress(ntohl(addressV4.sin_addr.s_addr));
+                    operation.remotePort    = ntohs(addressV4.sin_port);
+                }
+                finish(operation, Socket::Status::Done);
+                break;
+            case Operation::Type::UdpSend:
+                operation.transferred = static_cast<std::size_t>(result);
+                finish(operation, Socket::Status::Done);
+                break;
+            case Operation::Type::Accept:
+            {
+                Socket& socket = *operation.tcpSocket;
+                socket.close();
+                socket.create(result);
+                finish(operation, Socket::Status::Done);
+                break;
+            }
+            case Operation::Type::Connect:
+                finish(operation, Socket::Status::Done);
+                break;
+        }
+    }
+
+    // Ask the kernel to cancel an operation, which then completes with ECANCELED
+    void cancel(Operation& operation)
+    {
+        io_uring_sqe* sqe = ring.getSqe();
+        if (!sqe)
+        {
+            (void)ring.enter(0, Time::Zero);
+            sqe = ring.getSqe();
+        }
+
+        if (!sqe)
+            return;
+
+        sqe->opcode         = IORING_OP_ASYNC_CANCEL;
+        sqe->fd             = -1;
+        sqe->addr           = reinterpret_cast<std::uintptr_t>(&operation);
+        sqe->user_data      = 0;
+        operation.cancelled = true;
+
+        // Submit right away, so that the cancellation can't target a later operation at the same address
+        (void)ring.enter(0, Time::Zero);
+    }
+
+    void processCompletion(bool wait, Time timeout)
+    {
+        if (operations.empty())
+            return;
+
+        const int error = ring.enter((wait && completed.empty()) ? 1 : 0, timeout);
+        if ((error != 0) && (error != ETIME) && (error != EINTR) && (error != EBUSY) && (error != EAGAIN))
+            err() << "Failed to wait for socket operations: " << std::strerror(error) << std::endl;
+
+        ring.reap(
+            [this](std::uint64_t userData, int result)
+            {
+                // Cancellation requests don't refer to any operation
+                if (userData != 0)
+                    onCompletion(*reinterpret_cast<Operation*>(static_cast<std::uintptr_t>(userData)), result);
+            });
+    }
+
+    // Cancel all the pending operations and wait until the kernel is done with them, without calling their callbacks
+    void abandonAll()
+    {
+        while (!operations.empty())
+        {
+            for (Operation& operation : operations)
+                cancel(operation);
+
+            const int error = ring.enter(1, seconds(1));
+            if ((error != 0) && (error != ETIME) && (error != EINTR) && (error != EBUSY) && (error != EAGAIN))
+            {
+                err() << "Failed to cancel pending socket operations: " << std::strerror(error) << std::endl;
+                break;
+            }
+
+            ring.reap(
+                [this](std::uint64_t userData, int result)
+                {
+                    if (userData == 0)
+                        return;
+
+                    // A connection accepted before the cancellation has no socket to be given to
+                    Operation& operation = *reinterpret_cast<Operation*>(static_cast<std::uintptr_t>(userData));
+                    if ((operation.type == Operation::Type::Accept) && !operation.polling && (result >= 0))
+                        ::close(result);
+
+                    operations.erase(operation.iterator);
+                });
+        }
+
+        // If the kernel can't be waited for, leak the operations rather than letting it write into freed memory
+        if (!operations.empty())
+            new std::list<Operation>(std::move(operations));
+    }
+
+    IoUringImpl::IoUring ring; //!< io_uring instance of the completion backend
+#endif
+
+    Backend                                     backend;        //!< Backend actually used
+    std::list<Operation>                        operations;     //!< Pending operations
+    std::list<Operation>                        completed;      //!< Operations whose callback is not called yet
+    SocketSelector                              selector;       //!< Selector of the readiness backend
+    std::unordered_map<const Socket*, Interest> interests;      //!< Sockets registered in the selector
+    std::vector<const Socket*>                  readySockets;   //!< Sockets reported as ready by the selector
+    Clock                                       clock;          //!< Clock measuring the timeouts of the operations
+    std::size_t                                 timeoutCount{}; //!< Number of pending operations with a timeout
+};
+
+
+////////////////////////////////////////////////////////////
+IoContext::IoContext(Backend backend) : m_impl(std::make_unique<IoContextImpl>(backend))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+IoContext::~IoContext() = default;
+
+
+////////////////////////////////////////////////////////////
+IoContext::IoContext(IoContext&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+IoContext& IoContext::operator=(IoContext&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+IoContext::Backend IoContext::getBackend() const
+{
+    return m_impl->backend;
+}
+
+
+////////////////////////////////////////////////////////////
+void IoContext::asyncReceive(TcpSocket&                                 socket,
+                             void*                                      data,
+                             std::size_t                                size,
+                             TransferCallback                           callback,
+                             const std::optional<TimeoutWithPredicate>& timeout)
+{
+    auto& operation            = m_impl->add(IoContextImpl::Operation::Type::TcpReceive, socket, timeout);
+    operation.tcpSocket        = &socket;
+    operation.data             = static_cast<std::byte*>(data);
+    operation.size             = size;
+    operation.transferCallback = std::move(callback);
+
+    if (!data)
+    {
+        err() << "Cannot receive data from the network (the destination buffer is invalid)" << std::endl;
+        m_impl->finish(operation, Socket::Status::Error);
+        return;
+    }
+
+    m_impl->start(operation);
+}
+
+
+////////////////////////////////////////////////////////////
+void IoContext::asyncSend(TcpSocket&                                 socket,
+                          const void*                                data,
+                          std::size_t                                size,
+                          TransferCallback                           callback,
+                          const std::optional<TimeoutWithPredicate>& timeout)
+{
+    auto& operation            = m_impl->add(IoContextImpl::Operation::Type::TcpSend, socket, timeout);
+    operation.tcpSocket        = &socket;
+    operation.data             = static_cast<std::byte*>(const_cast<void*>(data));
+    operation.size             = size;
+    operation.transferCallback = std::move(callback);
+
+    if (!data || (size == 0))
+    {
+        err() << "Cannot send data over the network (no data to send)" << std::endl;
+        m_impl->finish(operation, Socket::Status::Error);
+        return;
+    }
+
+    m_impl->start(operation);
+}
+
+
+////////////////////////////////////////////////////////////
+void IoContext::asyncReceive(TcpSocket&                                 socket,
+                             Packet&                                    packet,
+                             StatusCallback                             callback,
+                             const std::optional<TimeoutWithPredicate>& timeout)
+{
+    auto& operation          = m_impl->add(IoContextImpl::Operation::Type::TcpReceivePacket, socket, timeout);
+    operation.tcpSocket      = &socket;
+    operation.packet         = &packet;
+    operation.statusCallback = std::move(callback);
+
+    // First clear the variables to fill, then receive the size of the packet
+    packet.clear();
+    operation.buffer.resize(sizeof(std::uint32_t));
+    operation.data = operation.buffer.data();
+    operation.size = operation.buffer.size();
+
+    // Resume the packet whose reception was interrupted, if any
+    TcpSocket::PendingPacket& pending = socket.m_pendingPacket;
+    if (pending.sizeReceived > 0)
+    {
+        std::memcpy(operation.buffer.data(), &pending.size, sizeof(pending.size));
+        operation.buffer.insert(operation.buffer.end(), pending.data.begin(), pending.data.end());
+        operation.data        = operation.buffer.data();
+        operation.size        = operation.buffer.size();
+        operation.transferred = pending.sizeReceived + pending.data.size();
+        pending               = TcpSocket::PendingPacket();
+    }
+
+    if (!m_impl->receivePacketData(operation, 0))
+        m_impl->start(operation);
+}
+
+
+////////////////////////////////////////////////////////////
+void IoContext::asyncSend(TcpSocket&                                 socket,
+                          Packet&                                    packet,
+                          StatusCallback                             callback,
+                          const std::optional<TimeoutWithPredicate>& timeout)
+{
+    auto& operation          = m_impl->add(IoContextImpl::Operation::Type::TcpSendPacket, socket, timeout);
+    operation.tcpSocket      = &socket;
+    operation.packet         = &packet;
+    operation.statusCallback = std::move(callback);
+
+    // Get the data to send from the packet
+    std::size_t size = 0;
+    const void* data = packet.onSend(size);
+
+    // The size of the packet is sent first, so that the receiver knows where it ends in the stream
+    const std::uint32_t header = htonl(static_cast<std::uint32_t>(size));
+    operation.buffer.resize(sizeof(header) + size);
+    std::memcpy(operation.buffer.data(), &header, sizeof(header));
+    if (size > 0)
+        std::memcpy(operation.buffer.data() + sizeof(header), data, size);
+
+    operation.data = operation.buffer.data();
+    operation.size = operation.buffer.size();
+
+    m_impl->start(operation);
+}
+
+
+////////////////////////////////////////////////////////////
+void IoContext::asyncReceive(UdpSocket&                                 socket,
+                             void*                                      data,
+                             std::size_t                                size,
+                             ReceiveFromCallback                        callback,
+                             const std::optional<TimeoutWithPredicate>& timeout)
+{
+    auto& operation               = m_impl->add(IoContextImpl::Operation::Type::UdpReceive, socket, timeout);
+    operation.data                = static_cast<std::byte*>(data);
+    operation.size                = size;
+    operation.receiveFromCallback = std::move(callback);
+
+    if (!data)
+    {
+        err() << "Cannot receive data from the network (the destination buffer is invalid)" << std::endl;
+        m_impl->finish(operation, Socket::Status::Error);
+        return;
+    }
+
+    if (socket.getNativeHandle() == priv::SocketImpl::invalidSocket())
+    {
+        err() << "Cannot receive data from the network (the socket is not bound)" << std::endl;
+        m_impl->finish(operation, Socket::Status::Error);
+        return;
+    }
+
+    m_impl->start(operation);
+}
+
+
+////////////////////////////////////////////////////////////
+void IoContext::asyncSend(UdpSocket&                                 socket,
+                          const void*                                data,
+                          std::size_t                                size,
+                          IpAddress                                  remoteAddress,
+                          unsigned short                             remotePort,
+                          TransferCallback                           callback,
+                          const std::optional<TimeoutWithPredicate>& timeout)
+{
+    auto& operation            = m_impl->add(IoContextImpl::Operation::Type::UdpSend, socket, timeout);
+    operation.data             = static_cast<std::byte*>(const_cast<void*>(data));
+    operation.size             = size;
+    operation.remoteAddress    = remoteAddress;
+    operation.remotePort       = remotePort;
+    operation.transferCallback = std::move(callback);
+
+    if (size > UdpSocket::MaxDatagramSize)
+    {
+        err() << "Cannot send data over the network "
+              << "(the number of bytes to send is greater than sf::UdpSocket::MaxDatagramSize)" << std::endl;
+        m_impl->finish(operation, Socket::Status::Error);
+        return;
+    }
+
+    // Create the internal socket if it doesn't exist
+    Socket& base = socket;
+    base.create(remoteAddress.isV4() ? IpAddress::Type::IpV4 : IpAddress::Type::IpV6);
+    m_impl->setAddress(operation, remoteAddress, remotePort);
+
+    m_impl->start(operation);
+}
+
+
+////////////////////////////////////////////////////////////
+void IoContext::asyncAccept(TcpListener&                               listener,
+                            TcpSocket&                                 socket,
+                            StatusCallback                             callback,
+                            const std::optional<TimeoutWithPredicate>& timeout)
+{
+    auto& operation          = m_impl->add(IoContextImpl::Operation::Type::Accept, listener, timeout);
+    operation.tcpSocket      = &socket;
+    operation.statusCallback = std::move(callback);
+
+    // Make sure that we're listening
+    if (listener.getNativeHandle() == priv::SocketImpl::invalidSocket())
+    {
+        err() << "Failed to accept a new connection, the socket is not listening" << std::endl;
+        m_impl->finish(operation, Socket::Status::Error);
+        return;
+    }
+
+    m_impl->start(operation);
+}
+
+
+////////////////////////////////////////////////////////////
+void IoContext::asyncConnect(TcpSocket&                                 socket,
+                             IpAddress                                  remoteAddress,
+                             unsigned short                             remotePort,
+                             StatusCallback                             callback,
+                             const std::optional<TimeoutWithPredicate>& timeout)
+{
+    auto& operation          = m_impl->add(IoContextImpl::Operation::Type::Connect, socket, timeout);
+    operation.tcpSocket      = &socket;
+    operation.statusCallback = std::move(callback);
+
+    if (m_impl->backend == Backend::Readiness)
+    {
+        // Start connecting right away, the socket becomes writable once the connection is established
+        const Socket::Status status = socket.connect(remoteAddress, remotePort);
+        if (status != Socket::Status::NotReady)
+        {
+            m_impl->finish(operation, status);
+            return;
+        }
+
+        operation.fresh = false;
+        m_impl->watch(operation);
+        return;
+    }
+
+    // Disconnect the socket if it is already connected, and create a new one
+    socket.disconnect();
+    Socket& base = socket;
+    base.create(remoteAddress.isV4() ? IpAddress::Type::IpV4 : IpAddress::Type::IpV6);
+    m_impl->setAddress(operation, remoteAddress, remotePort);
+
+    m_impl->start(operation);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t IoContext::run(Time timeout)
+{
+    const Clock clock;
+
+    m_impl->process(true, m_impl->getWaitTime(timeout));
+    m_impl->checkTimeouts();
+    while (m_impl->completed.empty() && !m_impl->operations.empty())
+    {
+        // Some events didn't complete any operation (partial sends, sockets that weren't ready): wait again
+        Time remaining = Time::Zero;
+        if (timeout != Time::Zero)
+        {
+            remaining = timeout - clock.getElapsedTime();
+            if (remaining <= Time::Zero)
+                break;
+        }
+
+        m_impl->process(true, m_impl->getWaitTime(remaining));
+        m_impl->checkTimeouts();
+    }
+
+    return m_impl->dispatch();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t IoContext::poll()
+{
+    m_impl->process(false, Time::Zero);
+    m_impl->checkTimeouts();
+    return m_impl->dispatch();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t IoContext::getPendingCount() const
+{
+    return m_impl->operations.size() + m_impl->completed.size();
+}
+
+} // namespace sf
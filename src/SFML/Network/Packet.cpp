@@ -31,13 +31,86 @@
 #include <SFML/System/String.hpp>
 #include <SFML/System/Utils.hpp>
 
+#include <algorithm>
 #include <array>
+#include <limits>
+#include <string>
+#include <utility>
 
 #include <cassert>
+#include <cmath>
 #include <cstring>
 #include <cwchar>
 
 
+namespace
+{
+// A "PacketImpl" namespace is required to avoid ambiguity in unity builds
+namespace PacketImpl
+{
+// Reverse the bytes of an integer
+// (written so that compilers recognize the pattern and emit byte swap instructions)
+[[nodiscard]] constexpr std::uint16_t byteSwap(std::uint16_t value)
+{
+    return static_cast<std::uint16_t>((value >> 8) | (value << 8));
+}
+
+[[nodiscard]] constexpr std::uint32_t byteSwap(std::uint32_t value)
+{
+    return ((value >> 24) & 0x000000FFu) | ((value >> 8) & 0x0000FF00u) | ((value << 8) & 0x00FF0000u) |
+           ((value << 24) & 0xFF000000u);
+}
+
+[[nodiscard]] constexpr std::uint64_t byteSwap(std::uint64_t value)
+{
+    return (std::uint64_t{byteSwap(static_cast<std::uint32_t>(value))} << 32) |
+           byteSwap(static_cast<std::uint32_t>(value >> 32));
+}
+
+// Copy an array of unsigned integers, reversing the bytes of each element
+template <typename T>
+void copySwapped(std::byte* destination, const std::byte* source, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        T value{};
+        std::memcpy(&value, source + i * sizeof(T), sizeof(T));
+        value = byteSwap(value);
+        std::memcpy(destination + i * sizeof(T), &value, sizeof(T));
+    }
+}
+
+// Copy an array of elements of the given size, converting them between host and network byte order
+void copyToNetworkOrder(std::byte* destination, const std::byte* source, std::size_t count, std::size_t elementSize)
+{
+    // Nothing to swap if the host is big endian
+    static const bool isBigEndian = (htonl(1) == 1);
+    if (isBigEndian || (elementSize == 1))
+    {
+        std::memcpy(destination, source, count * elementSize);
+        return;
+    }
+
+    switch (elementSize)
+    {
+        case 2:
+            copySwapped<std::uint16_t>(destination, source, count);
+            break;
+        case 4:
+            copySwapped<std::uint32_t>(destination, source, count);
+            break;
+        case 8:
+            copySwapped<std::uint64_t>(destination, source, count);
+            break;
+        default:
+            assert(false && "Unsupported element size");
+            break;
+    }
+}
+} // namespace PacketImpl
+} // namespace
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -48,10 +121,28 @@ void Packet::append(const void* data, std::size_t sizeInBytes)
         const auto* begin = reinterpret_cast<const std::byte*>(data);
         const auto* end   = begin + sizeInBytes;
         m_data.insert(m_data.end(), begin, end);
+        m_writeBitPos = 0;
     }
 }
 
 
+////////////////////////////////////////////////////////////
+std::byte* Packet::allocate(std::size_t sizeInBytes)
+{
+    const std::size_t offset = m_data.size();
+    m_data.resize(offset + sizeInBytes);
+    m_writeBitPos = 0;
+    return m_data.data() + offset;
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::reserve(std::size_t sizeInBytes)
+{
+    m_data.reserve(sizeInBytes);
+}
+
+
 ////////////////////////////////////////////////////////////
 std::size_t Packet::getReadPosition() const
 {
@@ -63,8 +154,10 @@ std::size_t Packet::getReadPosition() const
 void Packet::clear()
 {
     m_data.clear();
-    m_readPos = 0;
-    m_isValid = true;
+    m_readPos     = 0;
+    m_writeBitPos = 0;
+    m_readBitPos  = 0;
+    m_isValid     = true;
 }
 
 
@@ -312,10 +405,13 @@ Packet& Packet::operator>>(wchar_t* data)
         for (std::uint32_t i = 0; i < length; ++i)
         {
             std::uint32_t character = 0;
-            *this >> character;
-            data[i] = static_cast<wchar_t>(character);
+            std::memcpy(&character, &m_data[m_readPos + i * sizeof(character)], sizeof(character));
+            data[i] = static_cast<wchar_t>(ntohl(character));
         }
         data[length] = L'\0';
+
+        // Update reading position
+        m_readPos += length * sizeof(std::uint32_t);
     }
 
     return *this;
@@ -333,12 +429,16 @@ Packet& Packet::operator>>(std::wstring& data)
     if ((length > 0) && checkSize(length * sizeof(std::uint32_t)))
     {
         // Then extract characters
+        data.resize(length);
         for (std::uint32_t i = 0; i < length; ++i)
         {
             std::uint32_t character = 0;
-            *this >> character;
-            data += static_cast<wchar_t>(character);
+            std::memcpy(&character, &m_data[m_readPos + i * sizeof(character)], sizeof(character));
+            data[i] = static_cast<wchar_t>(ntohl(character));
         }
+
+        // Update reading position
+        m_readPos += length * sizeof(std::uint32_t);
     }
 
     return *this;
@@ -355,13 +455,10 @@ Packet& Packet::operator>>(String& data)
     data.clear();
     if ((length > 0) && checkSize(length * sizeof(std::uint32_t)))
     {
-        // Then extract characters
-        for (std::uint32_t i = 0; i < length; ++i)
-        {
-            std::uint32_t character = 0;
-            *this >> character;
-            data += static_cast<char32_t>(character);
-        }
+        // Then extract all the characters at once
+        std::u32string characters(length, U'\0');
+        readElements(characters.data(), length, sizeof(char32_t), true);
+        data = std::move(characters);
     }
 
     return *this;
@@ -525,8 +622,12 @@ Packet& Packet::operator<<(const wchar_t* data)
     *this << length;
 
     // Then insert characters
-    for (const wchar_t* c = data; *c != L'\0'; ++c)
-        *this << static_cast<std::uint32_t>(*c);
+    std::byte* characters = allocate(length * sizeof(std::uint32_t));
+    for (std::uint32_t i = 0; i < length; ++i)
+    {
+        const std::uint32_t character = htonl(static_cast<std::uint32_t>(data[i]));
+        std::memcpy(characters + i * sizeof(character), &character, sizeof(character));
+    }
 
     return *this;
 }
@@ -542,8 +643,12 @@ Packet& Packet::operator<<(const std::wstring& data)
     // Then insert characters
     if (length > 0)
     {
-        for (const wchar_t c : data)
-            *this << static_cast<std::uint32_t>(c);
+        std::byte* characters = allocate(length * sizeof(std::uint32_t));
+        for (std::uint32_t i = 0; i < length; ++i)
+        {
+            const std::uint32_t character = htonl(static_cast<std::uint32_t>(data[i]));
+            std::memcpy(characters + i * sizeof(character), &character, sizeof(character));
+        }
     }
 
     return *this;
@@ -557,17 +662,448 @@ Packet& Packet::operator<<(const String& data)
     const auto length = static_cast<std::uint32_t>(data.getSize());
     *this << length;
 
-    // Then insert characters
+    // Then insert all the characters at once
     if (length > 0)
+        writeElements(data.getData(), length, sizeof(char32_t), true);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(std::int8_t* data, std::size_t count)
+{
+    readElements(data, count, sizeof(*data), true);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(std::uint8_t* data, std::size_t count)
+{
+    readElements(data, count, sizeof(*data), true);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(std::int16_t* data, std::size_t count)
+{
+    readElements(data, count, sizeof(*data), true);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(std::uint16_t* data, std::size_t count)
+{
+    readElements(data, count, sizeof(*data), true);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(std::int32_t* data, std::size_t count)
+{
+    readElements(data, count, sizeof(*data), true);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(std::uint32_t* data, std::size_t count)
+{
+    readElements(data, count, sizeof(*data), true);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(std::int64_t* data, std::size_t count)
+{
+    readElements(data, count, sizeof(*data), true);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(std::uint64_t* data, std::size_t count)
+{
+    readElements(data, count, sizeof(*data), true);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(float* data, std::size_t count)
+{
+    readElements(data, count, sizeof(*data), false);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readArray(double* data, std::size_t count)
+{
+    readElements(data, count, sizeof(*data), false);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const std::int8_t* data, std::size_t count)
+{
+    writeElements(data, count, sizeof(*data), true);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const std::uint8_t* data, std::size_t count)
+{
+    writeElements(data, count, sizeof(*data), true);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const std::int16_t* data, std::size_t count)
+{
+    writeElements(data, count, sizeof(*data), true);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const std::uint16_t* data, std::size_t count)
+{
+    writeElements(data, count, sizeof(*data), true);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const std::int32_t* data, std::size_t count)
+{
+    writeElements(data, count, sizeof(*data), true);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const std::uint32_t* data, std::size_t count)
+{
+    writeElements(data, count, sizeof(*data), true);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const std::int64_t* data, std::size_t count)
+{
+    writeElements(data, count, sizeof(*data), true);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const std::uint64_t* data, std::size_t count)
+{
+    writeElements(data, count, sizeof(*data), true);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const float* data, std::size_t count)
+{
+    writeElements(data, count, sizeof(*data), false);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeArray(const double* data, std::size_t count)
+{
+    writeElements(data, count, sizeof(*data), false);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readVarUint(std::uint64_t& data)
+{
+    std::uint64_t value = 0;
+    for (unsigned int shift = 0; checkSize(1); shift += 7)
+    {
+        const auto byte = static_cast<std::uint8_t>(m_data[m_readPos++]);
+
+        // The 10th byte can only hold the last bit of a 64-bit value
+        if ((shift == 63) && (byte > 1))
+        {
+            m_isValid = false;
+            break;
+        }
+
+        value |= std::uint64_t{byte & 0x7Fu} << shift;
+
+        if ((byte & 0x80) == 0)
+        {
+            data = value;
+            break;
+        }
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readVarInt(std::int64_t& data)
+{
+    std::uint64_t value = 0;
+    if (readVarUint(value))
+    {
+        // Undo the zig-zag encoding
+        data = static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeVarUint(std::uint64_t data)
+{
+    std::array<std::uint8_t, 10> bytes{};
+    std::size_t                  size = 0;
+
+    // Write 7 bits per byte, the highest bit tells whether more bytes follow
+    do
+    {
+        bytes[size] = static_cast<std::uint8_t>(data & 0x7F);
+        data >>= 7;
+        if (data != 0)
+            bytes[size] |= 0x80;
+        ++size;
+    } while (data != 0);
+
+    append(bytes.data(), size);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeVarInt(std::int64_t data)
+{
+    // Zig-zag encoding maps 0, -1, 1, -2, 2... to 0, 1, 2, 3, 4...
+    const auto value = (static_cast<std::uint64_t>(data) << 1) ^ static_cast<std::uint64_t>(data >> 63);
+    return writeVarUint(value);
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::readBits(std::uint32_t& data, unsigned int bitCount)
+{
+    assert(bitCount > 0 && bitCount <= 32 && "Packet::readBits() Bit count must be between 1 and 32");
+
+    // Check that enough bits are left, in the current byte and the following ones
+    const std::size_t bitsLeft = (m_readBitPos > 0 ? 8 - m_readBitPos : 0) + (m_data.size() - m_readPos) * 8;
+    m_isValid                  = m_isValid && (bitCount <= bitsLeft);
+    if (!m_isValid)
+        return *this;
+
+    std::uint32_t value = 0;
+    for (unsigned int bitsRead = 0; bitsRead < bitCount;)
+    {
+        // Start reading a new byte if the previous one was consumed
+        if (m_readBitPos == 0)
+            ++m_readPos;
+
+        const auto         byte  = static_cast<std::uint32_t>(m_data[m_readPos - 1]);
+        const unsigned int count = std::min(8 - m_readBitPos, bitCount - bitsRead);
+        value |= ((byte >> m_readBitPos) & ((1u << count) - 1)) << bitsRead;
+
+        bitsRead += count;
+        m_readBitPos = (m_readBitPos + count) % 8;
+    }
+
+    data = value;
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeBits(std::uint32_t data, unsigned int bitCount)
+{
+    assert(bitCount > 0 && bitCount <= 32 && "Packet::writeBits() Bit count must be between 1 and 32");
+
+    for (unsigned int bitsWritten = 0; bitsWritten < bitCount;)
     {
-        for (const unsigned int datum : data)
-            *this << datum;
+        // Start a new byte if the last one is full
+        if (m_writeBitPos == 0)
+            m_data.push_back(std::byte{0});
+
+        const unsigned int  count = std::min(8 - m_writeBitPos, bitCount - bitsWritten);
+        const std::uint32_t bits  = (data >> bitsWritten) & ((1u << count) - 1);
+        m_data.back() |= static_cast<std::byte>(bits << m_writeBitPos);
+
+        bitsWritten += count;
+        m_writeBitPos = (m_writeBitPos + count) % 8;
     }
 
     return *this;
 }
 
 
+////////////////////////////////////////////////////////////
+Packet& Packet::readQuantized(float& data, float min, float max, unsigned int bitCount)
+{
+    assert(min < max && "Packet::readQuantized() Range must not be empty");
+
+    std::uint32_t step = 0;
+    if (readBits(step, bitCount))
+    {
+        const auto stepCount = static_cast<double>((std::uint64_t{1} << bitCount) - 1);
+        const auto range     = static_cast<double>(max) - static_cast<double>(min);
+        data                 = static_cast<float>(static_cast<double>(min) + range * step / stepCount);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+Packet& Packet::writeQuantized(float data, float min, float max, unsigned int bitCount)
+{
+    assert(min < max && "Packet::writeQuantized() Range must not be empty");
+    assert(bitCount > 0 && bitCount <= 32 && "Packet::writeQuantized() Bit count must be between 1 and 32");
+
+    // Find the nearest step (NaN is clamped to the lowest value)
+    const auto   stepCount  = static_cast<double>((std::uint64_t{1} << bitCount) - 1);
+    const auto   range      = static_cast<double>(max) - static_cast<double>(min);
+    const double normalized = (static_cast<double>(data) - static_cast<double>(min)) / range;
+    const double step       = std::round(std::clamp(normalized, 0.0, 1.0) * stepCount);
+
+    return writeBits(static_cast<std::uint32_t>(std::isnan(step) ? 0.0 : step), bitCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::makeDelta(const Packet& baseline)
+{
+    // The delta is the size of the data, followed by pairs of runs:
+    // a number of bytes identical to the baseline, then a number of bytes
+    // that differ from it along with their new values
+    Packet delta;
+    delta.writeVarUint(m_data.size());
+
+    const std::size_t commonSize = std::min(m_data.size(), baseline.m_data.size());
+    std::size_t       position   = 0;
+    while (position < m_data.size())
+    {
+        const std::size_t unchangedBegin = position;
+        while ((position < commonSize) && (m_data[position] == baseline.m_data[position]))
+            ++position;
+
+        // Don't write the final run of unchanged bytes, the size is known
+        if (position == m_data.size())
+            break;
+
+        // A single unchanged byte costs as much as a new run, keep it in the changed run
+        const std::size_t changedBegin = position;
+        while ((position < m_data.size()) &&
+               ((position >= commonSize) || (m_data[position] != baseline.m_data[position]) ||
+                ((position + 1 < commonSize) && (m_data[position + 1] != baseline.m_data[position + 1]))))
+            ++position;
+
+        delta.writeVarUint(changedBegin - unchangedBegin);
+        delta.writeVarUint(position - changedBegin);
+        delta.append(m_data.data() + changedBegin, position - changedBegin);
+    }
+
+    m_data.swap(delta.m_data);
+    m_readPos     = 0;
+    m_writeBitPos = 0;
+    m_readBitPos  = 0;
+    m_isValid     = true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Packet::applyDelta(const Packet& baseline)
+{
+    // Read the delta from a copy, so that this packet is left unchanged on failure
+    Packet delta;
+    delta.m_data.swap(m_data);
+
+    std::uint64_t size = 0;
+    delta.readVarUint(size);
+
+    // Every byte comes either from the baseline or from the delta, reject larger sizes before allocating
+    if (size > baseline.m_data.size() + (delta.m_data.size() - delta.m_readPos))
+        delta.m_isValid = false;
+
+    std::vector<std::byte> data;
+    if (delta)
+    {
+        data.resize(static_cast<std::size_t>(size));
+
+        std::size_t position = 0;
+        while (delta && !delta.endOfPacket())
+        {
+            std::uint64_t unchangedCount = 0;
+            std::uint64_t changedCount   = 0;
+            if (!delta.readVarUint(unchangedCount).readVarUint(changedCount))
+                break;
+
+            // Unchanged bytes must exist in the baseline, changed bytes must exist in the delta
+            const std::size_t dataLeft     = data.size() - position;
+            const std::size_t baselineLeft = baseline.m_data.size() - std::min(position, baseline.m_data.size());
+            if ((unchangedCount > std::min(dataLeft, baselineLeft)) || (changedCount > dataLeft - unchangedCount) ||
+                !delta.checkSize(static_cast<std::size_t>(changedCount)))
+            {
+                delta.m_isValid = false;
+                break;
+            }
+
+            const auto unchangedSize = static_cast<std::size_t>(unchangedCount);
+            const auto changedSize   = static_cast<std::size_t>(changedCount);
+            if (unchangedSize > 0)
+                std::memcpy(data.data() + position, baseline.m_data.data() + position, unchangedSize);
+            position += unchangedSize;
+
+            if (changedSize > 0)
+                std::memcpy(data.data() + position, &delta.m_data[delta.m_readPos], changedSize);
+            position += changedSize;
+            delta.m_readPos += changedSize;
+        }
+
+        // The final run of unchanged bytes is implicit
+        if (delta && (position < data.size()))
+        {
+            if (data.size() - position <= baseline.m_data.size() - std::min(position, baseline.m_data.size()))
+                std::memcpy(data.data() + position, baseline.m_data.data() + position, data.size() - position);
+            else
+                delta.m_isValid = false;
+        }
+    }
+
+    if (!delta)
+    {
+        m_data.swap(delta.m_data);
+        return false;
+    }
+
+    m_data.swap(data);
+    m_readPos     = 0;
+    m_writeBitPos = 0;
+    m_readBitPos  = 0;
+    m_isValid     = true;
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Packet::checkSize(std::size_t size)
 {
@@ -575,10 +1111,57 @@ bool Packet::checkSize(std::size_t size)
     const bool overflowDetected = m_readPos + size < m_readPos;
     m_isValid                   = m_isValid && (m_readPos + size <= m_data.size()) && !overflowDetected;
 
+    // Bytes are read from the next byte boundary
+    m_readBitPos = 0;
+
     return m_isValid;
 }
 
 
+////////////////////////////////////////////////////////////
+void Packet::readElements(void* data, std::size_t count, std::size_t elementSize, bool swap)
+{
+    if (count == 0)
+        return;
+
+    assert(data && "Packet::readArray() Data must not be null");
+
+    // Determine if count is big enough to trigger an overflow
+    if (count > std::numeric_limits<std::size_t>::max() / elementSize)
+    {
+        m_isValid = false;
+        return;
+    }
+
+    const std::size_t size = count * elementSize;
+    if (checkSize(size))
+    {
+        if (swap)
+            PacketImpl::copyToNetworkOrder(static_cast<std::byte*>(data), &m_data[m_readPos], count, elementSize);
+        else
+            std::memcpy(data, &m_data[m_readPos], size);
+
+        m_readPos += size;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Packet::writeElements(const void* data, std::size_t count, std::size_t elementSize, bool swap)
+{
+    if (count == 0)
+        return;
+
+    assert(data && "Packet::writeArray() Data must not be null");
+
+    std::byte* destination = allocate(count * elementSize);
+    if (swap)
+        PacketImpl::copyToNetworkOrder(destination, static_cast<const std::byte*>(data), count, elementSize);
+    else
+        std::memcpy(destination, data, count * elementSize);
+}
+
+
 ////////////////////////////////////////////////////////////
 const void* Packet::onSend(std::size_t& size)
 {
@@ -47,12 +47,11 @@
 #include <sys/types.h>
 #include <unistd.h>
 
-#include <cstddef>
-
 #endif
 
 #include <array>
 
+#include <cstddef>
 #include <cstdint>
 
 
@@ -74,6 +73,28 @@ using AddrLength = socklen_t;
 using Size       = std::size_t;
 #endif
 
+////////////////////////////////////////////////////////////
+/// \brief Contiguous block of bytes to send
+///
+////////////////////////////////////////////////////////////
+struct Buffer
+{
+    const void* data{}; //!< Address of the first byte
+    std::size_t size{}; //!< Number of bytes
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Datagram sent or received along with others
+///
+////////////////////////////////////////////////////////////
+struct Message
+{
+    void*        data{};        //!< Bytes of the datagram
+    std::size_t  size{};        //!< Size of the datagram (or of the buffer, before receiving)
+    sockaddr_in6 address{};     //!< Address of the remote peer (large enough for any address family)
+    AddrLength   addressSize{}; //!< Size of the address of the remote peer
+};
+
 ////////////////////////////////////////////////////////////
 /// \brief Create an internal sockaddr_in address
 ///
@@ -121,6 +142,95 @@ void close(SocketHandle sock);
 ////////////////////////////////////////////////////////////
 void setBlocking(SocketHandle sock, bool block);
 
+////////////////////////////////////////////////////////////
+/// \brief Send several buffers in a single system call
+///
+/// The buffers are sent in order, as if they were a single
+/// contiguous block. Only a prefix of the buffers may be sent:
+/// the caller must check the returned number of bytes.
+///
+/// \param sock    Handle of the socket
+/// \param buffers Array of buffers to send
+/// \param count   Number of buffers in the array
+/// \param flags   Flags to pass to the system call
+///
+/// \return Number of bytes sent, or -1 on error
+///
+////////////////////////////////////////////////////////////
+std::int64_t sendBuffers(SocketHandle sock, const Buffer* buffers, std::size_t count, int flags);
+
+////////////////////////////////////////////////////////////
+/// \brief Send several datagrams with as few system calls as possible
+///
+/// Only the first datagrams may be sent: the caller must check
+/// the returned number of datagrams.
+///
+/// When \a segment is `true` and the system supports it,
+/// consecutive datagrams of the same size sent to the same
+/// address are handed to the system as a single buffer, which
+/// it splits into datagrams (UDP generic segmentation offload).
+///
+/// \param sock     Handle of the socket
+/// \param messages Array of datagrams to send
+/// \param count    Number of datagrams in the array
+/// \param segment  Use segmentation offload if possible
+///
+/// \return Number of datagrams sent, or -1 on error
+///
+////////////////////////////////////////////////////////////
+std::int64_t sendMessages(SocketHandle sock, const Message* messages, std::size_t count, bool segment);
+
+////////////////////////////////////////////////////////////
+/// \brief Receive several datagrams with as few system calls as possible
+///
+/// If \a wait is `true` and the socket is blocking, this function
+/// waits until a datagram is received. It then receives the
+/// following datagrams that are already available, without
+/// waiting for more.
+///
+/// The size and the address of each received datagram are
+/// updated in \a messages.
+///
+/// \param sock     Handle of the socket
+/// \param messages Array of datagrams to receive
+/// \param count    Number of datagrams in the array
+/// \param wait     Wait for the first datagram
+///
+/// \return Number of datagrams received, or -1 on error
+///
+////////////////////////////////////////////////////////////
+std::int64_t receiveMessages(SocketHandle sock, Message* messages, std::size_t count, bool wait);
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether UDP segmentation offload is supported by the system
+///
+/// \return `true` if `sendMessages` can use segmentation offload
+///
+////////////////////////////////////////////////////////////
+bool isSegmentationOffloadSupported();
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether load-balanced port reuse is supported by the system
+///
+/// \return `true` if `enablePortReuse` can succeed
+///
+////////////////////////////////////////////////////////////
+bool isPortReuseSupported();
+
+////////////////////////////////////////////////////////////
+/// \brief Allow several sockets to bind the same port
+///
+/// The system distributes the incoming connections between
+/// the sockets bound to the same port. This must be called
+/// before the socket is bound.
+///
+/// \param sock Socket handle
+///
+/// \return `true` on success, `false` on error or if not supported
+///
+////////////////////////////////////////////////////////////
+bool enablePortReuse(SocketHandle sock);
+
 ////////////////////////////////////////////////////////////
 /// Get the last socket error status
 ///
@@ -115,6 +115,13 @@ Socket::Status TcpListener::listen(unsigned short port, IpAddress address)
         }
     }
 
+    // Share the port with the other listeners that enabled port reuse
+    if (m_portReuse && !priv::SocketImpl::enablePortReuse(getNativeHandle()))
+    {
+        err() << "Failed to enable port reuse on port " << port << std::endl;
+        return Status::Error;
+    }
+
     // Bind the socket
     if (::bind(getNativeHandle(), sockaddrPtr, sockaddrSize) == -1)
     {
@@ -169,4 +176,12 @@ Socket::Status TcpListener::accept(TcpSocket& socket)
     return Status::Done;
 }
 
+
+////////////////////////////////////////////////////////////
+bool TcpListener::setPortReuse(bool enabled)
+{
+    m_portReuse = enabled && priv::SocketImpl::isPortReuseSupported();
+    return m_portReuse == enabled;
+}
+
 } // namespace sf
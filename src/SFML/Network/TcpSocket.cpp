@@ -30,6 +30,7 @@
 #include <SFML/Network/SocketImpl.hpp>
 #include <SFML/Network/SocketSelector.hpp>
 #include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/TlsSessionCacheImpl.hpp>
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/String.hpp>
@@ -56,9 +57,13 @@
 #include <algorithm>
 #include <array>
 #include <filesystem>
+#include <functional>
 #include <mutex>
 #include <optional>
 #include <ostream>
+#include <string>
+#include <typeinfo>
+#include <vector>
 
 #include <cassert>
 #include <cstring>
@@ -507,6 +512,42 @@ struct TcpSocket::Impl
             // Set up peer verification mode
             mbedtls_ssl_conf_authmode(&state.sslConfig, verifyPeer ? MBEDTLS_SSL_VERIFY_REQUIRED : MBEDTLS_SSL_VERIFY_NONE);
 
+            if (tlsSessionCache != nullptr)
+            {
+                if (isServer)
+                {
+                    // Issue session tickets so that clients can resume their sessions
+                    if (!tlsSessionCache->m_impl->configureTickets(state.sslConfig, state.tickets))
+                        err() << "TLS sessions will not be resumable" << std::endl;
+                }
+                else if (verifyPeer)
+                {
+                    // Sessions are stored per host name and port, and only once the server was verified:
+                    // resuming a session skips the verification of the server's certificate
+                    const auto utf8Hostname = hostname.toUtf8();
+                    state.sessionKey.assign(reinterpret_cast<const char*>(utf8Hostname.data()), utf8Hostname.size());
+                    state.sessionKey += ':' + std::to_string(socket.getRemotePort());
+                    state.sessionCache = tlsSessionCache;
+
+                    // Only full handshakes verify the server's certificate, this tells them apart from resumed ones
+                    mbedtls_ssl_conf_verify(
+                        &state.sslConfig,
+                        [](void* context, mbedtls_x509_crt*, int, std::uint32_t*)
+                        {
+                            static_cast<TlsState*>(context)->certificateVerified = true;
+                            return 0;
+                        },
+                        &state);
+
+#if defined(MBEDTLS_SSL_TLS1_3_SIGNAL_NEW_SESSION_TICKETS_ENABLED)
+                    // TLS 1.3 tickets are only passed to the application on request
+                    mbedtls_ssl_conf_tls13_enable_signal_new_session_tickets(
+                        &state.sslConfig,
+                        MBEDTLS_SSL_TLS1_3_SIGNAL_NEW_SESSION_TICKETS_ENABLED);
+#endif
+                }
+            }
+
             // Set the CA chain to use for verification
             // Set our own certificate if we are a server
             if (isServer)
@@ -546,6 +587,13 @@ struct TcpSocket::Impl
                     tlsState.reset();
                     return TlsStatus::Error;
                 }
+
+                // Offer the session previously established with this server to skip the full handshake
+                if (state.sessionCache != nullptr)
+                {
+                    const auto& cache    = *state.sessionCache->m_impl;
+                    state.sessionOffered = cache.resumeSession(state.sessionKey, state.sslContext);
+                }
             }
 
             // Set up how the TLS implementation communicates with the underlying socket
@@ -605,7 +653,10 @@ struct TcpSocket::Impl
 
 #if defined(MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET)
                 if (result == MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET)
+                {
+                    state.storeSession();
                     return TlsStatus::HandshakeStarted;
+                }
 #endif
 
                 // Output the reason for verification failure
@@ -674,11 +725,100 @@ struct TcpSocket::Impl
             }
 
             state.handshakeComplete = true;
+            state.sessionResumed    = state.tickets.accepted || (state.sessionOffered && !state.certificateVerified);
+
+            // TLS 1.3 sessions can only be stored once the server sent a ticket, after the handshake
+#if defined(MBEDTLS_SSL_PROTO_TLS1_3)
+            if (mbedtls_ssl_get_version_number(&state.sslContext) != MBEDTLS_SSL_VERSION_TLS1_3)
+#endif
+                state.storeSession();
         }
 
         return TlsStatus::HandshakeComplete;
     }
 
+    Socket::Status receive(TcpSocket& socket, void* data, std::size_t size, std::size_t& received)
+    {
+        auto sizeReceived = 0;
+
+        if (tlsState)
+        {
+            // Handle receiving over a TLS stream
+            assert(tlsState->handshakeComplete &&
+                   "TLS handshake must be complete before sending application data");
+
+            if (!tlsState->handshakeComplete)
+            {
+                err() << "TLS handshake must be complete before sending application data" << std::endl;
+                return Status::Error;
+            }
+
+            sizeReceived = mbedtls_ssl_read(&tlsState->sslContext, static_cast<unsigned char*>(data), size);
+
+#if defined(MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET)
+            // Keep the ticket sent by the server to resume the session later
+            if (sizeReceived == MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET)
+                tlsState->storeSession();
+#endif
+
+            switch (sizeReceived)
+            {
+                case MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY:
+                    [[fallthrough]];
+                case MBEDTLS_ERR_NET_CONN_RESET:
+                    received = 0;
+                    return Status::Disconnected;
+                case MBEDTLS_ERR_SSL_WANT_READ:
+                    [[fallthrough]];
+                case MBEDTLS_ERR_SSL_WANT_WRITE:
+                    [[fallthrough]];
+                case MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS:
+                    [[fallthrough]];
+#if defined(MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET)
+                case MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET:
+                    [[fallthrough]];
+#endif
+                case MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS:
+                    received = 0;
+                    return Status::Partial;
+                default:
+                    break;
+            }
+
+            // If any other error occurred or the TLS stream has no more data to provide, reset the TLS state
+            if (sizeReceived < 0)
+            {
+                tlsState.reset();
+                return Status::Error;
+            }
+
+            if (sizeReceived == 0)
+                tlsState.reset();
+        }
+        else
+        {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuseless-cast"
+            // Receive a chunk of bytes
+            sizeReceived = static_cast<int>(
+                recv(socket.getNativeHandle(), static_cast<char*>(data), static_cast<priv::SocketImpl::Size>(size), flags));
+#pragma GCC diagnostic pop
+        }
+
+        // Check the number of bytes received
+        if (sizeReceived > 0)
+        {
+            received = static_cast<std::size_t>(sizeReceived);
+            return Status::Done;
+        }
+        if (sizeReceived == 0)
+        {
+            return Status::Disconnected;
+        }
+
+        return priv::SocketImpl::getErrorStatus();
+    }
+
     struct TlsState
     {
         TlsState()
@@ -699,6 +839,13 @@ struct TcpSocket::Impl
             mbedtls_ssl_free(&sslContext);
         }
 
+        // Store the session established by a client, to resume it later
+        void storeSession()
+        {
+            if (sessionCache != nullptr)
+                sessionCache->m_impl->storeSession(sessionKey, sslContext);
+        }
+
         bool                handshakeComplete{};
         mbedtls_net_context netContext{-1};
         mbedtls_ssl_context sslContext{};
@@ -706,9 +853,26 @@ struct TcpSocket::Impl
         mbedtls_x509_crt    x509Crt{};
         mbedtls_x509_crl    x509Crl{};
         mbedtls_pk_context  privateKeyContext{};
+        TlsSessionCache*    sessionCache{}; // Cache storing the sessions of a client, if any
+        std::string         sessionKey;     // Host name and port the sessions of a client are stored for
+
+        TlsSessionCache::Impl::Tickets tickets;               // Session tickets issued and accepted by a server
+        bool                           sessionOffered{};      // Did the client offer a stored session?
+        bool                           certificateVerified{}; // Did the client verify the server's certificate?
+        bool                           sessionResumed{};      // Did the handshake resume a session?
     };
 
     std::optional<TlsState> tlsState;
+    TlsSessionCache*        tlsSessionCache{}; // Cache used by the next TLS setup
+
+    std::vector<std::uint32_t>            sendHeaders; // Sizes of the packets being sent, in network byte order
+    std::vector<priv::SocketImpl::Buffer> sendBuffers; // Parts of the packets that remain to be sent
+    std::vector<Packet*>                  sendOwners;  // Packet that each buffer belongs to
+
+    std::vector<std::byte> receiveBuffer;      // Bytes received ahead of the packets extracted from them
+    std::size_t            receiveBegin{};     // Position of the first byte of receiveBuffer not handed out yet
+    std::size_t            receiveEnd{};       // Position past the last byte received into receiveBuffer
+    std::size_t            packetBufferSize{}; // Size of receiveBuffer when packets are buffered, 0 otherwise
 };
 
 
@@ -961,8 +1125,10 @@ void TcpSocket::disconnect()
     // Close the socket
     close();
 
-    // Reset the pending packet data
-    m_pendingPacket = PendingPacket();
+    // Reset the pending packet data, and drop the bytes buffered ahead of it
+    m_pendingPacket      = PendingPacket();
+    m_impl->receiveBegin = 0;
+    m_impl->receiveEnd   = 0;
 }
 
 
@@ -1062,6 +1228,13 @@ TcpSocket::TlsStatus TcpSocket::setupTlsServer(std::string_view certificateChain
 }
 
 
+////////////////////////////////////////////////////////////
+void TcpSocket::setTlsSessionCache(TlsSessionCache* cache)
+{
+    m_impl->tlsSessionCache = cache;
+}
+
+
 ////////////////////////////////////////////////////////////
 std::optional<std::string> TcpSocket::getCurrentCiphersuiteName() const
 {
@@ -1075,6 +1248,13 @@ std::optional<std::string> TcpSocket::getCurrentCiphersuiteName() const
 }
 
 
+////////////////////////////////////////////////////////////
+bool TcpSocket::isTlsSessionResumed() const
+{
+    return m_impl->tlsState && m_impl->tlsState->handshakeComplete && m_impl->tlsState->sessionResumed;
+}
+
+
 ////////////////////////////////////////////////////////////
 Socket::Status TcpSocket::send(const void* data, std::size_t size)
 {
@@ -1186,133 +1366,155 @@ Socket::Status TcpSocket::receive(void* data, std::size_t size, std::size_t& rec
         return Status::Error;
     }
 
-    auto sizeReceived = 0;
+    // Hand out the bytes that were received ahead of the packets first
+    if (m_impl->receiveBegin < m_impl->receiveEnd)
+    {
+        received = std::min(size, m_impl->receiveEnd - m_impl->receiveBegin);
+        std::memcpy(data, m_impl->receiveBuffer.data() + m_impl->receiveBegin, received);
+        m_impl->receiveBegin += received;
+        return Status::Done;
+    }
 
-    if (m_impl->tlsState)
+    return m_impl->receive(*this, data, size, received);
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpSocket::send(Packet& packet)
+{
+    const std::array<Packet*, 1> packets{&packet};
+    return send(packets.data(), packets.size());
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status TcpSocket::send(Packet* const* packets, std::size_t count)
+{
+    // TCP is a stream protocol, it doesn't preserve messages boundaries.
+    // This means that we have to send the size of each packet first, so that
+    // the receiver knows the actual end of the packet in the data stream.
+
+    // The sizes and the data of the packets are gathered in a list of buffers
+    // which are handed to the system all at once, so that the data of the
+    // packets doesn't have to be copied into a single block first. This is
+    // also required to avoid partial sends of separate blocks, which could
+    // cause data corruption on the receiving end.
+
+#ifndef NDEBUG
+    // Each packet records how much of it was sent, a packet appearing twice would resume from the wrong position
+    std::vector<const Packet*> sortedPackets(packets, packets + count);
+    std::sort(sortedPackets.begin(), sortedPackets.end(), std::less<>());
+    assert(std::adjacent_find(sortedPackets.begin(), sortedPackets.end()) == sortedPackets.end() &&
+           "TcpSocket::send() The same packet cannot appear several times in the array");
+#endif
+
+    auto& headers = m_impl->sendHeaders;
+    auto& buffers = m_impl->sendBuffers;
+    auto& owners  = m_impl->sendOwners;
+    headers.resize(count);
+    buffers.clear();
+    owners.clear();
+
+    for (std::size_t i = 0; i < count; ++i)
     {
-        // Handle receiving over a TLS stream
-        assert(m_impl->tlsState->handshakeComplete && "TLS handshake must be complete before sending application data");
+        Packet& packet = *packets[i];
 
-        if (!m_impl->tlsState->handshakeComplete)
-        {
-            err() << "TLS handshake must be complete before sending application data" << std::endl;
-            return Status::Error;
-        }
+        // Get the data to send from the packet
+        std::size_t size = 0;
+        const auto* data = static_cast<const std::byte*>(packet.onSend(size));
 
-        sizeReceived = mbedtls_ssl_read(&m_impl->tlsState->sslContext, static_cast<unsigned char*>(data), size);
+        // Convert the packet size to network byte order
+        headers[i]                   = htonl(static_cast<std::uint32_t>(size));
+        const auto*       header     = reinterpret_cast<const std::byte*>(&headers[i]);
+        const std::size_t headerSize = sizeof(headers[i]);
 
-        switch (sizeReceived)
+        // Skip the bytes that were already sent by a previous partial send
+        const std::size_t sendPos = packet.m_sendPos;
+        if (sendPos < headerSize)
         {
-            case MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY:
-                [[fallthrough]];
-            case MBEDTLS_ERR_NET_CONN_RESET:
-                received = 0;
-                return Status::Disconnected;
-            case MBEDTLS_ERR_SSL_WANT_READ:
-                [[fallthrough]];
-            case MBEDTLS_ERR_SSL_WANT_WRITE:
-                [[fallthrough]];
-            case MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS:
-                [[fallthrough]];
-#if defined(MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET)
-            case MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET:
-                [[fallthrough]];
-#endif
-            case MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS:
-                received = 0;
-                return Status::Partial;
-            default:
-                break;
+            buffers.push_back({header + sendPos, headerSize - sendPos});
+            owners.push_back(&packet);
         }
 
-        // If any other error occurred or the TLS stream has no more data to provide, reset the TLS state
-        if (sizeReceived < 0)
+        if ((size > 0) && (sendPos < headerSize + size))
         {
-            m_impl->tlsState.reset();
-            return Status::Error;
+            const std::size_t offset = sendPos > headerSize ? sendPos - headerSize : 0;
+            buffers.push_back({data + offset, size - offset});
+            owners.push_back(&packet);
         }
-
-        if (sizeReceived == 0)
-            m_impl->tlsState.reset();
-    }
-    else
-    {
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wuseless-cast"
-        // Receive a chunk of bytes
-        sizeReceived = static_cast<int>(
-            recv(getNativeHandle(), static_cast<char*>(data), static_cast<priv::SocketImpl::Size>(size), flags));
-#pragma GCC diagnostic pop
     }
 
-    // Check the number of bytes received
-    if (sizeReceived > 0)
-    {
-        received = static_cast<std::size_t>(sizeReceived);
-        return Status::Done;
-    }
-    if (sizeReceived == 0)
+    // Record how much of each packet was sent, in order to resume from there after a partial send
+    std::size_t first   = 0;
+    const auto  advance = [&](std::size_t sent)
     {
-        return Status::Disconnected;
-    }
-
-    return priv::SocketImpl::getErrorStatus();
-}
-
+        while (sent > 0)
+        {
+            priv::SocketImpl::Buffer& buffer   = buffers[first];
+            const std::size_t         consumed = std::min(sent, buffer.size);
 
-////////////////////////////////////////////////////////////
-Socket::Status TcpSocket::send(Packet& packet)
-{
-    // TCP is a stream protocol, it doesn't preserve messages boundaries.
-    // This means that we have to send the packet size first, so that the
-    // receiver knows the actual end of the packet in the data stream.
+            owners[first]->m_sendPos += consumed;
+            buffer.data = static_cast<const std::byte*>(buffer.data) + consumed;
+            buffer.size -= consumed;
+            sent -= consumed;
 
-    // We allocate an extra memory block so that the size can be sent
-    // together with the data in a single call. This may seem inefficient,
-    // but it is actually required to avoid partial send, which could cause
-    // data corruption on the receiving end.
+            if (buffer.size == 0)
+                ++first;
+        }
+    };
 
-    // Get the data to send from the packet
-    std::size_t size = 0;
-    const void* data = packet.onSend(size);
+    Status status = Status::Done;
+    if (buffers.empty())
+    {
+        // Nothing left to send
+    }
+    else if (m_impl->tlsState)
+    {
+        // TLS records can't be gathered from several buffers, coalesce them
+        // so that a single record is produced instead of one per buffer
+        m_blockToSendBuffer.clear();
+        for (const priv::SocketImpl::Buffer& buffer : buffers)
+        {
+            const auto* begin = static_cast<const std::byte*>(buffer.data);
+            m_blockToSendBuffer.insert(m_blockToSendBuffer.end(), begin, begin + buffer.size);
+        }
 
-    // First convert the packet size to network byte order
-    std::uint32_t packetSize = htonl(static_cast<std::uint32_t>(size));
+        std::size_t sent = 0;
+        status           = send(m_blockToSendBuffer.data(), m_blockToSendBuffer.size(), sent);
+        advance(sent);
+    }
+    else
+    {
+        // Loop until every byte has been sent
+        bool anySent = false;
+        while (first < buffers.size())
+        {
+            const std::int64_t result = priv::SocketImpl::sendBuffers(getNativeHandle(),
+                                                                      buffers.data() + first,
+                                                                      buffers.size() - first,
+                                                                      flags);
 
-    // Allocate memory for the data block to send
-    m_blockToSendBuffer.resize(sizeof(packetSize) + size);
+            // Check for errors
+            if (result < 0)
+            {
+                status = priv::SocketImpl::getErrorStatus();
 
-// Copy the packet size and data into the block to send
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wnull-dereference" // False positive.
-    std::memcpy(m_blockToSendBuffer.data(), &packetSize, sizeof(packetSize));
-#pragma GCC diagnostic pop
-    if (size > 0)
-        std::memcpy(m_blockToSendBuffer.data() + sizeof(packetSize), data, size);
+                if ((status == Status::NotReady) && anySent)
+                    status = Status::Partial;
 
-// These warnings are ignored here for portability, as even on Windows the
-// signature of `send` might change depending on whether Win32 or MinGW is
-// being used.
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wuseless-cast"
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wsign-conversion"
-    // Send the data block
-    std::size_t  sent   = 0;
-    const Status status = send(m_blockToSendBuffer.data() + packet.m_sendPos,
-                               static_cast<priv::SocketImpl::Size>(m_blockToSendBuffer.size() - packet.m_sendPos),
-                               sent);
-#pragma GCC diagnostic pop
-#pragma GCC diagnostic pop
+                break;
+            }
 
-    // In the case of a partial send, record the location to resume from
-    if (status == Status::Partial)
-    {
-        packet.m_sendPos += sent;
+            advance(static_cast<std::size_t>(result));
+            anySent = anySent || (result > 0);
+        }
     }
-    else if (status == Status::Done)
+
+    // Once everything was sent, the packets can be sent again from the start
+    if (status == Status::Done)
     {
-        packet.m_sendPos = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            packets[i]->m_sendPos = 0;
     }
 
     return status;
@@ -1325,6 +1527,64 @@ Socket::Status TcpSocket::receive(Packet& packet)
     // First clear the variables to fill
     packet.clear();
 
+    // When packets are buffered, extract them from large chunks of received bytes
+    // (unless a packet too large for the buffer is already being received)
+    if ((m_impl->packetBufferSize > 0) && (m_pendingPacket.sizeReceived == 0))
+    {
+        std::vector<std::byte>& buffer = m_impl->receiveBuffer;
+        std::size_t&            begin  = m_impl->receiveBegin;
+        std::size_t&            end    = m_impl->receiveEnd;
+
+        while (true)
+        {
+            // Check whether a whole packet is available in the buffer
+            const std::size_t available = end - begin;
+            if (available >= sizeof(m_pendingPacket.size))
+            {
+                std::uint32_t packetSize = 0;
+                std::memcpy(&packetSize, buffer.data() + begin, sizeof(packetSize));
+                packetSize = ntohl(packetSize);
+
+                const std::size_t frameSize = sizeof(packetSize) + packetSize;
+                if (available >= frameSize)
+                {
+                    if (packetSize > 0)
+                        packet.onReceive(buffer.data() + begin + sizeof(packetSize), packetSize);
+
+                    begin += frameSize;
+                    return Status::Done;
+                }
+
+                // The packet can't fit in the buffer: receive the rest of it directly into the pending packet
+                if (frameSize > buffer.size())
+                {
+                    std::memcpy(&m_pendingPacket.size, buffer.data() + begin, sizeof(m_pendingPacket.size));
+                    m_pendingPacket.sizeReceived = sizeof(m_pendingPacket.size);
+                    m_pendingPacket.data.assign(buffer.begin() + static_cast<std::ptrdiff_t>(begin + sizeof(packetSize)),
+                                                buffer.begin() + static_cast<std::ptrdiff_t>(end));
+                    begin = end = 0;
+                    break;
+                }
+            }
+
+            // Move the beginning of the next packet to the front of the buffer, to make room for more bytes
+            if (begin > 0)
+            {
+                std::memmove(buffer.data(), buffer.data() + begin, available);
+                begin = 0;
+                end   = available;
+            }
+
+            // Receive as many bytes as the buffer can hold
+            std::size_t  received = 0;
+            const Status status   = m_impl->receive(*this, buffer.data() + end, buffer.size() - end, received);
+            end += received;
+
+            if (status != Status::Done)
+                return status;
+        }
+    }
+
     // We start by getting the size of the incoming packet
     std::uint32_t packetSize = 0;
     std::size_t   received   = 0;
@@ -1352,26 +1612,27 @@ Socket::Status TcpSocket::receive(Packet& packet)
     }
 
     // Loop until we receive all the packet data
-    std::array<char, 1024> buffer{};
     while (m_pendingPacket.data.size() < packetSize)
     {
-        // Receive a chunk of data
-        const std::size_t sizeToGet = std::min(packetSize - m_pendingPacket.data.size(), buffer.size());
-        const Status      status    = receive(buffer.data(), sizeToGet, received);
+        // Receive a chunk of data directly at the end of the pending packet
+        // (the storage grows with the data actually received, the announced size is not trusted)
+        const std::size_t offset    = m_pendingPacket.data.size();
+        const std::size_t sizeToGet = std::min(packetSize - offset, std::size_t{64 * 1024});
+        m_pendingPacket.data.resize(offset + sizeToGet);
+
+        const Status status = receive(m_pendingPacket.data.data() + offset, sizeToGet, received);
+        m_pendingPacket.data.resize(offset + received);
+
         if (status != Status::Done)
             return status;
-
-        // Append it into the packet
-        if (received > 0)
-        {
-            m_pendingPacket.data.resize(m_pendingPacket.data.size() + received);
-            std::byte* begin = m_pendingPacket.data.data() + m_pendingPacket.data.size() - received;
-            std::memcpy(begin, buffer.data(), received);
-        }
     }
 
-    // We have received all the packet data: we can copy it to the user packet
-    if (!m_pendingPacket.data.empty())
+    // We have received all the packet data: we can hand it over to the user packet.
+    // If the packet doesn't transform the received data, its storage is swapped
+    // with the pending packet's instead of being copied.
+    if (typeid(packet) == typeid(Packet))
+        packet.m_data.swap(m_pendingPacket.data);
+    else if (!m_pendingPacket.data.empty())
         packet.onReceive(m_pendingPacket.data.data(), m_pendingPacket.data.size());
 
     // Clear the pending packet data
@@ -1380,4 +1641,32 @@ Socket::Status TcpSocket::receive(Packet& packet)
     return Status::Done;
 }
 
+
+////////////////////////////////////////////////////////////
+void TcpSocket::setPacketBufferSize(std::size_t size)
+{
+    std::vector<std::byte>& buffer = m_impl->receiveBuffer;
+    std::size_t&            begin  = m_impl->receiveBegin;
+    std::size_t&            end    = m_impl->receiveEnd;
+
+    // Move the bytes that were not handed out yet to the front of the buffer
+    const std::size_t available = end - begin;
+    if (available > 0)
+        std::memmove(buffer.data(), buffer.data() + begin, available);
+    begin = 0;
+    end   = available;
+
+    // The buffer must at least hold the size of a packet, and must not lose the bytes it already holds
+    m_impl->packetBufferSize = (size > 0) ? std::max(size, sizeof(m_pendingPacket.size)) : 0;
+    buffer.resize(std::max(m_impl->packetBufferSize, available));
+    buffer.shrink_to_fit();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TcpSocket::getPacketBufferSize() const
+{
+    return m_impl->packetBufferSize;
+}
+
 } // namespace sf
@@ -0,0 +1,289 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/TlsSessionCacheImpl.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <mbedtls/error.h>
+
+#include <algorithm>
+#include <array>
+#include <ostream>
+
+
+namespace
+{
+// A "TlsSessionCacheImpl" namespace is required to avoid ambiguity in unity builds
+namespace TlsSessionCacheImpl
+{
+// Convert a ticket lifetime to seconds, TLS 1.3 doesn't allow tickets to be used for longer than 7 days
+std::uint32_t toSeconds(sf::Time lifetime)
+{
+    constexpr std::int64_t maxLifetime = 7 * 24 * 60 * 60;
+    return static_cast<std::uint32_t>(std::clamp(lifetime.asMicroseconds() / 1'000'000, std::int64_t{1}, maxLifetime));
+}
+
+std::string errorString(int errnum)
+{
+    std::array<char, 1024> buffer{};
+    mbedtls_strerror(errnum, buffer.data(), buffer.size());
+    return buffer.data();
+}
+} // namespace TlsSessionCacheImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TlsSessionCache::Impl::Impl(std::uint32_t lifetime) : ticketLifetime(lifetime)
+{
+#if defined(MBEDTLS_SSL_TICKET_C)
+    mbedtls_ssl_ticket_init(&ticketContext);
+#if (MBEDTLS_VERSION_MAJOR < 4)
+    mbedtls_entropy_init(&entropyContext);
+    mbedtls_ctr_drbg_init(&ctrDrbgContext);
+#endif
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+TlsSessionCache::Impl::~Impl()
+{
+#if defined(MBEDTLS_SSL_TICKET_C)
+    mbedtls_ssl_ticket_free(&ticketContext);
+#if (MBEDTLS_VERSION_MAJOR < 4)
+    mbedtls_ctr_drbg_free(&ctrDrbgContext);
+    mbedtls_entropy_free(&entropyContext);
+#endif
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void TlsSessionCache::Impl::storeSession(const std::string& key, const mbedtls_ssl_context& sslContext)
+{
+    mbedtls_ssl_session session;
+    mbedtls_ssl_session_init(&session);
+
+    // Serialize the session, querying the required size first
+    std::vector<unsigned char> data;
+    std::size_t                size = 0;
+    if ((mbedtls_ssl_get_session(&sslContext, &session) == 0) &&
+        (mbedtls_ssl_session_save(&session, nullptr, 0, &size) == MBEDTLS_ERR_SSL_BUFFER_TOO_SMALL))
+    {
+        data.resize(size);
+        if (mbedtls_ssl_session_save(&session, data.data(), data.size(), &size) != 0)
+            data.clear();
+    }
+
+    mbedtls_ssl_session_free(&session);
+
+    if (data.empty())
+        return;
+
+    const std::lock_guard lock(mutex);
+    sessions[key] = std::move(data);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TlsSessionCache::Impl::resumeSession(const std::string& key, mbedtls_ssl_context& sslContext) const
+{
+    std::vector<unsigned char> data;
+
+    {
+        const std::lock_guard lock(mutex);
+        const auto            it = sessions.find(key);
+        if (it == sessions.end())
+            return false;
+
+        data = it->second;
+    }
+
+    mbedtls_ssl_session session;
+    mbedtls_ssl_session_init(&session);
+
+    // If the session can't be restored, a full handshake is performed
+    const bool resumed = (mbedtls_ssl_session_load(&session, data.data(), data.size()) == 0) &&
+                         (mbedtls_ssl_set_session(&sslContext, &session) == 0);
+
+    mbedtls_ssl_session_free(&session);
+    return resumed;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TlsSessionCache::Impl::configureTickets([[maybe_unused]] mbedtls_ssl_config& sslConfig,
+                                             [[maybe_unused]] Tickets&            tickets)
+{
+#if defined(MBEDTLS_SSL_TICKET_C) && defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_SRV_C)
+    const std::lock_guard lock(mutex);
+    if (!setupTickets())
+        return false;
+
+    // The tickets are protected by the keys of the cache, the connection remembers whether the client's was valid
+    tickets.cache = this;
+    mbedtls_ssl_conf_session_tickets_cb(
+        &sslConfig,
+        [](void*                      parameter,
+           const mbedtls_ssl_session* session,
+           unsigned char*             start,
+           const unsigned char*       end,
+           std::size_t*               length,
+           std::uint32_t*             lifetime)
+        {
+            auto& context = static_cast<Tickets*>(parameter)->cache->ticketContext;
+            return mbedtls_ssl_ticket_write(&context, session, start, end, length, lifetime);
+        },
+        [](void* parameter, mbedtls_ssl_session* session, unsigned char* buffer, std::size_t length)
+        {
+            auto&     connection = *static_cast<Tickets*>(parameter);
+            const int result     = mbedtls_ssl_ticket_parse(&connection.cache->ticketContext, session, buffer, length);
+            connection.accepted  = (result == 0);
+            return result;
+        },
+        &tickets);
+    return true;
+#else
+    err() << "TLS session tickets are not supported by this build of Mbed TLS" << std::endl;
+    return false;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+bool TlsSessionCache::Impl::setupTickets()
+{
+    if (ticketsReady.has_value())
+        return *ticketsReady;
+
+    ticketsReady = false;
+
+#if defined(MBEDTLS_SSL_TICKET_C)
+#if (MBEDTLS_VERSION_MAJOR < 4)
+    if (const int result = mbedtls_ctr_drbg_seed(&ctrDrbgContext, mbedtls_entropy_func, &entropyContext, nullptr, 0);
+        result != 0)
+    {
+        err() << "Failed to seed TLS session ticket DRBG: " << TlsSessionCacheImpl::errorString(result) << std::endl;
+        return false;
+    }
+
+    const int result = mbedtls_ssl_ticket_setup(&ticketContext,
+                                                mbedtls_ctr_drbg_random,
+                                                &ctrDrbgContext,
+                                                MBEDTLS_CIPHER_AES_256_GCM,
+                                                ticketLifetime);
+#else
+    const int result = mbedtls_ssl_ticket_setup(&ticketContext, PSA_ALG_GCM, PSA_KEY_TYPE_AES, 256, ticketLifetime);
+#endif
+
+    if (result != 0)
+    {
+        err() << "Failed to set up TLS session tickets: " << TlsSessionCacheImpl::errorString(result) << std::endl;
+        return false;
+    }
+
+    ticketsReady = true;
+#endif
+
+    return *ticketsReady;
+}
+
+
+////////////////////////////////////////////////////////////
+TlsSessionCache::TlsSessionCache(Time ticketLifetime) :
+m_impl(std::make_unique<Impl>(TlsSessionCacheImpl::toSeconds(ticketLifetime)))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TlsSessionCache::~TlsSessionCache() = default;
+
+
+////////////////////////////////////////////////////////////
+TlsSessionCache::TlsSessionCache(TlsSessionCache&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+TlsSessionCache& TlsSessionCache::operator=(TlsSessionCache&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+bool TlsSessionCache::setTicketKey([[maybe_unused]] std::uint32_t                      keyId,
+                                   [[maybe_unused]] const std::array<std::byte, 32>& key)
+{
+#if defined(MBEDTLS_SSL_TICKET_C) && (MBEDTLS_VERSION_NUMBER >= 0x03010000)
+    const std::lock_guard lock(m_impl->mutex);
+    if (!m_impl->setupTickets())
+        return false;
+
+    // The identifier is the name of the key, sent in front of each ticket
+    const std::array<unsigned char, 4> name{static_cast<unsigned char>(keyId >> 24),
+                                            static_cast<unsigned char>(keyId >> 16),
+                                            static_cast<unsigned char>(keyId >> 8),
+                                            static_cast<unsigned char>(keyId)};
+
+    if (const int result = mbedtls_ssl_ticket_rotate(&m_impl->ticketContext,
+                                                     name.data(),
+                                                     name.size(),
+                                                     reinterpret_cast<const unsigned char*>(key.data()),
+                                                     key.size(),
+                                                     m_impl->ticketLifetime);
+        result != 0)
+    {
+        err() << "Failed to set TLS session ticket key: " << TlsSessionCacheImpl::errorString(result) << std::endl;
+        return false;
+    }
+
+    return true;
+#else
+    err() << "Setting the TLS session ticket key is not supported by this version of Mbed TLS" << std::endl;
+    return false;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void TlsSessionCache::clear()
+{
+    const std::lock_guard lock(m_impl->mutex);
+    m_impl->sessions.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TlsSessionCache::getSize() const
+{
+    const std::lock_guard lock(m_impl->mutex);
+    return m_impl->sessions.size();
+}
+
+} // namespace sf
@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/TlsSessionCache.hpp>
+
+#include <mbedtls/version.h>
+#if (MBEDTLS_VERSION_MAJOR < 4)
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/entropy.h>
+#endif
+#include <mbedtls/ssl.h>
+#if defined(MBEDTLS_SSL_TICKET_C)
+#include <mbedtls/ssl_ticket.h>
+#endif
+
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Implementation of `sf::TlsSessionCache`, shared
+///        with `sf::TcpSocket`
+///
+////////////////////////////////////////////////////////////
+struct TlsSessionCache::Impl
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Session tickets of a server's connection
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Tickets
+    {
+        Impl* cache{};    //!< Cache holding the keys protecting the tickets
+        bool  accepted{}; //!< Did the client present a valid ticket?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor
+    ///
+    /// \param lifetime Lifetime of the session tickets, in seconds
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit Impl(std::uint32_t lifetime);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~Impl();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    Impl(const Impl&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    Impl& operator=(const Impl&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store the session established by a client
+    ///
+    /// \param key        Host name and port the client connected to
+    /// \param sslContext Context of the client's connection
+    ///
+    ////////////////////////////////////////////////////////////
+    void storeSession(const std::string& key, const mbedtls_ssl_context& sslContext);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Offer the session stored for a server to it
+    ///
+    /// Must be called before the client starts the handshake.
+    ///
+    /// \param key        Host name and port the client connects to
+    /// \param sslContext Context of the client's connection
+    ///
+    /// \return `true` if a session was offered
+    ///
+    ////////////////////////////////////////////////////////////
+    bool resumeSession(const std::string& key, mbedtls_ssl_context& sslContext) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Let a server issue and verify session tickets
+    ///
+    /// \a tickets must stay alive as long as \a sslConfig is
+    /// used, it records whether the client presented a valid
+    /// ticket.
+    ///
+    /// \param sslConfig Configuration of the server's connection
+    /// \param tickets   Session tickets of the server's connection
+    ///
+    /// \return `true` on success, `false` on error or if not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool configureTickets(mbedtls_ssl_config& sslConfig, Tickets& tickets);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set up the ticket context if it isn't already
+    ///
+    /// The mutex must be locked by the caller.
+    ///
+    /// \return `true` if the ticket context is ready to be used
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setupTickets();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    using SessionMap = std::unordered_map<std::string, std::vector<unsigned char>>;
+
+    mutable std::mutex  mutex;          //!< Protects the sessions and the ticket setup
+    SessionMap          sessions;       //!< Serialized client sessions, by host name and port
+    std::uint32_t       ticketLifetime; //!< Lifetime of the tickets, in seconds
+    std::optional<bool> ticketsReady;   //!< Result of the ticket setup, if it was attempted
+#if defined(MBEDTLS_SSL_TICKET_C)
+    mbedtls_ssl_ticket_context ticketContext{}; //!< Keys protecting the tickets issued by servers
+#if (MBEDTLS_VERSION_MAJOR < 4)
+    mbedtls_entropy_context  entropyContext{}; //!< Entropy source of the ticket keys
+    mbedtls_ctr_drbg_context ctrDrbgContext{}; //!< Random number generator of the ticket keys
+#endif
+#endif
+};
+
+} // namespace sf
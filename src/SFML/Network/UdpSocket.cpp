@@ -32,12 +32,59 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
+#include <array>
 #include <ostream>
 
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 
 
+namespace
+{
+// A "UdpSocketImpl" namespace is required to avoid ambiguity in unity builds
+namespace UdpSocketImpl
+{
+// Extract the address and port of a remote peer from a socket address
+void getRemoteAddress(const sockaddr_in6&           address,
+                      std::optional<sf::IpAddress>& remoteAddress,
+                      unsigned short&               remotePort)
+{
+    if (address.sin6_family == PF_INET6)
+    {
+        remoteAddress = sf::IpAddress(
+            {address.sin6_addr.s6_addr[0],
+             address.sin6_addr.s6_addr[1],
+             address.sin6_addr.s6_addr[2],
+             address.sin6_addr.s6_addr[3],
+             address.sin6_addr.s6_addr[4],
+             address.sin6_addr.s6_addr[5],
+             address.sin6_addr.s6_addr[6],
+             address.sin6_addr.s6_addr[7],
+             address.sin6_addr.s6_addr[8],
+             address.sin6_addr.s6_addr[9],
+             address.sin6_addr.s6_addr[10],
+             address.sin6_addr.s6_addr[11],
+             address.sin6_addr.s6_addr[12],
+             address.sin6_addr.s6_addr[13],
+             address.sin6_addr.s6_addr[14],
+             address.sin6_addr.s6_addr[15]});
+        remotePort = ntohs(address.sin6_port);
+    }
+    else if (address.sin6_family == PF_INET)
+    {
+        sockaddr_in addressV4{};
+        std::memcpy(&addressV4, &address, sizeof(addressV4));
+        remoteAddress = sf::IpAddress(ntohl(addressV4.sin_addr.s_addr));
+        remotePort    = ntohs(addressV4.sin_port);
+    }
+}
+} // namespace UdpSocketImpl
+} // namespace
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -242,35 +289,7 @@ Socket::Status UdpSocket::receive(void*                     data,
 
     // Fill the sender information
     received = static_cast<std::size_t>(sizeReceived);
-
-    if (address.sin6_family == PF_INET6)
-    {
-        remoteAddress = IpAddress(
-            {address.sin6_addr.s6_addr[0],
-             address.sin6_addr.s6_addr[1],
-             address.sin6_addr.s6_addr[2],
-             address.sin6_addr.s6_addr[3],
-             address.sin6_addr.s6_addr[4],
-             address.sin6_addr.s6_addr[5],
-             address.sin6_addr.s6_addr[6],
-             address.sin6_addr.s6_addr[7],
-             address.sin6_addr.s6_addr[8],
-             address.sin6_addr.s6_addr[9],
-             address.sin6_addr.s6_addr[10],
-             address.sin6_addr.s6_addr[11],
-             address.sin6_addr.s6_addr[12],
-             address.sin6_addr.s6_addr[13],
-             address.sin6_addr.s6_addr[14],
-             address.sin6_addr.s6_addr[15]});
-        remotePort = ntohs(address.sin6_port);
-    }
-    else if (address.sin6_family == PF_INET)
-    {
-        sockaddr_in addressV4{};
-        std::memcpy(&addressV4, &address, sizeof(addressV4));
-        remoteAddress = IpAddress(ntohl(addressV4.sin_addr.s_addr));
-        remotePort    = ntohs(addressV4.sin_port);
-    }
+    UdpSocketImpl::getRemoteAddress(address, remoteAddress, remotePort);
 
     return Status::Done;
 }
@@ -314,4 +333,141 @@ Socket::Status UdpSocket::receive(Packet& packet, std::optional<IpAddress>& remo
 }
 
 
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::sendBatch(const Datagram* datagrams, std::size_t count, std::size_t& sent)
+{
+    // First clear the variables to fill
+    sent = 0;
+
+    if (count == 0)
+        return Status::Done;
+
+    // Make sure that all the datagrams are valid before sending any of them
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        assert(datagrams[i].remoteAddress && "UdpSocket::sendBatch() Datagram has no remote address");
+
+        if (datagrams[i].size > MaxDatagramSize)
+        {
+            err() << "Cannot send data over the network "
+                  << "(the number of bytes to send is greater than sf::UdpSocket::MaxDatagramSize)" << std::endl;
+            return Status::Error;
+        }
+    }
+
+    // Create the internal socket if it doesn't exist
+    create(datagrams[0].remoteAddress->isV4() ? IpAddress::Type::IpV4 : IpAddress::Type::IpV6);
+
+    // Send the datagrams by groups of messages built on the stack
+    std::array<priv::SocketImpl::Message, 64> messages;
+    while (sent < count)
+    {
+        const std::size_t messageCount = std::min(count - sent, messages.size());
+        for (std::size_t i = 0; i < messageCount; ++i)
+        {
+            const Datagram&            datagram = datagrams[sent + i];
+            priv::SocketImpl::Message& message  = messages[i];
+            message.data                        = datagram.data;
+            message.size                        = datagram.size;
+
+            if (datagram.remoteAddress->isV4())
+            {
+                const sockaddr_in address = priv::SocketImpl::createAddress(datagram.remoteAddress->toInteger(),
+                                                                            datagram.remotePort);
+                std::memcpy(&message.address, &address, sizeof(address));
+                message.addressSize = sizeof(address);
+            }
+            else
+            {
+                message.address = priv::SocketImpl::createAddress(datagram.remoteAddress->toBytes(),
+                                                                  datagram.remotePort);
+                message.addressSize = sizeof(message.address);
+            }
+        }
+
+        const std::int64_t result = priv::SocketImpl::sendMessages(getNativeHandle(),
+                                                                   messages.data(),
+                                                                   messageCount,
+                                                                   m_segmentationOffload);
+        if (result <= 0)
+            return priv::SocketImpl::getErrorStatus();
+
+        sent += static_cast<std::size_t>(result);
+    }
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+Socket::Status UdpSocket::receiveBatch(Datagram* datagrams, std::size_t count, std::size_t& received)
+{
+    // First clear the variables to fill
+    received = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        datagrams[i].received      = 0;
+        datagrams[i].remoteAddress = std::nullopt;
+        datagrams[i].remotePort    = 0;
+
+        // Check the destination buffer
+        if (!datagrams[i].data)
+        {
+            err() << "Cannot receive data from the network (the destination buffer is invalid)" << std::endl;
+            return Status::Error;
+        }
+    }
+
+    // Receive the datagrams by groups of messages built on the stack,
+    // only waiting for the first one
+    std::array<priv::SocketImpl::Message, 64> messages;
+    while (received < count)
+    {
+        const std::size_t messageCount = std::min(count - received, messages.size());
+        for (std::size_t i = 0; i < messageCount; ++i)
+        {
+            messages[i].data = datagrams[received + i].data;
+            messages[i].size = datagrams[received + i].size;
+        }
+
+        const std::int64_t result = priv::SocketImpl::receiveMessages(getNativeHandle(),
+                                                                      messages.data(),
+                                                                      messageCount,
+                                                                      received == 0);
+        if (result <= 0)
+        {
+            // Running out of datagrams after receiving some is not an error
+            if (received > 0)
+                break;
+
+            return priv::SocketImpl::getErrorStatus();
+        }
+
+        // Fill the received data and the sender information
+        for (std::size_t i = 0; i < static_cast<std::size_t>(result); ++i)
+        {
+            Datagram& datagram = datagrams[received + i];
+            datagram.received  = messages[i].size;
+            UdpSocketImpl::getRemoteAddress(messages[i].address, datagram.remoteAddress, datagram.remotePort);
+        }
+
+        received += static_cast<std::size_t>(result);
+
+        // Stop if no more datagrams were available
+        if (static_cast<std::size_t>(result) < messageCount)
+            break;
+    }
+
+    return Status::Done;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UdpSocket::setSegmentationOffload(bool enabled)
+{
+    m_segmentationOffload = enabled && priv::SocketImpl::isSegmentationOffloadSupported();
+    return m_segmentationOffload == enabled;
+}
+
+
 } // namespace sf
@@ -30,7 +30,20 @@
 #include <SFML/System/Err.hpp>
 
 #include <fcntl.h>
+#include <limits.h>
 #include <ostream>
+#include <sys/uio.h>
+
+#if defined(SFML_SYSTEM_LINUX)
+#include <netinet/udp.h>
+
+// Older system headers may not define it yet
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#endif
+
+#include <algorithm>
 
 #include <cerrno>
 #include <cstring>
@@ -102,6 +115,251 @@ void SocketImpl::setBlocking(SocketHandle sock, bool block)
 }
 
 
+////////////////////////////////////////////////////////////
+std::int64_t SocketImpl::sendBuffers(SocketHandle sock, const Buffer* buffers, std::size_t count, int flags)
+{
+    // Gather the buffers on the stack, the remaining ones will be sent by the next call
+    std::array<iovec, std::min(128, IOV_MAX)> vectors{};
+    count = std::min(count, vectors.size());
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        vectors[i].iov_base = const_cast<void*>(buffers[i].data);
+        vectors[i].iov_len  = buffers[i].size;
+    }
+
+    msghdr message{};
+    message.msg_iov    = vectors.data();
+    message.msg_iovlen = static_cast<decltype(message.msg_iovlen)>(count);
+
+    return static_cast<std::int64_t>(sendmsg(sock, &message, flags));
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t SocketImpl::sendMessages(SocketHandle   sock,
+                                      const Message* messages,
+                                      std::size_t    count,
+                                      [[maybe_unused]] bool segment)
+{
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+    // Gather the datagrams on the stack, the remaining ones will be sent by the next call
+    static constexpr std::size_t maxMessages = 64;
+
+    struct SegmentControl
+    {
+        alignas(cmsghdr) std::array<unsigned char, CMSG_SPACE(sizeof(std::uint16_t))> data;
+    };
+
+    std::array<mmsghdr, maxMessages>        headers{};
+    std::array<iovec, maxMessages>          vectors{};
+    std::array<std::size_t, maxMessages>    segmentCounts{};
+    std::array<SegmentControl, maxMessages> controls{};
+
+    std::size_t headerCount = 0;
+    std::size_t vectorCount = 0;
+    while ((vectorCount < count) && (vectorCount < maxMessages))
+    {
+        const Message& first        = messages[vectorCount];
+        std::size_t    segmentCount = 1;
+
+#if defined(SFML_SYSTEM_LINUX)
+        // Datagrams can be segmented by the system if they have the same destination and size
+        // (except the last one which can be smaller), up to 64 datagrams and 64 KB in total
+        if (segment && (first.size > 0))
+        {
+            std::size_t totalSize = first.size;
+            while ((vectorCount + segmentCount < count) && (vectorCount + segmentCount < maxMessages) &&
+                   (segmentCount < 64))
+            {
+                const Message& next = messages[vectorCount + segmentCount];
+                if ((next.size == 0) || (next.size > first.size) || (totalSize + next.size > 65507) ||
+                    (next.addressSize != first.addressSize) ||
+                    (std::memcmp(&next.address, &first.address, first.addressSize) != 0) ||
+                    (messages[vectorCount + segmentCount - 1].size != first.size))
+                    break;
+
+                totalSize += next.size;
+                ++segmentCount;
+            }
+        }
+#endif
+
+        for (std::size_t i = 0; i < segmentCount; ++i)
+        {
+            vectors[vectorCount + i].iov_base = messages[vectorCount + i].data;
+            vectors[vectorCount + i].iov_len  = messages[vectorCount + i].size;
+        }
+
+        msghdr& header     = headers[headerCount].msg_hdr;
+        header.msg_name    = const_cast<sockaddr_in6*>(&first.address);
+        header.msg_namelen = first.addressSize;
+        header.msg_iov     = &vectors[vectorCount];
+        header.msg_iovlen  = static_cast<decltype(header.msg_iovlen)>(segmentCount);
+
+#if defined(SFML_SYSTEM_LINUX)
+        if (segmentCount > 1)
+        {
+            // Tell the system the size of the datagrams to split the buffer into
+            header.msg_control    = controls[headerCount].data.data();
+            header.msg_controllen = static_cast<decltype(header.msg_controllen)>(controls[headerCount].data.size());
+
+            cmsghdr* control    = CMSG_FIRSTHDR(&header);
+            control->cmsg_level = IPPROTO_UDP;
+            control->cmsg_type  = UDP_SEGMENT;
+            control->cmsg_len   = CMSG_LEN(sizeof(std::uint16_t));
+
+            const auto segmentSize = static_cast<std::uint16_t>(first.size);
+            std::memcpy(CMSG_DATA(control), &segmentSize, sizeof(segmentSize));
+        }
+#endif
+
+        segmentCounts[headerCount] = segmentCount;
+        vectorCount += segmentCount;
+        ++headerCount;
+    }
+
+    const int sent = sendmmsg(sock, headers.data(), static_cast<unsigned int>(headerCount), 0);
+    if (sent < 0)
+        return -1;
+
+    // Count the datagrams of the messages that were sent
+    std::int64_t datagramCount = 0;
+    for (std::size_t i = 0; i < static_cast<std::size_t>(sent); ++i)
+        datagramCount += static_cast<std::int64_t>(segmentCounts[i]);
+
+    return datagramCount;
+#else
+    // Send the datagrams one by one, until the system can't take more
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const Message& message = messages[i];
+        if (sendto(sock,
+                   message.data,
+                   message.size,
+                   0,
+                   reinterpret_cast<const sockaddr*>(&message.address),
+                   message.addressSize) < 0)
+            return (i > 0) ? static_cast<std::int64_t>(i) : -1;
+    }
+
+    return static_cast<std::int64_t>(count);
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t SocketImpl::receiveMessages(SocketHandle sock, Message* messages, std::size_t count, bool wait)
+{
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+    // Gather the buffers on the stack, the remaining ones will be received by the next call
+    std::array<mmsghdr, 64> headers{};
+    std::array<iovec, 64>   vectors{};
+    count = std::min(count, headers.size());
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        vectors[i].iov_base = messages[i].data;
+        vectors[i].iov_len  = messages[i].size;
+
+        msghdr& header     = headers[i].msg_hdr;
+        header.msg_name    = &messages[i].address;
+        header.msg_namelen = sizeof(messages[i].address);
+        header.msg_iov     = &vectors[i];
+        header.msg_iovlen  = 1;
+    }
+
+    // Only wait for the first datagram (if the socket is blocking)
+    const int received = recvmmsg(sock,
+                                  headers.data(),
+                                  static_cast<unsigned int>(count),
+                                  wait ? MSG_WAITFORONE : MSG_DONTWAIT,
+                                  nullptr);
+    if (received < 0)
+        return -1;
+
+    for (std::size_t i = 0; i < static_cast<std::size_t>(received); ++i)
+    {
+        messages[i].size        = headers[i].msg_len;
+        messages[i].addressSize = headers[i].msg_hdr.msg_namelen;
+    }
+
+    return received;
+#else
+    // Receive the datagrams one by one, until no more are available
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Message& message    = messages[i];
+        message.addressSize = sizeof(message.address);
+
+        const ssize_t received = recvfrom(sock,
+                                          message.data,
+                                          message.size,
+                                          ((i == 0) && wait) ? 0 : MSG_DONTWAIT,
+                                          reinterpret_cast<sockaddr*>(&message.address),
+                                          &message.addressSize);
+        if (received < 0)
+            return (i > 0) ? static_cast<std::int64_t>(i) : -1;
+
+        message.size = static_cast<std::size_t>(received);
+    }
+
+    return static_cast<std::int64_t>(count);
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketImpl::isSegmentationOffloadSupported()
+{
+#if defined(SFML_SYSTEM_LINUX)
+    // Check once whether the system accepts the option
+    static const bool supported = []
+    {
+        const SocketHandle sock = socket(PF_INET, SOCK_DGRAM, 0);
+        if (sock == invalidSocket())
+            return false;
+
+        const int  segmentSize = 0;
+        const bool result      = (setsockopt(sock, IPPROTO_UDP, UDP_SEGMENT, &segmentSize, sizeof(segmentSize)) == 0);
+        close(sock);
+        return result;
+    }();
+
+    return supported;
+#else
+    return false;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketImpl::isPortReuseSupported()
+{
+    // Other systems define SO_REUSEPORT too, but hand all the
+    // connections to a single socket instead of balancing them
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID) || \
+    (defined(SFML_SYSTEM_FREEBSD) && defined(SO_REUSEPORT_LB))
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketImpl::enablePortReuse([[maybe_unused]] SocketHandle sock)
+{
+#if defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_ANDROID)
+    const int yes = 1;
+    return setsockopt(sock, SOL_SOCKET, SO_REUSEPORT, &yes, sizeof(yes)) == 0;
+#elif defined(SFML_SYSTEM_FREEBSD) && defined(SO_REUSEPORT_LB)
+    const int yes = 1;
+    return setsockopt(sock, SOL_SOCKET, SO_REUSEPORT_LB, &yes, sizeof(yes)) == 0;
+#else
+    return false;
+#endif
+}
+
+
 ////////////////////////////////////////////////////////////
 Socket::Status SocketImpl::getErrorStatus()
 {
@@ -27,6 +27,9 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/SocketImpl.hpp>
 
+#include <algorithm>
+#include <limits>
+
 #include <cstdint>
 #include <cstring>
 
@@ -103,6 +106,113 @@ void SocketImpl::setBlocking(SocketHandle sock, bool block)
 }
 
 
+////////////////////////////////////////////////////////////
+std::int64_t SocketImpl::sendBuffers(SocketHandle sock, const Buffer* buffers, std::size_t count, int flags)
+{
+    // Gather the buffers on the stack, the remaining ones will be sent by the next call
+    std::array<WSABUF, 128> vectors{};
+    count = std::min(count, vectors.size());
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        // WSABUF sizes are 32 bits, larger buffers are sent in several calls
+        vectors[i].buf = static_cast<CHAR*>(const_cast<void*>(buffers[i].data));
+        vectors[i].len = static_cast<ULONG>(std::min<std::size_t>(buffers[i].size, std::numeric_limits<ULONG>::max()));
+
+        if (vectors[i].len != buffers[i].size)
+        {
+            count = i + 1;
+            break;
+        }
+    }
+
+    DWORD sent = 0;
+    if (WSASend(sock, vectors.data(), static_cast<DWORD>(count), &sent, static_cast<DWORD>(flags), nullptr, nullptr) != 0)
+        return -1;
+
+    return static_cast<std::int64_t>(sent);
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t SocketImpl::sendMessages(SocketHandle sock, const Message* messages, std::size_t count, bool /* segment */)
+{
+    // Windows can't send several datagrams at once, send them one by one until the system can't take more
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const Message& message = messages[i];
+        if (sendto(sock,
+                   static_cast<const char*>(message.data),
+                   static_cast<int>(message.size),
+                   0,
+                   reinterpret_cast<const sockaddr*>(&message.address),
+                   message.addressSize) < 0)
+            return (i > 0) ? static_cast<std::int64_t>(i) : -1;
+    }
+
+    return static_cast<std::int64_t>(count);
+}
+
+
+////////////////////////////////////////////////////////////
+std::int64_t SocketImpl::receiveMessages(SocketHandle sock, Message* messages, std::size_t count, bool wait)
+{
+    // Windows can't receive several datagrams at once, receive them one by one until no more are available
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        // There is no flag to not wait for a single call, check that a datagram is available instead
+        if ((i > 0) || !wait)
+        {
+            u_long available = 0;
+            if ((ioctlsocket(sock, FIONREAD, &available) != 0) || (available == 0))
+            {
+                if (i > 0)
+                    return static_cast<std::int64_t>(i);
+
+                WSASetLastError(WSAEWOULDBLOCK);
+                return -1;
+            }
+        }
+
+        Message& message    = messages[i];
+        message.addressSize = sizeof(message.address);
+
+        const int received = recvfrom(sock,
+                                      static_cast<char*>(message.data),
+                                      static_cast<int>(message.size),
+                                      0,
+                                      reinterpret_cast<sockaddr*>(&message.address),
+                                      &message.addressSize);
+        if (received < 0)
+            return (i > 0) ? static_cast<std::int64_t>(i) : -1;
+
+        message.size = static_cast<std::size_t>(received);
+    }
+
+    return static_cast<std::int64_t>(count);
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketImpl::isSegmentationOffloadSupported()
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketImpl::isPortReuseSupported()
+{
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SocketImpl::enablePortReuse(SocketHandle /* sock */)
+{
+    return false;
+}
+
+
 ////////////////////////////////////////////////////////////
 Socket::Status SocketImpl::getErrorStatus()
 {
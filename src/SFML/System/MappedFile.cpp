@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/MappedFile.hpp>
+
+#if defined(SFML_SYSTEM_WINDOWS)
+#include <SFML/System/Win32/MappedFileImpl.hpp>
+#else
+#include <SFML/System/Unix/MappedFileImpl.hpp>
+#endif
+
+#include <utility>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+
+////////////////////////////////////////////////////////////
+MappedFile::MappedFile(MappedFile&& other) noexcept :
+    m_data(std::exchange(other.m_data, nullptr)),
+    m_size(std::exchange(other.m_size, 0))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool MappedFile::open(const std::filesystem::path& filename)
+{
+    close();
+
+    return mapFileImpl(filename, m_data, m_size);
+}
+
+
+////////////////////////////////////////////////////////////
+void MappedFile::close()
+{
+    if (m_data)
+        unmapFileImpl(m_data, m_size);
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::byte* MappedFile::getData() const
+{
+    return m_data;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t MappedFile::getSize() const
+{
+    return m_size;
+}
+
+} // namespace sf::priv
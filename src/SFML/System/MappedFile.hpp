@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Export.hpp>
+
+#include <filesystem>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Read-only view of a file mapped in memory
+///
+/// The pages of the file are loaded on demand by the operating
+/// system, and they don't count as memory allocated by the
+/// process: decoders can read the file contents in place
+/// without copying them to an intermediate buffer first.
+///
+/// The contents are read from the file itself rather than from
+/// a copy: if another process truncates the file while it is
+/// mapped, reading the pages past its new end raises SIGBUS on
+/// Unix systems instead of returning an error (Windows refuses
+/// to truncate a mapped file). Files that are replaced by
+/// renaming a new file over them are not affected, the mapping
+/// keeps the previous file alive. Only map files that are not
+/// modified in place while they are being read; `open` already
+/// refuses files that change while they are being mapped.
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API MappedFile
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFile() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~MappedFile();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFile(const MappedFile&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFile(MappedFile&& other) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Map a file in memory
+    ///
+    /// On failure, `errno` describes the error. It is set to
+    /// `ENODEV` if the file exists but can't be mapped because
+    /// it is not a regular file (a pipe, a device, ...) or if its
+    /// size or modification date changes while it is being
+    /// mapped, which means that it is still being written; such
+    /// files have to be read sequentially instead. Some special
+    /// files, such as the ones in procfs, are regular files that
+    /// report a size of 0 and are mapped as empty.
+    ///
+    /// \param filename Path of the file to map
+    ///
+    /// \return `true` on success, `false` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool open(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Unmap the file
+    ///
+    ////////////////////////////////////////////////////////////
+    void close();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a pointer to the contents of the file
+    ///
+    /// \return Pointer to the contents, or a null pointer if no file is mapped or if it is empty
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::byte* getData() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the file
+    ///
+    /// \return Size of the file, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSize() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const std::byte* m_data{}; //!< Contents of the mapped file
+    std::size_t      m_size{}; //!< Size of the mapped file, in bytes
+};
+
+} // namespace sf::priv
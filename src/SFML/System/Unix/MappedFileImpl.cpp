@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Unix/MappedFileImpl.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+bool isSameFileVersion(const struct stat& first, const struct stat& second)
+{
+    return first.st_dev == second.st_dev && first.st_ino == second.st_ino && first.st_size == second.st_size &&
+           first.st_mtime == second.st_mtime;
+}
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool mapFileImpl(const std::filesystem::path& filename, const std::byte*& data, std::size_t& size)
+{
+    // Only regular files can be mapped, check before opening so that pipes aren't disturbed
+    struct stat info{};
+    if (::stat(filename.c_str(), &info) == -1)
+        return false;
+
+    if (!S_ISREG(info.st_mode))
+    {
+        errno = ENODEV;
+        return false;
+    }
+
+    const int file = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file == -1)
+        return false;
+
+    struct stat openedInfo{};
+    if (fstat(file, &openedInfo) == -1)
+    {
+        ::close(file);
+        return false;
+    }
+
+    // Reading a mapped page that a truncation removed raises SIGBUS instead of returning an error: a file
+    // whose size or date already changes while it is being opened is probably still being written, it is
+    // safer to read it sequentially
+    if (!isSameFileVersion(info, openedInfo))
+    {
+        ::close(file);
+        errno = ENODEV;
+        return false;
+    }
+
+    data = nullptr;
+    size = static_cast<std::size_t>(openedInfo.st_size);
+
+    // Mapping an empty file fails, there's nothing to map anyway
+    if (size > 0)
+    {
+        void* const address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (address == MAP_FAILED)
+        {
+            ::close(file);
+            size = 0;
+            return false;
+        }
+
+        // Check again now that the mapping exists, the file may have been modified after the first check
+        if (fstat(file, &info) == -1 || !isSameFileVersion(info, openedInfo))
+        {
+            munmap(address, size);
+            ::close(file);
+            size  = 0;
+            errno = ENODEV;
+            return false;
+        }
+
+        // Decoders read the file once from start to end, this enables aggressive read-ahead
+        posix_madvise(address, size, POSIX_MADV_SEQUENTIAL);
+
+        data = static_cast<const std::byte*>(address);
+    }
+
+    // The mapping stays valid after the file descriptor is closed
+    ::close(file);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void unmapFileImpl(const std::byte* data, std::size_t size)
+{
+    munmap(const_cast<std::byte*>(data), size);
+}
+
+} // namespace sf::priv
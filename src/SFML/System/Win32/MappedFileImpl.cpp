@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2026 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Win32/MappedFileImpl.hpp>
+#include <SFML/System/Win32/WindowsHeader.hpp>
+
+#include <cerrno>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool mapFileImpl(const std::filesystem::path& filename, const std::byte*& data, std::size_t& size)
+{
+    const HANDLE file = CreateFileW(filename.c_str(),
+                                    GENERIC_READ,
+                                    FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                    nullptr,
+                                    OPEN_EXISTING,
+                                    FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                                    nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        errno = (GetLastError() == ERROR_ACCESS_DENIED) ? EACCES : ENOENT;
+        return false;
+    }
+
+    // Only files on disk can be mapped, not pipes or character devices
+    if (GetFileType(file) != FILE_TYPE_DISK)
+    {
+        CloseHandle(file);
+        errno = ENODEV;
+        return false;
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        errno = EIO;
+        return false;
+    }
+
+    data = nullptr;
+    size = static_cast<std::size_t>(fileSize.QuadPart);
+
+    // Mapping an empty file fails, there's nothing to map anyway
+    if (size > 0)
+    {
+        const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* const  address = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+        // The view keeps the mapping alive after its handle is closed
+        if (mapping)
+            CloseHandle(mapping);
+
+        if (!address)
+        {
+            CloseHandle(file);
+            size  = 0;
+            errno = ENOMEM;
+            return false;
+        }
+
+        data = static_cast<const std::byte*>(address);
+    }
+
+    CloseHandle(file);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void unmapFileImpl(const std::byte* data, std::size_t /* size */)
+{
+    UnmapViewOfFile(data);
+}
+
+} // namespace sf::priv
@@ -58,13 +58,85 @@ namespace
 // A nested named namespace is used here to allow unity builds of SFML.
 namespace EglContextImpl
 {
+#if defined(SFML_SYSTEM_LINUX) && !defined(SFML_USE_DRM)
+// The headless fallback is limited to builds that use this backend (SFML_OPENGL_ES): the backend is chosen
+// at compile time, and the GLX backend of desktop OpenGL builds still requires an X server
+////////////////////////////////////////////////////////////
+bool isHeadless()
+{
+    // Unlike sf::priv::openDisplay(), don't abort if there's no X server to connect to
+    static const bool headless = []
+    {
+        ::Display* xDisplay = XOpenDisplay(nullptr);
+        if (!xDisplay)
+            return true;
+
+        XCloseDisplay(xDisplay);
+        return false;
+    }();
+
+    return headless;
+}
+
+
+////////////////////////////////////////////////////////////
+EGLDisplay getHeadlessDisplay()
+{
+    if (!SF_GLAD_EGL_EXT_platform_base)
+        return EGL_NO_DISPLAY;
+
+    // Mesa's surfaceless platform renders to a GPU render node, or to llvmpipe if there's none
+    if (SF_GLAD_EGL_MESA_platform_surfaceless)
+    {
+        const EGLDisplay display = eglCheck(
+            eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr));
+
+        if (display != EGL_NO_DISPLAY)
+            return display;
+    }
+
+    // Otherwise use the first device exposed by the driver, such as the proprietary NVIDIA driver
+    if (SF_GLAD_EGL_EXT_platform_device && SF_GLAD_EGL_EXT_device_enumeration)
+    {
+        EGLDeviceEXT device      = nullptr;
+        EGLint       deviceCount = 0;
+
+        if ((eglCheck(eglQueryDevicesEXT(1, &device, &deviceCount)) != EGL_FALSE) && (deviceCount > 0))
+            return eglCheck(eglGetPlatformDisplayEXT(EGL_PLATFORM_DEVICE_EXT, device, nullptr));
+    }
+
+    return EGL_NO_DISPLAY;
+}
+#endif
+
+
+////////////////////////////////////////////////////////////
 EGLDisplay getInitializedDisplay()
 {
     static EGLDisplay display = EGL_NO_DISPLAY;
 
     if (display == EGL_NO_DISPLAY)
     {
+#if defined(SFML_SYSTEM_LINUX) && !defined(SFML_USE_DRM)
+        // Without an X server, fall back to a display that doesn't need any windowing system
+        if (isHeadless())
+        {
+            display = getHeadlessDisplay();
+
+            if (display == EGL_NO_DISPLAY)
+            {
+                sf::err() << "Failed to open X11 display and no headless EGL platform is available" << std::endl;
+                return display;
+            }
+        }
+        else
+        {
+            display = eglCheck(eglGetDisplay(EGL_DEFAULT_DISPLAY));
+        }
+#else
         display = eglCheck(eglGetDisplay(EGL_DEFAULT_DISPLAY));
+#endif
+
         eglCheck(eglInitialize(display, nullptr, nullptr));
     }
 
@@ -72,6 +144,19 @@ EGLDisplay getInitializedDisplay()
 }
 
 
+////////////////////////////////////////////////////////////
+unsigned int getDefaultBitsPerPixel()
+{
+#if defined(SFML_SYSTEM_LINUX) && !defined(SFML_USE_DRM)
+    // There's no desktop to query when running headless
+    if (isHeadless())
+        return 32;
+#endif
+
+    return sf::VideoMode::getDesktopMode().bitsPerPixel;
+}
+
+
 ////////////////////////////////////////////////////////////
 void ensureInit()
 {
@@ -112,7 +197,7 @@ EglContext::EglContext(EglContext* shared)
     m_display = EglContextImpl::getInitializedDisplay();
 
     // Get the best EGL config matching the default video settings
-    m_config = getBestConfig(m_display, VideoMode::getDesktopMode().bitsPerPixel, ContextSettings());
+    m_config = getBestConfig(m_display, EglContextImpl::getDefaultBitsPerPixel(), ContextSettings());
     updateSettings();
 
     // Note: The EGL specs say that attribList can be a null pointer when passed to eglCreatePbufferSurface,
@@ -160,13 +245,28 @@ EglContext::EglContext(EglContext*                        shared,
 
 
 ////////////////////////////////////////////////////////////
-EglContext::EglContext(EglContext* /*shared*/, const ContextSettings& /*settings*/, Vector2u /*size*/)
+EglContext::EglContext(EglContext* shared, const ContextSettings& settings, Vector2u size)
 {
     EglContextImpl::ensureInit();
 
-    err() << "Warning: context has not been initialized. The constructor EglContext(shared, settings, size) is "
-             "currently not implemented."
-          << std::endl;
+    // Get the initialized EGL display
+    m_display = EglContextImpl::getInitializedDisplay();
+
+    // Get the best EGL config matching the requested settings
+    m_config = getBestConfig(m_display, EglContextImpl::getDefaultBitsPerPixel(), settings);
+    updateSettings();
+
+    // Create a pbuffer surface of the requested size, which doesn't need any window
+    const std::array attribList = {EGL_WIDTH,
+                                   static_cast<EGLint>(size.x),
+                                   EGL_HEIGHT,
+                                   static_cast<EGLint>(size.y),
+                                   EGL_NONE};
+
+    m_surface = eglCheck(eglCreatePbufferSurface(m_display, m_config, attribList.data()));
+
+    // Create EGL context
+    createContext(shared);
 }
 
 
@@ -65,7 +65,14 @@ public:
 
     ////////////////////////////////////////////////////////////
     /// \brief Create a new context that embeds its own rendering target
-    /// \warning This constructor is currently not implemented; use a different overload.
+    ///
+    /// The rendering target is a pbuffer surface, so that this
+    /// kind of context is also available on headless systems.
+    /// On Linux, when no X server is available, the display is
+    /// obtained from the surfaceless or device EGL platforms.
+    /// This only applies to builds that use the EGL backend
+    /// (SFML_OPENGL_ES); desktop OpenGL builds use GLX, which
+    /// requires an X server.
     ///
     /// \param shared   Context to share the new one with
     /// \param settings Creation parameters
@@ -69,6 +69,11 @@ std::shared_ptr<Display> openDisplay()
         if (!sharedDisplay)
         {
             err() << "Failed to open X11 display; make sure the DISPLAY environment variable is set correctly" << std::endl;
+#ifndef SFML_OPENGL_ES
+            // Only the EGL backend can fall back to a headless display, the GLX backend needs an X server
+            err() << "Rendering without an X server requires SFML to be built with SFML_OPENGL_ES enabled"
+                  << std::endl;
+#endif
             std::abort();
         }
     }
@@ -0,0 +1,143 @@
+#include <SFML/Graphics/FrameCapture.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <WindowUtil.hpp>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::FrameCapture", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::FrameCapture>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::FrameCapture>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::FrameCapture>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::FrameCapture>);
+    }
+
+    static constexpr std::array colors = {sf::Color::Red,
+                                          sf::Color::Green,
+                                          sf::Color::Blue,
+                                          sf::Color::Yellow,
+                                          sf::Color::Cyan};
+
+    sf::RenderTexture renderTexture({4, 4});
+
+    // Render a frame whose top-left pixel is white, to check the orientation of the captured frames
+    const auto renderFrame = [&](sf::Color color)
+    {
+        sf::RectangleShape corner({1, 1});
+        corner.setFillColor(sf::Color::White);
+        renderTexture.clear(color);
+        renderTexture.draw(corner);
+        renderTexture.display();
+    };
+
+    SECTION("capture()")
+    {
+        std::mutex                          mutex;
+        std::map<std::uint64_t, sf::Image> frames;
+
+        sf::FrameCapture capture(
+            [&](std::uint64_t index, const sf::Image& frame)
+            {
+                const std::lock_guard lock(mutex);
+                frames.emplace(index, frame);
+            },
+            2,
+            2);
+
+        for (const sf::Color color : colors)
+        {
+            renderFrame(color);
+            CHECK(capture.capture(renderTexture));
+        }
+
+        capture.flush();
+        CHECK(capture.getFrameCount() == colors.size());
+        REQUIRE(frames.size() == colors.size());
+
+        for (std::size_t i = 0; i < colors.size(); ++i)
+        {
+            const sf::Image& frame = frames.at(i);
+            CHECK(frame.getSize() == sf::Vector2u(4, 4));
+            CHECK(frame.getPixel({0, 0}) == sf::Color::White);
+            CHECK(frame.getPixel({3, 3}) == colors[i]);
+        }
+    }
+
+    SECTION("appendToFile()")
+    {
+        const std::filesystem::path filename = std::filesystem::temp_directory_path() / "sfml-frame-capture.raw";
+
+        {
+            sf::FrameCapture capture(sf::FrameCapture::appendToFile(filename), 3, 3);
+
+            for (const sf::Color color : colors)
+            {
+                renderFrame(color);
+                CHECK(capture.capture(renderTexture));
+            }
+        }
+
+        std::ifstream file(filename, std::ios::binary);
+        for (const sf::Color color : colors)
+        {
+            std::array<char, 4 * 4 * 4> pixels{};
+            REQUIRE(file.read(pixels.data(), pixels.size()));
+            CHECK(sf::Color(static_cast<std::uint8_t>(pixels[0]),
+                            static_cast<std::uint8_t>(pixels[1]),
+                            static_cast<std::uint8_t>(pixels[2]),
+                            static_cast<std::uint8_t>(pixels[3])) == sf::Color::White);
+            CHECK(sf::Color(static_cast<std::uint8_t>(pixels[60]),
+                            static_cast<std::uint8_t>(pixels[61]),
+                            static_cast<std::uint8_t>(pixels[62]),
+                            static_cast<std::uint8_t>(pixels[63])) == color);
+        }
+
+        CHECK(file.peek() == std::ifstream::traits_type::eof());
+        file.close();
+        std::filesystem::remove(filename);
+    }
+
+    SECTION("appendToFile() with frames that failed to be read back")
+    {
+        const std::filesystem::path filename = std::filesystem::temp_directory_path() / "sfml-frame-capture-failed.raw";
+
+        {
+            // Frames that failed to be read back are delivered as empty images
+            const sf::FrameCapture::Callback callback = sf::FrameCapture::appendToFile(filename);
+            callback(2, sf::Image({4, 4}, sf::Color::Blue));
+            callback(1, sf::Image());
+            callback(0, sf::Image({4, 4}, sf::Color::Red));
+            callback(3, sf::Image());
+            callback(4, sf::Image({4, 4}, sf::Color::Green));
+        }
+
+        // The failed frames are skipped without holding back the following ones
+        std::ifstream file(filename, std::ios::binary);
+        for (const sf::Color color : {sf::Color::Red, sf::Color::Blue, sf::Color::Green})
+        {
+            std::array<char, 4 * 4 * 4> pixels{};
+            REQUIRE(file.read(pixels.data(), pixels.size()));
+            CHECK(sf::Color(static_cast<std::uint8_t>(pixels[0]),
+                            static_cast<std::uint8_t>(pixels[1]),
+                            static_cast<std::uint8_t>(pixels[2]),
+                            static_cast<std::uint8_t>(pixels[3])) == color);
+        }
+
+        CHECK(file.peek() == std::ifstream::traits_type::eof());
+        file.close();
+        std::filesystem::remove(filename);
+    }
+}
@@ -1,14 +1,51 @@
 #include <SFML/Graphics/Image.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/ImageView.hpp>
+
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/OutputStream.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
+#ifdef SFML_SYSTEM_LINUX
+#include <sys/stat.h>
+#endif
+
 #include <GraphicsUtil.hpp>
+#include <algorithm>
 #include <array>
+#include <filesystem>
+#include <fstream>
+#include <thread>
 #include <type_traits>
+#include <vector>
+
+namespace
+{
+class MemoryOutputStream : public sf::OutputStream
+{
+public:
+    std::optional<std::size_t> write(const void* data, std::size_t size) override
+    {
+        const auto* bytes = static_cast<const std::uint8_t*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+        return size;
+    }
+
+    std::vector<std::uint8_t> buffer;
+};
+
+class FailingOutputStream : public sf::OutputStream
+{
+public:
+    std::optional<std::size_t> write(const void*, std::size_t) override
+    {
+        return std::nullopt;
+    }
+};
+} // namespace
 
 TEST_CASE("[Graphics] sf::Image")
 {
@@ -200,6 +237,18 @@ TEST_CASE("[Graphics] sf::Image")
                 }
             }
         }
+
+        SECTION("ImageView constructor")
+        {
+            sf::Image source(sf::Vector2u(10, 10), sf::Color::Red);
+            source.setPixel({3, 2}, sf::Color::Green);
+
+            const sf::Image image(sf::ImageView(source).getSubView({{2, 2}, {4, 3}}));
+            CHECK(image.getSize() == sf::Vector2u(4, 3));
+            CHECK(image.getPixel(sf::Vector2u(0, 0)) == sf::Color::Red);
+            CHECK(image.getPixel(sf::Vector2u(1, 0)) == sf::Color::Green);
+            CHECK(image.getPixel(sf::Vector2u(3, 2)) == sf::Color::Red);
+        }
     }
 
     SECTION("Resize")
@@ -348,6 +397,33 @@ TEST_CASE("[Graphics] sf::Image")
             CHECK(image.getSize() == sf::Vector2u(1001, 304));
             CHECK(image.getPixelsPtr() != nullptr);
         }
+
+#ifdef SFML_SYSTEM_LINUX
+        SECTION("From a pipe")
+        {
+            const auto pipePath = std::filesystem::temp_directory_path() / "sfml-image-test-pipe.png";
+            std::filesystem::remove(pipePath);
+            REQUIRE(mkfifo(pipePath.c_str(), 0600) == 0);
+
+            // Opening a pipe for writing blocks until it's opened for reading
+            std::thread writer(
+                [&pipePath]
+                {
+                    std::ifstream source("sfml-logo-big.png", std::ios::binary);
+                    std::ofstream pipe(pipePath, std::ios::binary);
+                    pipe << source.rdbuf();
+                });
+
+            const bool loaded = image.loadFromFile(pipePath);
+            writer.join();
+            std::filesystem::remove(pipePath);
+
+            REQUIRE(loaded);
+            CHECK(image.getSize() == sf::Vector2u(1001, 304));
+            CHECK(image.getPixel({0, 0}) == sf::Color(255, 255, 255, 0));
+            CHECK(image.getPixel({200, 150}) == sf::Color(144, 208, 62));
+        }
+#endif
     }
 
     SECTION("loadFromMemory()")
@@ -586,7 +662,7 @@ TEST_CASE("[Graphics] sf::Image")
                 maybeOutput = image.saveToMemory("png");
                 REQUIRE(maybeOutput.has_value());
                 const auto& output = *maybeOutput;
-                REQUIRE(output.size() == 92);
+                REQUIRE(output.size() == 94);
                 CHECK(output[0] == 137);
                 CHECK(output[1] == 80);
                 CHECK(output[2] == 78);
@@ -609,6 +685,75 @@ TEST_CASE("[Graphics] sf::Image")
         }
     }
 
+    SECTION("saveToStream()")
+    {
+        MemoryOutputStream stream;
+
+        SECTION("Invalid size")
+        {
+            CHECK(!sf::Image({10, 0}, sf::Color::Magenta).saveToStream(stream, "png"));
+            CHECK(!sf::Image({0, 10}, sf::Color::Magenta).saveToStream(stream, "png"));
+        }
+
+        const sf::Image image({16, 16}, sf::Color::Magenta);
+
+        SECTION("Invalid extension")
+        {
+            CHECK(!image.saveToStream(stream, ""));
+            CHECK(!image.saveToStream(stream, "gif"));
+            CHECK(!image.saveToStream(stream, ".png")); // Supposed to be "png"
+        }
+
+        SECTION("Failing stream")
+        {
+            FailingOutputStream failingStream;
+            CHECK(!image.saveToStream(failingStream, "png"));
+            CHECK(!image.saveToStream(failingStream, "qoi"));
+        }
+
+        SECTION("Successful save")
+        {
+            // The data written to the stream is the same as the one returned by saveToMemory
+            for (const std::string_view format : {"bmp", "tga", "png", "qoi"})
+            {
+                stream.buffer.clear();
+                REQUIRE(image.saveToStream(stream, format));
+                CHECK(stream.buffer == image.saveToMemory(format));
+            }
+        }
+
+        SECTION("Encoding options")
+        {
+            sf::Image gradient({64, 64});
+            for (unsigned int y = 0; y < 64; ++y)
+                for (unsigned int x = 0; x < 64; ++x)
+                    gradient.setPixel({x, y},
+                                      sf::Color(static_cast<std::uint8_t>(x * 4), static_cast<std::uint8_t>(y * 4), 128));
+
+            sf::Image::EncodingOptions options;
+            options.compressionLevel = 5;
+
+            for (const auto filter : {sf::Image::PngFilter::Adaptive,
+                                      sf::Image::PngFilter::None,
+                                      sf::Image::PngFilter::Sub,
+                                      sf::Image::PngFilter::Up,
+                                      sf::Image::PngFilter::Average,
+                                      sf::Image::PngFilter::Paeth})
+            {
+                options.pngFilter = filter;
+                stream.buffer.clear();
+                REQUIRE(gradient.saveToStream(stream, "png", options));
+
+                const sf::Image loaded(stream.buffer.data(), stream.buffer.size());
+                REQUIRE(loaded.getSize() == gradient.getSize());
+                CHECK(std::equal(loaded.getPixelsPtr(), loaded.getPixelsPtr() + 64 * 64 * 4, gradient.getPixelsPtr()));
+            }
+
+            // The default settings are restored afterwards
+            CHECK(image.saveToMemory("png")->size() == 94);
+        }
+    }
+
     SECTION("Set/get pixel")
     {
         sf::Image image(sf::Vector2u(10, 10), sf::Color::Green);
@@ -697,6 +842,37 @@ TEST_CASE("[Graphics] sf::Image")
         }
     }
 
+    SECTION("Copy from ImageView")
+    {
+        SECTION("Copy (ImageView, Vector2u)")
+        {
+            sf::Image source(sf::Vector2u(10, 10), sf::Color::Blue);
+            source.setPixel({5, 5}, sf::Color::Green);
+            sf::Image image(sf::Vector2u(10, 10), sf::Color::Red);
+            CHECK(image.copy(sf::ImageView(source).getSubView({{4, 4}, {3, 3}}), sf::Vector2u(8, 1)));
+
+            CHECK(image.getPixel(sf::Vector2u(7, 1)) == sf::Color::Red);
+            CHECK(image.getPixel(sf::Vector2u(8, 1)) == sf::Color::Blue);
+            CHECK(image.getPixel(sf::Vector2u(9, 2)) == sf::Color::Green);
+            CHECK(image.getPixel(sf::Vector2u(9, 3)) == sf::Color::Blue);
+            CHECK(image.getPixel(sf::Vector2u(9, 4)) == sf::Color::Red);
+        }
+
+        SECTION("Copy (Empty ImageView)")
+        {
+            sf::Image image(sf::Vector2u(10, 10), sf::Color::Red);
+            CHECK(!image.copy(sf::ImageView(), sf::Vector2u(0, 0)));
+        }
+
+        SECTION("Copy (Out of bounds destination)")
+        {
+            const sf::Image source(sf::Vector2u(5, 5), sf::Color::Blue);
+            sf::Image       image(sf::Vector2u(10, 10), sf::Color::Red);
+            CHECK(!image.copy(sf::ImageView(source), sf::Vector2u(10, 0)));
+            CHECK(image.getPixel(sf::Vector2u(9, 0)) == sf::Color::Red);
+        }
+    }
+
     SECTION("Create mask from color")
     {
         SECTION("createMaskFromColor(Color)")
@@ -0,0 +1,112 @@
+#include <SFML/Graphics/ImageView.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <array>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::ImageView")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::ImageView>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::ImageView>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::ImageView>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::ImageView>);
+        STATIC_CHECK(std::is_convertible_v<sf::Image, sf::ImageView>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::ImageView view;
+            CHECK(view.getSize() == sf::Vector2u());
+            CHECK(view.getStride() == 0);
+            CHECK(view.getPixelsPtr() == nullptr);
+        }
+
+        SECTION("Pixels, size and stride constructor")
+        {
+            // 2 x 2 pixels in rows of 3 pixels
+            static constexpr std::array<std::uint8_t, 24> pixels = {255, 0, 0, 255, 0, 255, 0, 255, 0, 0, 0, 0,
+                                                                    0, 0, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0};
+
+            const sf::ImageView view(pixels.data(), {2, 2}, 3);
+            CHECK(view.getSize() == sf::Vector2u(2, 2));
+            CHECK(view.getStride() == 3);
+            CHECK(!view.isContiguous());
+            CHECK(view.getPixelsPtr() == pixels.data());
+            CHECK(view.getRowPtr(1) == pixels.data() + 12);
+            CHECK(view.getPixel({0, 0}) == sf::Color::Red);
+            CHECK(view.getPixel({1, 0}) == sf::Color::Green);
+            CHECK(view.getPixel({0, 1}) == sf::Color::Blue);
+            CHECK(view.getPixel({1, 1}) == sf::Color::White);
+        }
+
+        SECTION("Tightly packed rows")
+        {
+            static constexpr std::array<std::uint8_t, 16> pixels{};
+
+            const sf::ImageView view(pixels.data(), {2, 2});
+            CHECK(view.getStride() == 2);
+            CHECK(view.isContiguous());
+        }
+
+        SECTION("Empty")
+        {
+            static constexpr std::array<std::uint8_t, 16> pixels{};
+
+            const sf::ImageView view(pixels.data(), {0, 2});
+            CHECK(view.getSize() == sf::Vector2u());
+            CHECK(view.getPixelsPtr() == nullptr);
+        }
+
+        SECTION("Image constructor")
+        {
+            const sf::Image     image({10, 5}, sf::Color::Cyan);
+            const sf::ImageView view(image);
+            CHECK(view.getSize() == sf::Vector2u(10, 5));
+            CHECK(view.getStride() == 10);
+            CHECK(view.isContiguous());
+            CHECK(view.getPixelsPtr() == image.getPixelsPtr());
+            CHECK(view.getPixel({9, 4}) == sf::Color::Cyan);
+        }
+    }
+
+    SECTION("getSubView()")
+    {
+        sf::Image image({10, 5}, sf::Color::Red);
+        image.setPixel({4, 3}, sf::Color::Green);
+        const sf::ImageView view(image);
+
+        SECTION("Sub-rectangle")
+        {
+            const sf::ImageView subView = view.getSubView({{3, 2}, {4, 2}});
+            CHECK(subView.getSize() == sf::Vector2u(4, 2));
+            CHECK(subView.getStride() == 10);
+            CHECK(subView.getPixelsPtr() == image.getPixelsPtr() + (2 * 10 + 3) * 4);
+            CHECK(subView.getPixel({1, 1}) == sf::Color::Green);
+            CHECK(subView.getPixel({0, 0}) == sf::Color::Red);
+        }
+
+        SECTION("Sub-rectangle of a sub-rectangle")
+        {
+            const sf::ImageView subView = view.getSubView({{2, 1}, {6, 4}}).getSubView({{2, 2}, {1, 1}});
+            CHECK(subView.getSize() == sf::Vector2u(1, 1));
+            CHECK(subView.getStride() == 10);
+            CHECK(subView.getPixel({0, 0}) == sf::Color::Green);
+        }
+
+        SECTION("Empty area")
+        {
+            const sf::ImageView subView = view.getSubView({{3, 2}, {0, 2}});
+            CHECK(subView.getSize() == sf::Vector2u());
+            CHECK(subView.getPixelsPtr() == nullptr);
+        }
+    }
+}
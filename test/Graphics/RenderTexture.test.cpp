@@ -1,6 +1,8 @@
 #include <SFML/Graphics/RenderTexture.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+
 #include <SFML/System/Exception.hpp>
 
 #include <catch2/catch_test_macros.hpp>
@@ -87,6 +89,24 @@ TEST_CASE("[Graphics] sf::RenderTexture", runDisplayTests())
         CHECK(renderTexture.resize({100, 100}, sf::ContextSettings{0 /* depthBits */, 8 /* stencilBits */}));
     }
 
+    SECTION("Pixel format")
+    {
+        sf::RenderTexture renderTexture;
+        REQUIRE(renderTexture.resize({100, 100}, sf::Texture::Format::RGBA8));
+        CHECK(renderTexture.getTexture().getFormat() == sf::Texture::Format::RGBA8);
+
+        if (sf::Texture::isFormatAvailable(sf::Texture::Format::R16F))
+        {
+            REQUIRE(renderTexture.resize({100, 100}, sf::Texture::Format::R16F));
+            CHECK(renderTexture.getSize() == sf::Vector2u(100, 100));
+            CHECK(renderTexture.getTexture().getFormat() == sf::Texture::Format::R16F);
+
+            renderTexture.clear(sf::Color::Yellow);
+            renderTexture.display();
+            CHECK(renderTexture.getTexture().copyToImage().getPixel({50, 50}) == sf::Color::Red);
+        }
+    }
+
     SECTION("getMaximumAntiAliasingLevel()")
     {
         CHECK(sf::RenderTexture::getMaximumAntiAliasingLevel() <= 64);
@@ -0,0 +1,131 @@
+#include <SFML/Graphics/RenderTexturePool.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::RenderTexturePool", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::RenderTexturePool>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::RenderTexturePool>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::RenderTexturePool>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::RenderTexturePool>);
+    }
+
+    sf::RenderTexturePool pool;
+
+    SECTION("Construction")
+    {
+        CHECK(pool.getSize() == 0);
+    }
+
+    SECTION("acquire()")
+    {
+        sf::RenderTexture* renderTexture = pool.acquire({100, 50});
+        REQUIRE(renderTexture != nullptr);
+        CHECK(renderTexture->getSize() == sf::Vector2u(100, 50));
+        CHECK(pool.getSize() == 1);
+
+        SECTION("In use")
+        {
+            sf::RenderTexture* other = pool.acquire({100, 50});
+            CHECK(other != nullptr);
+            CHECK(other != renderTexture);
+            CHECK(pool.getSize() == 2);
+        }
+
+        SECTION("Released")
+        {
+            renderTexture->setSmooth(true);
+            renderTexture->setView(sf::View(sf::FloatRect({10, 10}, {20, 20})));
+            pool.release(*renderTexture);
+
+            sf::RenderTexture* other = pool.acquire({100, 50});
+            CHECK(other == renderTexture);
+            CHECK(!other->isSmooth());
+            CHECK(other->getView().getCenter() == other->getDefaultView().getCenter());
+            CHECK(other->getView().getSize() == other->getDefaultView().getSize());
+            CHECK(pool.getSize() == 1);
+        }
+
+        SECTION("Different size")
+        {
+            pool.release(*renderTexture);
+            CHECK(pool.acquire({50, 100}) != renderTexture);
+            CHECK(pool.getSize() == 2);
+        }
+
+        SECTION("Different settings")
+        {
+            pool.release(*renderTexture);
+            CHECK(pool.acquire({100, 50}, sf::ContextSettings{24 /* depthBits */}) != renderTexture);
+            CHECK(pool.getSize() == 2);
+        }
+
+        SECTION("Different format")
+        {
+            pool.release(*renderTexture);
+            if (sf::Texture::isFormatAvailable(sf::Texture::Format::R16F))
+            {
+                sf::RenderTexture* floatTexture = pool.acquire({100, 50}, sf::Texture::Format::R16F);
+                REQUIRE(floatTexture != nullptr);
+                CHECK(floatTexture != renderTexture);
+                CHECK(floatTexture->getTexture().getFormat() == sf::Texture::Format::R16F);
+                CHECK(pool.getSize() == 2);
+
+                // Released render textures are only reused for the same format
+                pool.release(*floatTexture);
+                CHECK(pool.acquire({100, 50}) == renderTexture);
+                CHECK(pool.acquire({100, 50}, sf::Texture::Format::R16F) == floatTexture);
+            }
+        }
+    }
+
+    SECTION("endFrame()")
+    {
+        sf::RenderTexture* renderTexture = pool.acquire({100, 50});
+        REQUIRE(renderTexture != nullptr);
+        pool.endFrame();
+        CHECK(pool.getSize() == 1);
+        CHECK(pool.acquire({100, 50}) == renderTexture);
+
+        // Unused for two frames
+        pool.endFrame();
+        pool.endFrame();
+        CHECK(pool.getSize() == 1);
+        pool.endFrame();
+        CHECK(pool.getSize() == 0);
+    }
+
+    SECTION("endFrame() without unused frames")
+    {
+        sf::RenderTexturePool immediatePool(0);
+        sf::RenderTexture*    renderTexture = immediatePool.acquire({100, 50});
+        REQUIRE(renderTexture != nullptr);
+
+        // Render textures used during the frame are kept, even when still in use
+        immediatePool.endFrame();
+        CHECK(immediatePool.getSize() == 1);
+        CHECK(immediatePool.acquire({100, 50}) == renderTexture);
+        immediatePool.release(*renderTexture);
+        immediatePool.endFrame();
+        CHECK(immediatePool.getSize() == 1);
+
+        // Unused for one frame
+        immediatePool.endFrame();
+        CHECK(immediatePool.getSize() == 0);
+    }
+
+    SECTION("clear()")
+    {
+        sf::RenderTexture* renderTexture = pool.acquire({100, 50});
+        REQUIRE(renderTexture != nullptr);
+        pool.release(*renderTexture);
+        pool.clear();
+        CHECK(pool.getSize() == 0);
+    }
+}
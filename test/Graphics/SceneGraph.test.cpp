@@ -0,0 +1,117 @@
+#include <SFML/Graphics/SceneGraph.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Drawable.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <type_traits>
+
+namespace
+{
+class DummyDrawable : public sf::Drawable
+{
+    void draw(sf::RenderTarget&, sf::RenderStates) const override
+    {
+    }
+};
+
+sf::Transform translation(sf::Vector2f offset)
+{
+    return sf::Transform().translate(offset);
+}
+} // namespace
+
+TEST_CASE("[Graphics] sf::SceneGraph")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::SceneGraph>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::SceneGraph>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::SceneGraph>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::SceneGraph>);
+    }
+
+    sf::SceneGraph graph;
+
+    SECTION("Construction")
+    {
+        CHECK(graph.getSize() == 0);
+    }
+
+    SECTION("add()")
+    {
+        const sf::SceneGraph::Id root  = graph.add();
+        const sf::SceneGraph::Id child = graph.add(root, translation({1, 2}));
+        CHECK(graph.getSize() == 2);
+        CHECK(root != child);
+        CHECK(graph.getParent(root) == sf::SceneGraph::NoParent);
+        CHECK(graph.getParent(child) == root);
+        CHECK(graph.getLocalTransform(root) == sf::Transform::Identity);
+        CHECK(graph.getLocalTransform(child) == translation({1, 2}));
+        CHECK(graph.getDrawable(child) == nullptr);
+    }
+
+    SECTION("Set/get drawable")
+    {
+        const DummyDrawable      drawable;
+        const sf::SceneGraph::Id id = graph.add();
+        graph.setDrawable(id, &drawable);
+        CHECK(graph.getDrawable(id) == &drawable);
+        graph.setDrawable(id, nullptr);
+        CHECK(graph.getDrawable(id) == nullptr);
+    }
+
+    SECTION("World transforms")
+    {
+        const sf::SceneGraph::Id root       = graph.add(sf::SceneGraph::NoParent, translation({10, 0}));
+        const sf::SceneGraph::Id child      = graph.add(root, translation({0, 20}));
+        const sf::SceneGraph::Id grandChild = graph.add(child, translation({1, 1}));
+        const sf::SceneGraph::Id sibling    = graph.add(root, translation({5, 5}));
+        CHECK(graph.getWorldTransform(root) == translation({10, 0}));
+        CHECK(graph.getWorldTransform(child) == translation({10, 20}));
+        CHECK(graph.getWorldTransform(grandChild) == translation({11, 21}));
+        CHECK(graph.getWorldTransform(sibling) == translation({15, 5}));
+
+        SECTION("Dirty propagation")
+        {
+            graph.setLocalTransform(child, translation({0, 30}));
+            CHECK(graph.getWorldTransform(root) == translation({10, 0}));
+            CHECK(graph.getWorldTransform(child) == translation({10, 30}));
+            CHECK(graph.getWorldTransform(grandChild) == translation({11, 31}));
+            CHECK(graph.getWorldTransform(sibling) == translation({15, 5}));
+
+            graph.setLocalTransform(root, sf::Transform::Identity);
+            CHECK(graph.getWorldTransform(grandChild) == translation({1, 31}));
+            CHECK(graph.getWorldTransform(sibling) == translation({5, 5}));
+        }
+
+        SECTION("remove()")
+        {
+            graph.remove(child);
+            CHECK(graph.getSize() == 2);
+            CHECK(graph.getParent(sibling) == root);
+            CHECK(graph.getWorldTransform(sibling) == translation({15, 5}));
+
+            graph.setLocalTransform(root, translation({-5, -5}));
+            CHECK(graph.getWorldTransform(sibling) == sf::Transform::Identity);
+
+            SECTION("Identifiers are reused")
+            {
+                const sf::SceneGraph::Id id = graph.add(sibling, translation({1, 0}));
+                CHECK((id == child || id == grandChild));
+                CHECK(graph.getSize() == 3);
+                CHECK(graph.getParent(id) == sibling);
+                CHECK(graph.getWorldTransform(id) == translation({1, 0}));
+            }
+        }
+
+        SECTION("clear()")
+        {
+            graph.clear();
+            CHECK(graph.getSize() == 0);
+            CHECK(graph.add() == 0);
+        }
+    }
+}
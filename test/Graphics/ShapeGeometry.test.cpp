@@ -0,0 +1,78 @@
+#include <SFML/Graphics/ShapeGeometry.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Transform.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::ShapeGeometry", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::ShapeGeometry>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::ShapeGeometry>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::ShapeGeometry>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::ShapeGeometry>);
+    }
+
+    SECTION("Default constructor")
+    {
+        const sf::ShapeGeometry geometry;
+        CHECK(geometry.getTexture() == nullptr);
+        CHECK(geometry.getLocalBounds() == sf::FloatRect());
+    }
+
+    SECTION("Shape constructor")
+    {
+        const sf::Texture  texture(sf::Vector2u(4, 4));
+        sf::RectangleShape shape({10, 20});
+        shape.setTexture(&texture);
+        shape.setOutlineThickness(2);
+        shape.setPosition({100, 100});
+
+        const sf::ShapeGeometry geometry(shape);
+        CHECK(geometry.getTexture() == &texture);
+        CHECK(geometry.getLocalBounds() == sf::FloatRect({-2, -2}, {14, 24}));
+
+        SECTION("Later changes to the shape are ignored")
+        {
+            shape.setSize({50, 50});
+            shape.setTexture(nullptr);
+            CHECK(geometry.getTexture() == &texture);
+            CHECK(geometry.getLocalBounds() == sf::FloatRect({-2, -2}, {14, 24}));
+        }
+    }
+
+    SECTION("draw()")
+    {
+        sf::RectangleShape shape({2, 2});
+        shape.setFillColor(sf::Color::Red);
+        shape.setOutlineThickness(1);
+        shape.setOutlineColor(sf::Color::Green);
+        const sf::ShapeGeometry geometry(shape);
+
+        sf::RenderTexture renderTexture({16, 16});
+        renderTexture.clear(sf::Color::Blue);
+        renderTexture.draw(geometry, sf::Transform().translate({2, 2}));
+        renderTexture.draw(geometry, sf::Transform().translate({10, 10}));
+        renderTexture.display();
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({0, 0}) == sf::Color::Blue);
+        CHECK(image.getPixel({1, 1}) == sf::Color::Green);
+        CHECK(image.getPixel({2, 2}) == sf::Color::Red);
+        CHECK(image.getPixel({3, 3}) == sf::Color::Red);
+        CHECK(image.getPixel({4, 4}) == sf::Color::Green);
+        CHECK(image.getPixel({6, 6}) == sf::Color::Blue);
+        CHECK(image.getPixel({9, 9}) == sf::Color::Green);
+        CHECK(image.getPixel({11, 11}) == sf::Color::Red);
+    }
+}
@@ -0,0 +1,190 @@
+#include <SFML/Graphics/SpatialIndex.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <array>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+class DummyDrawable : public sf::Drawable
+{
+    void draw(sf::RenderTarget&, sf::RenderStates) const override
+    {
+    }
+};
+} // namespace
+
+TEST_CASE("[Graphics] sf::SpatialIndex")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::SpatialIndex>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::SpatialIndex>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::SpatialIndex>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::SpatialIndex>);
+    }
+
+    std::array<DummyDrawable, 4>     drawables;
+    std::vector<const sf::Drawable*> result;
+    sf::SpatialIndex                 index({100, 100});
+
+    SECTION("Construction")
+    {
+        CHECK(index.getSize() == 0);
+        index.query(sf::FloatRect({-1000, -1000}, {2000, 2000}), result);
+        CHECK(result.empty());
+    }
+
+    SECTION("insert()")
+    {
+        const auto id = index.insert(drawables[0], sf::FloatRect({10, 20}, {30, 40}));
+        CHECK(index.getSize() == 1);
+        CHECK(index.getBounds(id) == sf::FloatRect({10, 20}, {30, 40}));
+    }
+
+    SECTION("query()")
+    {
+        index.insert(drawables[0], sf::FloatRect({10, 10}, {20, 20}));
+        index.insert(drawables[1], sf::FloatRect({250, 250}, {20, 20}));
+        index.insert(drawables[2], sf::FloatRect({-500, -500}, {1000, 1000})); // Oversized
+        index.insert(drawables[3], sf::FloatRect({50, 50}, {300, 20}));       // Spans several cells
+
+        SECTION("Everything")
+        {
+            index.query(sf::FloatRect({-1000, -1000}, {2000, 2000}), result);
+            CHECK(result ==
+                  std::vector<const sf::Drawable*>{&drawables[0], &drawables[1], &drawables[2], &drawables[3]});
+        }
+
+        SECTION("Part of the world")
+        {
+            index.query(sf::FloatRect({200, 0}, {200, 100}), result);
+            CHECK(result == std::vector<const sf::Drawable*>{&drawables[2], &drawables[3]});
+        }
+
+        SECTION("Same cell, no intersection")
+        {
+            index.query(sf::FloatRect({60, 80}, {10, 10}), result);
+            CHECK(result == std::vector<const sf::Drawable*>{&drawables[2]});
+        }
+
+        SECTION("Outside of the world")
+        {
+            index.query(sf::FloatRect({5000, 5000}, {10, 10}), result);
+            CHECK(result.empty());
+        }
+
+        SECTION("Result is appended")
+        {
+            result.push_back(nullptr);
+            index.query(sf::FloatRect({0, 0}, {40, 40}), result);
+            CHECK(result == std::vector<const sf::Drawable*>{nullptr, &drawables[0], &drawables[2]});
+        }
+
+        SECTION("View")
+        {
+            const sf::View view(sf::FloatRect({200, 200}, {100, 100}));
+            index.query(view, result);
+            CHECK(result == std::vector<const sf::Drawable*>{&drawables[1], &drawables[2]});
+        }
+
+        SECTION("Repeated queries")
+        {
+            index.query(sf::FloatRect({200, 0}, {200, 100}), result);
+            index.query(sf::FloatRect({0, 0}, {40, 40}), result);
+            CHECK(result ==
+                  std::vector<const sf::Drawable*>{&drawables[2], &drawables[3], &drawables[0], &drawables[2]});
+        }
+
+        SECTION("NaN area")
+        {
+            const float nan = std::numeric_limits<float>::quiet_NaN();
+            index.query(sf::FloatRect({nan, nan}, {nan, nan}), result);
+            CHECK(result.empty());
+        }
+    }
+
+    SECTION("update()")
+    {
+        const auto id0 = index.insert(drawables[0], sf::FloatRect({10, 10}, {20, 20}));
+        index.insert(drawables[1], sf::FloatRect({250, 250}, {20, 20}));
+
+        SECTION("Same cell")
+        {
+            index.update(id0, sf::FloatRect({40, 40}, {20, 20}));
+            CHECK(index.getBounds(id0) == sf::FloatRect({40, 40}, {20, 20}));
+            index.query(sf::FloatRect({0, 0}, {35, 35}), result);
+            CHECK(result.empty());
+        }
+
+        SECTION("Other cell")
+        {
+            index.update(id0, sf::FloatRect({240, 240}, {20, 20}));
+            index.query(sf::FloatRect({0, 0}, {100, 100}), result);
+            CHECK(result.empty());
+            index.query(sf::FloatRect({200, 200}, {100, 100}), result);
+            CHECK(result == std::vector<const sf::Drawable*>{&drawables[0], &drawables[1]});
+        }
+
+        SECTION("Oversized")
+        {
+            index.update(id0, sf::FloatRect({-5000, -5000}, {10000, 10000}));
+            index.query(sf::FloatRect({1000, 1000}, {10, 10}), result);
+            CHECK(result == std::vector<const sf::Drawable*>{&drawables[0]});
+
+            result.clear();
+            index.update(id0, sf::FloatRect({10, 10}, {20, 20}));
+            index.query(sf::FloatRect({1000, 1000}, {10, 10}), result);
+            CHECK(result.empty());
+        }
+    }
+
+    SECTION("remove()")
+    {
+        const auto id0 = index.insert(drawables[0], sf::FloatRect({10, 10}, {20, 20}));
+        index.insert(drawables[1], sf::FloatRect({20, 20}, {200, 20}));
+        index.remove(id0);
+        CHECK(index.getSize() == 1);
+        index.query(sf::FloatRect({0, 0}, {100, 100}), result);
+        CHECK(result == std::vector<const sf::Drawable*>{&drawables[1]});
+
+        SECTION("Draw order of reinserted drawables")
+        {
+            const auto id2 = index.insert(drawables[2], sf::FloatRect({10, 10}, {20, 20}));
+            CHECK(id2 == id0);
+            result.clear();
+            index.query(sf::FloatRect({0, 0}, {100, 100}), result);
+            CHECK(result == std::vector<const sf::Drawable*>{&drawables[1], &drawables[2]});
+        }
+    }
+
+    SECTION("clear()")
+    {
+        index.insert(drawables[0], sf::FloatRect({10, 10}, {20, 20}));
+        index.insert(drawables[1], sf::FloatRect({-500, -500}, {1000, 1000}));
+        index.clear();
+        CHECK(index.getSize() == 0);
+        index.query(sf::FloatRect({0, 0}, {100, 100}), result);
+        CHECK(result.empty());
+    }
+
+    SECTION("getVisibleArea()")
+    {
+        CHECK_THAT(sf::SpatialIndex::getVisibleArea(sf::View(sf::FloatRect({10, 20}, {400, 600}))),
+                   equalsApprox(sf::FloatRect({10, 20}, {400, 600}), 1e-3f));
+
+        sf::View view({0, 0}, {100, 100});
+        view.setRotation(sf::degrees(45));
+        CHECK_THAT(sf::SpatialIndex::getVisibleArea(view),
+                   equalsApprox(sf::FloatRect({-70.71068f, -70.71068f}, {141.42136f, 141.42136f}), 1e-3f));
+    }
+}
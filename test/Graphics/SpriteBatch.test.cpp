@@ -0,0 +1,149 @@
+#include <SFML/Graphics/SpriteBatch.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::SpriteBatch", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::SpriteBatch>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::SpriteBatch>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::SpriteBatch>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::SpriteBatch>);
+    }
+
+    // Two 2x2 squares: red and green
+    sf::Image image({4, 2}, sf::Color::Red);
+    for (unsigned int y = 0; y < 2; ++y)
+        for (unsigned int x = 2; x < 4; ++x)
+            image.setPixel({x, y}, sf::Color::Green);
+    const sf::Texture texture(image);
+
+    sf::SpriteBatch batch;
+
+    SECTION("Construction")
+    {
+        CHECK(batch.getSize() == 0);
+    }
+
+    SECTION("add()")
+    {
+        SECTION("Texture and rectangle")
+        {
+            const std::size_t index = batch.add(texture, {{2, 0}, {2, 2}});
+            CHECK(index == 0);
+            CHECK(batch.getSize() == 1);
+            CHECK(&batch.getTexture(index) == &texture);
+            CHECK(batch.getTextureRect(index) == sf::IntRect({2, 0}, {2, 2}));
+            CHECK(batch.getPosition(index) == sf::Vector2f());
+            CHECK(batch.getRotation(index) == sf::Angle::Zero);
+            CHECK(batch.getScale(index) == sf::Vector2f(1, 1));
+            CHECK(batch.getOrigin(index) == sf::Vector2f());
+            CHECK(batch.getColor(index) == sf::Color::White);
+            CHECK(batch.getGlobalBounds(index) == sf::FloatRect({}, {2, 2}));
+        }
+
+        SECTION("Sprite")
+        {
+            sf::Sprite sprite(texture, {{0, 0}, {2, 2}});
+            sprite.setPosition({10, 20});
+            sprite.setRotation(sf::degrees(90));
+            sprite.setScale({2, 3});
+            sprite.setOrigin({1, 1});
+            sprite.setColor(sf::Color::Cyan);
+
+            batch.add(texture, {{2, 0}, {2, 2}});
+            const std::size_t index = batch.add(sprite);
+            CHECK(index == 1);
+            CHECK(batch.getSize() == 2);
+            CHECK(batch.getPosition(index) == sf::Vector2f(10, 20));
+            CHECK(batch.getRotation(index) == sf::degrees(90));
+            CHECK(batch.getScale(index) == sf::Vector2f(2, 3));
+            CHECK(batch.getOrigin(index) == sf::Vector2f(1, 1));
+            CHECK(batch.getColor(index) == sf::Color::Cyan);
+            CHECK(batch.getGlobalBounds(index) == Approx(sprite.getGlobalBounds()));
+        }
+    }
+
+    SECTION("remove()")
+    {
+        batch.add(texture, {{0, 0}, {1, 1}});
+        batch.add(texture, {{1, 0}, {1, 1}});
+        batch.add(texture, {{2, 0}, {1, 1}});
+        batch.remove(1);
+        CHECK(batch.getSize() == 2);
+        CHECK(batch.getTextureRect(0) == sf::IntRect({0, 0}, {1, 1}));
+        CHECK(batch.getTextureRect(1) == sf::IntRect({2, 0}, {1, 1}));
+    }
+
+    SECTION("clear()")
+    {
+        batch.add(texture, {{0, 0}, {1, 1}});
+        batch.add(texture, {{1, 0}, {1, 1}});
+        batch.clear();
+        CHECK(batch.getSize() == 0);
+    }
+
+    SECTION("Set/get properties")
+    {
+        const sf::Texture otherTexture(sf::Vector2u(8, 8));
+        const std::size_t index = batch.add(texture, {{0, 0}, {2, 2}});
+        batch.setPosition(index, {3, 4});
+        batch.setRotation(index, sf::degrees(-90));
+        batch.setScale(index, {5, 6});
+        batch.setOrigin(index, {7, 8});
+        batch.setTexture(index, otherTexture);
+        batch.setTextureRect(index, {{1, 2}, {3, 4}});
+        batch.setColor(index, sf::Color::Magenta);
+        CHECK(batch.getPosition(index) == sf::Vector2f(3, 4));
+        CHECK(batch.getRotation(index) == Approx(sf::degrees(270)));
+        CHECK(batch.getScale(index) == sf::Vector2f(5, 6));
+        CHECK(batch.getOrigin(index) == sf::Vector2f(7, 8));
+        CHECK(&batch.getTexture(index) == &otherTexture);
+        CHECK(batch.getTextureRect(index) == sf::IntRect({1, 2}, {3, 4}));
+        CHECK(batch.getColor(index) == sf::Color::Magenta);
+    }
+
+    SECTION("draw()")
+    {
+        sf::RenderTexture renderTexture({8, 8});
+        renderTexture.clear(sf::Color::Blue);
+
+        const std::size_t red   = batch.add(texture, {{0, 0}, {2, 2}});
+        const std::size_t green = batch.add(texture, {{2, 0}, {2, 2}});
+        batch.setPosition(green, {4, 4});
+        batch.setScale(green, {2, 2});
+        renderTexture.draw(batch);
+        renderTexture.display();
+
+        sf::Image result = renderTexture.getTexture().copyToImage();
+        CHECK(result.getPixel({0, 0}) == sf::Color::Red);
+        CHECK(result.getPixel({1, 1}) == sf::Color::Red);
+        CHECK(result.getPixel({2, 2}) == sf::Color::Blue);
+        CHECK(result.getPixel({7, 7}) == sf::Color::Green);
+
+        SECTION("Sprite updated after being drawn")
+        {
+            batch.setPosition(red, {4, 0});
+            batch.remove(green);
+            renderTexture.clear(sf::Color::Blue);
+            renderTexture.draw(batch);
+            renderTexture.display();
+
+            result = renderTexture.getTexture().copyToImage();
+            CHECK(result.getPixel({0, 0}) == sf::Color::Blue);
+            CHECK(result.getPixel({5, 1}) == sf::Color::Red);
+            CHECK(result.getPixel({7, 7}) == sf::Color::Blue);
+        }
+    }
+}
@@ -2,6 +2,7 @@
 
 // Other 1st party headers
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/ImageView.hpp>
 
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
@@ -33,6 +34,7 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
             CHECK(!texture.isSmooth());
             CHECK(!texture.isSrgb());
             CHECK(!texture.isRepeated());
+            CHECK(texture.getFormat() == sf::Texture::Format::RGBA8);
             CHECK(texture.getNativeHandle() == 0);
         }
 
@@ -198,6 +200,88 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
         }
     }
 
+    SECTION("Pixel format")
+    {
+        CHECK(sf::Texture::isFormatAvailable(sf::Texture::Format::RGBA8));
+
+        SECTION("RGBA8")
+        {
+            sf::Texture texture;
+            CHECK(texture.resize({10, 10}, sf::Texture::Format::RGBA8));
+            CHECK(texture.getFormat() == sf::Texture::Format::RGBA8);
+            CHECK(!texture.isSrgb());
+        }
+
+        SECTION("R8")
+        {
+            if (sf::Texture::isFormatAvailable(sf::Texture::Format::R8))
+            {
+                // Rows of 3 bytes are not aligned on 4 bytes
+                static constexpr std::array<std::uint8_t, 6> pixels = {0x00, 0x40, 0x80, 0xC0, 0xE0, 0xFF};
+
+                sf::Texture texture(sf::Vector2u(3, 2), sf::Texture::Format::R8);
+                CHECK(texture.getFormat() == sf::Texture::Format::R8);
+                texture.update(pixels.data());
+
+                const sf::Image image = texture.copyToImage();
+                CHECK(image.getSize() == sf::Vector2u(3, 2));
+                CHECK(image.getPixel({1, 0}) == sf::Color(0x40, 0, 0));
+                CHECK(image.getPixel({0, 1}) == sf::Color(0xC0, 0, 0));
+                CHECK(image.getPixel({2, 1}) == sf::Color(0xFF, 0, 0));
+
+                const sf::Texture copy(texture); // NOLINT(performance-unnecessary-copy-initialization)
+                CHECK(copy.getFormat() == sf::Texture::Format::R8);
+                CHECK(copy.copyToImage().getPixel({0, 1}) == sf::Color(0xC0, 0, 0));
+
+                // Images are converted to the format of the texture
+                texture.update(sf::Image(sf::Vector2u(3, 2), sf::Color::Yellow));
+                CHECK(texture.copyToImage().getPixel({2, 1}) == sf::Color(0xFF, 0, 0));
+            }
+        }
+
+        SECTION("RG8")
+        {
+            if (sf::Texture::isFormatAvailable(sf::Texture::Format::RG8))
+            {
+                static constexpr std::array<std::uint8_t, 2> pixels = {0x20, 0x40};
+
+                sf::Texture texture(sf::Vector2u(1, 1), sf::Texture::Format::RG8);
+                texture.update(pixels.data());
+                CHECK(texture.copyToImage().getPixel({0, 0}) == sf::Color(0x20, 0x40, 0));
+            }
+        }
+
+        SECTION("R32F")
+        {
+            if (sf::Texture::isFormatAvailable(sf::Texture::Format::R32F))
+            {
+                static constexpr std::array<float, 2> pixels = {0.f, 2.5f};
+
+                sf::Texture texture(sf::Vector2u(2, 1), sf::Texture::Format::R32F);
+                texture.update(pixels.data());
+
+                // Values are clamped when converted to an image
+                const sf::Image image = texture.copyToImage();
+                CHECK(image.getPixel({0, 0}) == sf::Color::Black);
+                CHECK(image.getPixel({1, 0}) == sf::Color::Red);
+            }
+        }
+
+        SECTION("RGBA16F")
+        {
+            if (sf::Texture::isFormatAvailable(sf::Texture::Format::RGBA16F))
+            {
+                static constexpr std::array<float, 4> pixels = {4.f, 1.f, 0.f, 1.f};
+
+                sf::Texture texture;
+                CHECK(texture.resize({1, 1}, sf::Texture::Format::RGBA16F));
+                CHECK(texture.getFormat() == sf::Texture::Format::RGBA16F);
+                texture.update(pixels.data(), {1, 1}, {0, 0});
+                CHECK(texture.copyToImage().getPixel({0, 0}) == sf::Color::Yellow);
+            }
+        }
+    }
+
     SECTION("loadFromFile()")
     {
         sf::Texture texture;
@@ -357,6 +441,37 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
             CHECK(texture.copyToImage().getPixel(sf::Vector2u(7, 7)) == sf::Color::Red);
             CHECK(texture.copyToImage().getPixel(sf::Vector2u(7, 22)) == sf::Color::Green);
         }
+
+        SECTION("Image view")
+        {
+            sf::Image image(sf::Vector2u(16, 16), sf::Color::Red);
+            for (unsigned int y = 4; y < 8; ++y)
+                for (unsigned int x = 8; x < 12; ++x)
+                    image.setPixel({x, y}, sf::Color::Green);
+
+            sf::Texture texture(sf::Vector2u(8, 8));
+            texture.update(sf::ImageView(image).getSubView({{6, 2}, {8, 8}}));
+            const sf::Image result = texture.copyToImage();
+            CHECK(result.getPixel(sf::Vector2u(0, 0)) == sf::Color::Red);
+            CHECK(result.getPixel(sf::Vector2u(1, 1)) == sf::Color::Red);
+            CHECK(result.getPixel(sf::Vector2u(2, 2)) == sf::Color::Green);
+            CHECK(result.getPixel(sf::Vector2u(5, 5)) == sf::Color::Green);
+            CHECK(result.getPixel(sf::Vector2u(6, 6)) == sf::Color::Red);
+        }
+
+        SECTION("Image view and destination")
+        {
+            const sf::Image image(sf::Vector2u(16, 16), sf::Color::Green);
+            sf::Texture     texture(sf::Vector2u(8, 8));
+            texture.update(sf::Image(sf::Vector2u(8, 8), sf::Color::Red));
+            texture.update(sf::ImageView(image).getSubView({{1, 1}, {2, 3}}), sf::Vector2u(4, 4));
+            const sf::Image result = texture.copyToImage();
+            CHECK(result.getPixel(sf::Vector2u(3, 4)) == sf::Color::Red);
+            CHECK(result.getPixel(sf::Vector2u(4, 4)) == sf::Color::Green);
+            CHECK(result.getPixel(sf::Vector2u(5, 6)) == sf::Color::Green);
+            CHECK(result.getPixel(sf::Vector2u(6, 6)) == sf::Color::Red);
+            CHECK(result.getPixel(sf::Vector2u(5, 7)) == sf::Color::Red);
+        }
     }
 
     SECTION("Set/get smooth")
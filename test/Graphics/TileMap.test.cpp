@@ -0,0 +1,109 @@
+#include <SFML/Graphics/TileMap.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::TileMap", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_constructible_v<sf::TileMap, sf::Texture&&, sf::Vector2u, sf::Vector2u>);
+        STATIC_CHECK(!std::is_constructible_v<sf::TileMap, const sf::Texture&&, sf::Vector2u, sf::Vector2u>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::TileMap>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::TileMap>);
+        STATIC_CHECK(std::is_move_constructible_v<sf::TileMap>);
+        STATIC_CHECK(std::is_move_assignable_v<sf::TileMap>);
+    }
+
+    // Tileset made of two 1x1 tiles: red and green
+    sf::Image tilesetImage({2, 1}, sf::Color::Red);
+    tilesetImage.setPixel({1, 0}, sf::Color::Green);
+    const sf::Texture tileset(tilesetImage);
+
+    SECTION("Construction")
+    {
+        const sf::TileMap tileMap(tileset, {16, 8}, {100, 50});
+        CHECK(&tileMap.getTexture() == &tileset);
+        CHECK(tileMap.getTileSize() == sf::Vector2u(16, 8));
+        CHECK(tileMap.getMapSize() == sf::Vector2u(100, 50));
+        CHECK(tileMap.getChunkSize() == 32);
+        CHECK(tileMap.getTile({0, 0}) == 0);
+        CHECK(tileMap.getTile({99, 49}) == 0);
+        CHECK(tileMap.getLocalBounds() == sf::FloatRect({}, {1600, 400}));
+        CHECK(tileMap.getGlobalBounds() == sf::FloatRect({}, {1600, 400}));
+    }
+
+    SECTION("Set/get tile")
+    {
+        sf::TileMap tileMap(tileset, {1, 1}, {100, 50}, 16);
+        tileMap.setTile({42, 17}, 3);
+        CHECK(tileMap.getTile({42, 17}) == 3);
+        CHECK(tileMap.getTile({41, 17}) == 0);
+    }
+
+    SECTION("Set/get texture")
+    {
+        const sf::Texture otherTileset(sf::Vector2u(64, 64));
+        sf::TileMap       tileMap(tileset, {1, 1}, {10, 10});
+        tileMap.setTexture(otherTileset);
+        CHECK(&tileMap.getTexture() == &otherTileset);
+    }
+
+    SECTION("Get global bounds")
+    {
+        sf::TileMap tileMap(tileset, {2, 2}, {10, 20});
+        tileMap.setPosition({10, 20});
+        tileMap.setScale({2, 2});
+        CHECK(tileMap.getGlobalBounds() == sf::FloatRect({10, 20}, {40, 80}));
+    }
+
+    SECTION("draw()")
+    {
+        sf::RenderTexture renderTexture({8, 8});
+        renderTexture.clear(sf::Color::Blue);
+
+        // Several chunks, the last ones being partial
+        sf::TileMap tileMap(tileset, {1, 1}, {7, 7}, 3);
+        tileMap.setTile({6, 6}, 1);
+        renderTexture.draw(tileMap);
+        renderTexture.display();
+
+        sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({0, 0}) == sf::Color::Red);
+        CHECK(image.getPixel({5, 5}) == sf::Color::Red);
+        CHECK(image.getPixel({6, 6}) == sf::Color::Green);
+        CHECK(image.getPixel({7, 7}) == sf::Color::Blue);
+
+        SECTION("Tile updated after being drawn")
+        {
+            tileMap.setTile({0, 0}, 1);
+            tileMap.setTile({6, 6}, 0);
+            renderTexture.draw(tileMap);
+            renderTexture.display();
+
+            image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({0, 0}) == sf::Color::Green);
+            CHECK(image.getPixel({3, 3}) == sf::Color::Red);
+            CHECK(image.getPixel({6, 6}) == sf::Color::Red);
+        }
+
+        SECTION("Outside of the view")
+        {
+            renderTexture.clear(sf::Color::Blue);
+            tileMap.setPosition({100, 100});
+            renderTexture.draw(tileMap);
+            renderTexture.display();
+
+            image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({0, 0}) == sf::Color::Blue);
+        }
+    }
+}
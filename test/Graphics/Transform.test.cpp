@@ -1,5 +1,8 @@
 #include <SFML/Graphics/Transform.hpp>
 
+// Other 1st party headers
+#include <SFML/Graphics/Vertex.hpp>
+
 #include <SFML/System/Angle.hpp>
 
 #include <catch2/catch_test_macros.hpp>
@@ -86,6 +89,36 @@ TEST_CASE("[Graphics] sf::Transform")
                      sf::FloatRect({303.0f, 904.0f}, {600.0f, 1800.0f}));
     }
 
+    SECTION("transformPoints()")
+    {
+        const sf::Transform             transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f);
+        const std::vector<sf::Vector2f> points = {{-10.0f, -10.0f}, {-1.0f, -1.0f}, {0.0f, 0.0f}, {10.0f, 20.0f}};
+
+        std::vector<sf::Vector2f> result(points.size());
+        transform.transformPoints(points.data(), points.size(), result.data());
+        for (std::size_t i = 0; i < points.size(); ++i)
+            CHECK(result[i] == transform.transformPoint(points[i]));
+
+        SECTION("In place")
+        {
+            std::vector<sf::Vector2f> inPlace = points;
+            transform.transformPoints(inPlace.data(), inPlace.size(), inPlace.data());
+            CHECK(inPlace == result);
+        }
+    }
+
+    SECTION("transformVertices()")
+    {
+        const sf::Transform     transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f);
+        std::vector<sf::Vertex> vertices = {{{-1.0f, -1.0f}, sf::Color::Red, {1.0f, 2.0f}}, {{10.0f, 20.0f}}};
+
+        transform.transformVertices(vertices.data(), vertices.size());
+        CHECK(vertices[0].position == transform.transformPoint({-1.0f, -1.0f}));
+        CHECK(vertices[0].color == sf::Color::Red);
+        CHECK(vertices[0].texCoords == sf::Vector2f(1.0f, 2.0f));
+        CHECK(vertices[1].position == transform.transformPoint({10.0f, 20.0f}));
+    }
+
     SECTION("combine()")
     {
         auto identity = sf::Transform::Identity;
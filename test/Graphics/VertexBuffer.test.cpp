@@ -7,6 +7,7 @@
 
 #include <GraphicsUtil.hpp>
 #include <array>
+#include <cstdint>
 #include <type_traits>
 
 // Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
@@ -97,6 +98,96 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
         CHECK(vertexBuffer.getVertexCount() == 100);
     }
 
+    SECTION("create() with regions")
+    {
+        sf::VertexBuffer vertexBuffer;
+
+        SECTION("Single region")
+        {
+            CHECK(vertexBuffer.create(100, 1));
+            CHECK(vertexBuffer.getVertexCount() == 100);
+            CHECK(vertexBuffer.getRegionCount() == 1);
+            CHECK(vertexBuffer.mapRegion() == nullptr);
+        }
+
+        SECTION("Multiple regions")
+        {
+            CHECK(vertexBuffer.create(100, 3));
+            CHECK(vertexBuffer.getVertexCount() == 100);
+            CHECK(vertexBuffer.getRegionCount() == 3);
+            CHECK(vertexBuffer.getRegionOffset() == 0);
+            CHECK(vertexBuffer.getNativeHandle() != 0);
+        }
+
+        SECTION("Recreate without regions")
+        {
+            CHECK(vertexBuffer.create(100, 3));
+            CHECK(vertexBuffer.create(50));
+            CHECK(vertexBuffer.getVertexCount() == 50);
+            CHECK(vertexBuffer.getRegionCount() == 1);
+            CHECK(vertexBuffer.getRegionOffset() == 0);
+        }
+    }
+
+    SECTION("mapRegion()/unmapRegion()")
+    {
+        sf::VertexBuffer vertexBuffer(sf::VertexBuffer::Usage::Stream);
+
+        SECTION("Uninitialized buffer")
+        {
+            CHECK(vertexBuffer.mapRegion() == nullptr);
+            CHECK(!vertexBuffer.unmapRegion());
+        }
+
+        CHECK(vertexBuffer.create(64, 3));
+
+        SECTION("Unmap without map")
+        {
+            CHECK(!vertexBuffer.unmapRegion());
+        }
+
+        SECTION("Map twice")
+        {
+            CHECK(vertexBuffer.mapRegion() != nullptr);
+            CHECK(vertexBuffer.mapRegion() == nullptr);
+            CHECK(vertexBuffer.unmapRegion());
+        }
+
+        SECTION("Cycle through regions")
+        {
+            for (std::size_t frame = 1; frame <= 7; ++frame)
+            {
+                sf::Vertex* vertices = vertexBuffer.mapRegion();
+                REQUIRE(vertices != nullptr);
+                vertices[0]  = sf::Vertex{{static_cast<float>(frame), 0}};
+                vertices[63] = sf::Vertex{{0, static_cast<float>(frame)}};
+                CHECK(vertexBuffer.unmapRegion());
+                CHECK(vertexBuffer.getRegionOffset() == (frame % 3) * 64);
+            }
+        }
+
+        SECTION("update()")
+        {
+            std::array<sf::Vertex, 64> vertices{};
+            CHECK(vertexBuffer.update(vertices.data()));
+            CHECK(vertexBuffer.getRegionOffset() == 64);
+            CHECK(vertexBuffer.update(vertices.data(), 32, 0));
+            CHECK(vertexBuffer.getRegionOffset() == 128);
+            CHECK(!vertexBuffer.update(vertices.data(), 32, 16));
+        }
+
+        SECTION("Copy")
+        {
+            CHECK(vertexBuffer.mapRegion() != nullptr);
+            CHECK(vertexBuffer.unmapRegion());
+
+            const sf::VertexBuffer vertexBufferCopy(vertexBuffer); // NOLINT(performance-unnecessary-copy-initialization)
+            CHECK(vertexBufferCopy.getVertexCount() == 64);
+            CHECK(vertexBufferCopy.getRegionCount() == 1);
+            CHECK(vertexBufferCopy.getRegionOffset() == 0);
+        }
+    }
+
     SECTION("update()")
     {
         sf::VertexBuffer            vertexBuffer;
@@ -178,4 +269,51 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
         vertexBuffer.setUsage(sf::VertexBuffer::Usage::Dynamic);
         CHECK(vertexBuffer.getUsage() == sf::VertexBuffer::Usage::Dynamic);
     }
+
+    SECTION("Set/get layout")
+    {
+        struct CompactVertex
+        {
+            float         x, y;
+            std::uint8_t  r, g, b, a;
+            std::uint16_t u, v;
+        };
+
+        sf::VertexLayout layout;
+        layout.stride    = sizeof(CompactVertex);
+        layout.color     = sf::VertexLayout::Attribute{sf::VertexLayout::ComponentType::UnsignedByte, 4, 8, true};
+        layout.texCoords = sf::VertexLayout::Attribute{sf::VertexLayout::ComponentType::Short, 2, 12, false};
+
+        sf::VertexBuffer vertexBuffer;
+        vertexBuffer.setLayout(layout);
+        CHECK(vertexBuffer.getLayout().stride == sizeof(CompactVertex));
+        CHECK(vertexBuffer.create(10));
+
+        const std::array<CompactVertex, 10> compactVertices{};
+        CHECK(vertexBuffer.update(compactVertices.data(), compactVertices.size(), 0));
+
+        const std::array<sf::Vertex, 10> vertices{};
+        CHECK(!vertexBuffer.update(vertices.data(), vertices.size(), 0));
+    }
+
+    SECTION("Set layout of a created buffer")
+    {
+        struct LargeVertex
+        {
+            sf::Vertex           vertex;
+            std::array<float, 4> extra;
+        };
+
+        sf::VertexBuffer vertexBuffer;
+        REQUIRE(vertexBuffer.create(10, 3));
+
+        // The storage grows with the size of a vertex, the whole buffer can still be updated
+        sf::VertexLayout layout;
+        layout.stride = sizeof(LargeVertex);
+        vertexBuffer.setLayout(layout);
+        CHECK(vertexBuffer.getVertexCount() == 10);
+
+        const std::array<LargeVertex, 10> largeVertices{};
+        CHECK(vertexBuffer.update(largeVertices.data(), largeVertices.size(), 0));
+    }
 }
@@ -0,0 +1,123 @@
+#include <SFML/Graphics/VertexLayout.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <limits>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::VertexLayout")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::VertexLayout>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::VertexLayout>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::VertexLayout>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::VertexLayout>);
+        STATIC_CHECK(std::is_aggregate_v<sf::VertexLayout::Attribute>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::VertexLayout layout;
+        CHECK(layout.stride == sizeof(sf::Vertex));
+        CHECK(layout.position.type == sf::VertexLayout::ComponentType::Float);
+        CHECK(layout.position.componentCount == 2);
+        CHECK(layout.position.offset == 0);
+        REQUIRE(layout.color.has_value());
+        CHECK(layout.color->type == sf::VertexLayout::ComponentType::UnsignedByte);
+        CHECK(layout.color->componentCount == 4);
+        CHECK(layout.color->offset == 8);
+        REQUIRE(layout.texCoords.has_value());
+        CHECK(layout.texCoords->type == sf::VertexLayout::ComponentType::Float);
+        CHECK(layout.texCoords->componentCount == 2);
+        CHECK(layout.texCoords->offset == 12);
+        CHECK(layout.shaderAttributes.empty());
+        CHECK(layout.isValid());
+    }
+
+    SECTION("isValid()")
+    {
+        sf::VertexLayout layout;
+        layout.stride    = 12;
+        layout.position  = {sf::VertexLayout::ComponentType::Short, 2, 0};
+        layout.texCoords = {sf::VertexLayout::ComponentType::Short, 2, 4};
+        layout.color     = {sf::VertexLayout::ComponentType::UnsignedByte, 4, 8, true};
+        CHECK(layout.isValid());
+
+        SECTION("Without color and texture coordinates")
+        {
+            layout.color.reset();
+            layout.texCoords.reset();
+            CHECK(layout.isValid());
+        }
+
+        SECTION("Zero stride")
+        {
+            layout.stride = 0;
+            CHECK(!layout.isValid());
+        }
+
+        SECTION("Attribute outside of vertex")
+        {
+            layout.color->offset = 9;
+            CHECK(!layout.isValid());
+        }
+
+        SECTION("Unsupported position type")
+        {
+            layout.position.type = sf::VertexLayout::ComponentType::UnsignedShort;
+            CHECK(!layout.isValid());
+        }
+
+        SECTION("Unsupported component count")
+        {
+            layout.position.componentCount = 1;
+            CHECK(!layout.isValid());
+            layout.position.componentCount = 5;
+            CHECK(!layout.isValid());
+        }
+
+        SECTION("Shader attributes")
+        {
+            layout.stride = 16;
+            layout.shaderAttributes.push_back({"variation", {sf::VertexLayout::ComponentType::UnsignedShort, 1, 12}});
+            CHECK(layout.isValid());
+
+            layout.shaderAttributes.back().name.clear();
+            CHECK(!layout.isValid());
+        }
+    }
+
+    SECTION("getComponentSize()")
+    {
+        STATIC_CHECK(std::is_same_v<decltype(sf::VertexLayout::getComponentSize({})), std::size_t>);
+        CHECK(sf::VertexLayout::getComponentSize(sf::VertexLayout::ComponentType::Float) == 4);
+        CHECK(sf::VertexLayout::getComponentSize(sf::VertexLayout::ComponentType::HalfFloat) == 2);
+        CHECK(sf::VertexLayout::getComponentSize(sf::VertexLayout::ComponentType::Short) == 2);
+        CHECK(sf::VertexLayout::getComponentSize(sf::VertexLayout::ComponentType::UnsignedShort) == 2);
+        CHECK(sf::VertexLayout::getComponentSize(sf::VertexLayout::ComponentType::UnsignedByte) == 1);
+    }
+
+    SECTION("toHalfFloat()")
+    {
+        CHECK(sf::VertexLayout::toHalfFloat(0.f) == 0x0000);
+        CHECK(sf::VertexLayout::toHalfFloat(-0.f) == 0x8000);
+        CHECK(sf::VertexLayout::toHalfFloat(1.f) == 0x3C00);
+        CHECK(sf::VertexLayout::toHalfFloat(-2.f) == 0xC000);
+        CHECK(sf::VertexLayout::toHalfFloat(0.5f) == 0x3800);
+        CHECK(sf::VertexLayout::toHalfFloat(65504.f) == 0x7BFF);
+        CHECK(sf::VertexLayout::toHalfFloat(1.f / 3.f) == 0x3555);
+        CHECK(sf::VertexLayout::toHalfFloat(1.00048828125f) == 0x3C00); // Tie rounds to even
+        CHECK(sf::VertexLayout::toHalfFloat(1.00146484375f) == 0x3C02); // Tie rounds to even
+        CHECK(sf::VertexLayout::toHalfFloat(5.9604645e-8f) == 0x0001);  // Smallest subnormal
+        CHECK(sf::VertexLayout::toHalfFloat(6.1035156e-5f) == 0x0400);  // Smallest normal
+        CHECK(sf::VertexLayout::toHalfFloat(1e-10f) == 0x0000);
+        CHECK(sf::VertexLayout::toHalfFloat(65520.f) == 0x7C00);
+        CHECK(sf::VertexLayout::toHalfFloat(1e10f) == 0x7C00);
+        CHECK(sf::VertexLayout::toHalfFloat(-std::numeric_limits<float>::infinity()) == 0xFC00);
+        CHECK((sf::VertexLayout::toHalfFloat(std::numeric_limits<float>::quiet_NaN()) & 0x7FFF) > 0x7C00);
+    }
+}
@@ -1,9 +1,22 @@
 #include <SFML/Network/Http.hpp>
 
+// Other 1st party headers
+#include <SFML/Network/SocketSelector.hpp>
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+
 #include <catch2/catch_test_macros.hpp>
 
 #include <NetworkUtil.hpp>
+#include <array>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
+
+#include <cstddef>
 
 TEST_CASE("[Network] sf::Http")
 {
@@ -169,3 +182,144 @@ TEST_CASE("[Network] sf::Http Connection", runIpV4InternetTests())
         }
     }
 }
+
+TEST_CASE("[Network] sf::Http Loopback (IPv4)", runIpV4LoopbackTests())
+{
+    sf::TcpListener listener;
+    REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+    // Large body, split into many chunks that arrive over several receives
+    const std::string chunk(1000, 'x');
+    std::string       largeResponse = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n";
+    for (int i = 0; i < 200; ++i)
+        largeResponse += "3e8\r\n" + chunk + "\r\n";
+    largeResponse += "0\r\n\r\n";
+
+    // Responses of the test server, framed in the different ways supported by the client
+    const std::map<std::string, std::string> responses =
+        {{"/length", "HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nHello"},
+         {"/large", largeResponse},
+         {"/chunked", "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n5\r\nHello\r\n7\r\n, World\r\n0\r\n\r\n"},
+         {"/head", "HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\n"},
+         {"/drop", "HTTP/1.1 200 OK\r\nContent-Length: 4\r\n\r\nDrop"},
+         {"/close", "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 3\r\n\r\nBye"}};
+
+    constexpr std::size_t requestCount    = 11;
+    std::size_t           connectionCount = 0;
+    std::size_t           postCount       = 0;
+
+    // Answer the requests in order on each accepted connection, until they have all been answered
+    std::thread server(
+        [&]
+        {
+            // Give up if the client stops sending requests, instead of blocking forever
+            const auto waitFor = [](sf::Socket& socket)
+            {
+                sf::SocketSelector selector;
+                selector.add(socket);
+                return selector.wait(sf::seconds(5));
+            };
+
+            std::size_t answered = 0;
+            while ((answered < requestCount) && waitFor(listener))
+            {
+                sf::TcpSocket socket;
+                if (listener.accept(socket) != sf::Socket::Status::Done)
+                    return;
+
+                ++connectionCount;
+                std::string received;
+                bool        open = true;
+                while (open && (answered < requestCount))
+                {
+                    // The client adds a Content-Length field, but doesn't send any body in this test
+                    const std::string::size_type end = received.find("\r\n\r\n");
+                    if (end != std::string::npos)
+                    {
+                        std::istringstream requestLine(received.substr(0, end));
+                        std::string        method;
+                        std::string        uri;
+                        requestLine >> method >> uri;
+                        received.erase(0, end + 4);
+                        ++answered;
+
+                        // "/postdrop" closes the connection without answering, as if the server failed while
+                        // processing the request: the client can't know whether it was processed or not
+                        if (uri == "/postdrop")
+                        {
+                            ++postCount;
+                            open = false;
+                            continue;
+                        }
+
+                        const std::string& response = responses.at(uri);
+                        // "/drop" closes the connection without telling the client, like an idle timeout would
+                        open = (socket.send(response.c_str(), response.size()) == sf::Socket::Status::Done) &&
+                               (uri != "/close") && (uri != "/drop");
+                        continue;
+                    }
+
+                    std::array<char, 1024> buffer{};
+                    std::size_t            size = 0;
+                    open = waitFor(socket) &&
+                           (socket.receive(buffer.data(), buffer.size(), size) == sf::Socket::Status::Done);
+                    received.append(buffer.data(), size);
+                }
+            }
+        });
+
+    {
+        const sf::Http http("http://127.0.0.1", listener.getLocalPort(), sf::IpAddress::Type::IpV4);
+
+        // HTTP 1.0 request, kept alive on request of the client
+        const sf::Http::Response length = http.sendRequest(sf::Http::Request("length"), sf::seconds(5));
+        CHECK(length.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(length.getBody() == "Hello");
+
+        sf::Http::Request chunkedRequest("chunked");
+        chunkedRequest.setHttpVersion(1, 1);
+        const sf::Http::Response chunked = http.sendRequest(chunkedRequest, sf::seconds(5));
+        CHECK(chunked.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(chunked.getBody() == "Hello, World");
+
+        const sf::Http::Response large = http.sendRequest(sf::Http::Request("large"), sf::seconds(5));
+        CHECK(large.getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(large.getBody().size() == 200 * chunk.size());
+        CHECK(large.getBody().find_first_not_of('x') == std::string::npos);
+
+        // Pipelined requests, answered in order on the same connection
+        const std::vector<sf::Http::Request>  requests{sf::Http::Request("length"),
+                                                      sf::Http::Request("head", sf::Http::Request::Method::Head),
+                                                      sf::Http::Request("chunked")};
+        const std::vector<sf::Http::Response> pipelined = http.sendRequests(requests, sf::seconds(5));
+        REQUIRE(pipelined.size() == 3);
+        CHECK(pipelined[0].getBody() == "Hello");
+        CHECK(pipelined[1].getStatus() == sf::Http::Response::Status::Ok);
+        CHECK(pipelined[1].getField("Content-Length") == "5");
+        CHECK(pipelined[1].getBody().empty());
+        CHECK(pipelined[2].getBody() == "Hello, World");
+
+        // The server silently closes the connection after this response
+        const sf::Http::Response drop = http.sendRequest(sf::Http::Request("drop"), sf::seconds(5));
+        CHECK(drop.getBody() == "Drop");
+
+        // The idle connection is found closed, the request is sent again on a new one
+        const sf::Http::Response close = http.sendRequest(sf::Http::Request("close"), sf::seconds(5));
+        CHECK(close.getBody() == "Bye");
+
+        // The server announced that it closes the connection, the next request needs a new one
+        const sf::Http::Response reconnected = http.sendRequest(sf::Http::Request("close"), sf::seconds(5));
+        CHECK(reconnected.getBody() == "Bye");
+
+        // A POST request that is sent but not answered must not be sent again
+        const sf::Http::Response kept = http.sendRequest(sf::Http::Request("length"), sf::seconds(5));
+        CHECK(kept.getBody() == "Hello");
+        const sf::Http::Response post = http.sendRequest(sf::Http::Request("postdrop", sf::Http::Request::Method::Post),
+                                                         sf::seconds(5));
+        CHECK(post.getStatus() == sf::Http::Response::Status::ConnectionFailed);
+    }
+
+    server.join();
+    CHECK(connectionCount == 4);
+    CHECK(postCount == 1);
+}
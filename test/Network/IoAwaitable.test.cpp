@@ -0,0 +1,169 @@
+#include <SFML/Network/IoAwaitable.hpp>
+
+// Other 1st party headers
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <NetworkUtil.hpp>
+
+// The awaitables are only available when the tests are built with C++20 coroutines
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <array>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+namespace
+{
+// Coroutine that runs as soon as it is called, and that nobody waits for
+struct Task
+{
+    struct promise_type
+    {
+        Task get_return_object()
+        {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void()
+        {
+        }
+
+        void unhandled_exception()
+        {
+            std::terminate();
+        }
+    };
+};
+
+Task serve(sf::IoContext&                   context,
+           sf::TcpListener&                 listener,
+           sf::TcpSocket&                   server,
+           sf::Packet&                      packet,
+           std::vector<sf::Socket::Status>& statuses)
+{
+    statuses.push_back(co_await sf::asyncAccept(context, listener, server));
+    statuses.push_back(co_await sf::asyncReceive(context, server, packet));
+
+    // Nothing else is sent: the receive operation times out
+    std::array<std::byte, 16>  buffer{};
+    const sf::IoTransferResult result = co_await sf::asyncReceive(context,
+                                                                  server,
+                                                                  buffer.data(),
+                                                                  buffer.size(),
+                                                                  sf::milliseconds(50));
+    statuses.push_back(result.status);
+}
+
+Task connect(sf::IoContext&                   context,
+             sf::TcpSocket&                   client,
+             unsigned short                   port,
+             std::vector<sf::Socket::Status>& statuses)
+{
+    statuses.push_back(co_await sf::asyncConnect(context, client, sf::IpAddress::LocalHost, port));
+
+    sf::Packet packet;
+    packet << std::string("Hello");
+    statuses.push_back(co_await sf::asyncSend(context, client, packet));
+}
+
+Task receiveDatagram(sf::IoContext&                          context,
+                     sf::UdpSocket&                          socket,
+                     std::array<std::byte, 16>&              buffer,
+                     std::optional<sf::IoReceiveFromResult>& result)
+{
+    result = co_await sf::asyncReceive(context, socket, buffer.data(), buffer.size(), sf::seconds(10));
+}
+
+Task sendDatagram(sf::IoContext&                       context,
+                  sf::UdpSocket&                       socket,
+                  unsigned short                       port,
+                  std::optional<sf::IoTransferResult>& result)
+{
+    const std::array<std::byte, 4> data{std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}};
+    result = co_await sf::asyncSend(context, socket, data.data(), data.size(), sf::IpAddress::LocalHost, port);
+}
+} // namespace
+
+TEST_CASE("[Network] sf::IoAwaitable Loopback (IPv4)", runIpV4LoopbackTests())
+{
+    sf::IoContext context;
+
+    // Run the context until every coroutine is completed
+    const auto runAll = [&context]
+    {
+        while (context.getPendingCount() > 0)
+            REQUIRE(context.run(sf::seconds(10)) > 0);
+    };
+
+    SECTION("TCP")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpSocket                   server;
+        sf::TcpSocket                   client;
+        sf::Packet                      packet;
+        std::vector<sf::Socket::Status> serverStatuses;
+        std::vector<sf::Socket::Status> clientStatuses;
+        serve(context, listener, server, packet, serverStatuses);
+        connect(context, client, listener.getLocalPort(), clientStatuses);
+
+        // The coroutines are suspended until the context runs
+        CHECK(serverStatuses.empty());
+        CHECK(clientStatuses.empty());
+        runAll();
+
+        CHECK(serverStatuses ==
+              std::vector{sf::Socket::Status::Done, sf::Socket::Status::Done, sf::Socket::Status::NotReady});
+        CHECK(clientStatuses == std::vector{sf::Socket::Status::Done, sf::Socket::Status::Done});
+
+        std::string string;
+        CHECK(packet >> string);
+        CHECK(string == "Hello");
+    }
+
+    SECTION("UDP")
+    {
+        sf::UdpSocket receiver;
+        sf::UdpSocket sender;
+        REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        std::array<std::byte, 16>              buffer{};
+        std::optional<sf::IoReceiveFromResult> received;
+        std::optional<sf::IoTransferResult>    sent;
+        receiveDatagram(context, receiver, buffer, received);
+        sendDatagram(context, sender, receiver.getLocalPort(), sent);
+        runAll();
+
+        REQUIRE(sent.has_value());
+        CHECK(sent->status == sf::Socket::Status::Done);
+        CHECK(sent->size == 4);
+        REQUIRE(received.has_value());
+        CHECK(received->status == sf::Socket::Status::Done);
+        CHECK(received->size == 4);
+        CHECK(received->remoteAddress == sf::IpAddress::LocalHost);
+        CHECK(buffer[3] == std::byte{4});
+    }
+}
+
+#endif
@@ -0,0 +1,366 @@
+#include <SFML/Network/IoContext.hpp>
+
+// Other 1st party headers
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <NetworkUtil.hpp>
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+TEST_CASE("[Network] sf::IoContext")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::IoContext>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::IoContext>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::IoContext>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::IoContext>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::IoContext context;
+        CHECK(context.getBackend() != sf::IoContext::Backend::Automatic);
+        CHECK(context.getPendingCount() == 0);
+
+        const sf::IoContext readinessContext(sf::IoContext::Backend::Readiness);
+        CHECK(readinessContext.getBackend() == sf::IoContext::Backend::Readiness);
+    }
+
+    SECTION("Invalid operations")
+    {
+        const auto    backend = GENERATE(sf::IoContext::Backend::Automatic, sf::IoContext::Backend::Readiness);
+        sf::IoContext context(backend);
+        CHECK(context.run(sf::milliseconds(10)) == 0);
+        CHECK(context.poll() == 0);
+
+        std::array<std::byte, 16>       buffer{};
+        sf::UdpSocket                   socket;
+        std::vector<sf::Socket::Status> statuses;
+        context.asyncReceive(socket,
+                             buffer.data(),
+                             buffer.size(),
+                             [&](sf::Socket::Status status, std::size_t, std::optional<sf::IpAddress>, unsigned short)
+                             { statuses.push_back(status); });
+
+        std::vector<std::byte> datagram(sf::UdpSocket::MaxDatagramSize + 1);
+        context.asyncSend(socket,
+                          datagram.data(),
+                          datagram.size(),
+                          sf::IpAddress::LocalHost,
+                          1234,
+                          [&](sf::Socket::Status status, std::size_t) { statuses.push_back(status); });
+
+        // Callbacks are only called by run() and poll()
+        CHECK(statuses.empty());
+        CHECK(context.getPendingCount() == 2);
+        CHECK(context.poll() == 2);
+        CHECK(statuses == std::vector{sf::Socket::Status::Error, sf::Socket::Status::Error});
+        CHECK(context.getPendingCount() == 0);
+    }
+}
+
+TEST_CASE("[Network] sf::IoContext Loopback (IPv4)", runIpV4LoopbackTests())
+{
+    const auto    backend = GENERATE(sf::IoContext::Backend::Automatic, sf::IoContext::Backend::Readiness);
+    sf::IoContext context(backend);
+
+    // Run the context until every operation is completed
+    const auto runAll = [&context]
+    {
+        while (context.getPendingCount() > 0)
+            REQUIRE(context.run(sf::seconds(10)) > 0);
+    };
+
+    SECTION("TCP")
+    {
+        sf::TcpListener listener;
+        REQUIRE(listener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::TcpSocket server;
+        sf::TcpSocket client;
+
+        std::optional<sf::Socket::Status> acceptStatus;
+        std::optional<sf::Socket::Status> connectStatus;
+        context.asyncAccept(listener, server, [&](sf::Socket::Status status) { acceptStatus = status; });
+        context.asyncConnect(client,
+                             sf::IpAddress::LocalHost,
+                             listener.getLocalPort(),
+                             [&](sf::Socket::Status status) { connectStatus = status; });
+        runAll();
+
+        CHECK(acceptStatus == sf::Socket::Status::Done);
+        CHECK(connectStatus == sf::Socket::Status::Done);
+        CHECK(server.getRemotePort() == client.getLocalPort());
+        CHECK(!client.isBlocking());
+
+        // Large enough to require several system calls
+        std::vector<std::byte> sent(1024 * 1024);
+        for (std::size_t i = 0; i < sent.size(); ++i)
+            sent[i] = static_cast<std::byte>(i % 251);
+
+        std::optional<sf::Socket::Status> sendStatus;
+        std::size_t                       sentSize = 0;
+        context.asyncSend(server,
+                          sent.data(),
+                          sent.size(),
+                          [&](sf::Socket::Status status, std::size_t size)
+                          {
+                              sendStatus = status;
+                              sentSize   = size;
+                          });
+
+        // Receive until the whole buffer has arrived, starting a new operation from each callback
+        std::vector<std::byte>                               received(sent.size());
+        std::size_t                                          receivedSize = 0;
+        std::function<void(sf::Socket::Status, std::size_t)> onReceived;
+        onReceived = [&](sf::Socket::Status status, std::size_t size)
+        {
+            REQUIRE(status == sf::Socket::Status::Done);
+            receivedSize += size;
+            if (receivedSize < received.size())
+                context.asyncReceive(client, &received[receivedSize], received.size() - receivedSize, onReceived);
+        };
+        context.asyncReceive(client, received.data(), received.size(), onReceived);
+        runAll();
+
+        CHECK(sendStatus == sf::Socket::Status::Done);
+        CHECK(sentSize == sent.size());
+        CHECK(receivedSize == received.size());
+        CHECK(received == sent);
+
+        SECTION("Packets")
+        {
+            sf::Packet first;
+            first << std::uint32_t{42} << std::string("Hello");
+            sf::Packet empty;
+
+            std::vector<sf::Socket::Status> statuses;
+            const auto                      onCompleted = [&](sf::Socket::Status status) { statuses.push_back(status); };
+            context.asyncSend(server, first, onCompleted);
+            context.asyncSend(server, empty, onCompleted);
+
+            sf::Packet receivedFirst;
+            sf::Packet receivedEmpty;
+            context.asyncReceive(client,
+                                 receivedFirst,
+                                 [&](sf::Socket::Status status)
+                                 {
+                                     onCompleted(status);
+                                     context.asyncReceive(client, receivedEmpty, onCompleted);
+                                 });
+            runAll();
+
+            CHECK(statuses == std::vector<sf::Socket::Status>(4, sf::Socket::Status::Done));
+
+            std::uint32_t number = 0;
+            std::string   string;
+            CHECK(receivedFirst >> number >> string);
+            CHECK(number == 42);
+            CHECK(string == "Hello");
+            CHECK(receivedEmpty.getDataSize() == 0);
+        }
+
+        SECTION("Large packet")
+        {
+            std::vector<std::uint8_t> data(200'000);
+            std::iota(data.begin(), data.end(), std::uint8_t{0});
+            sf::Packet packet;
+            packet.append(data.data(), data.size());
+
+            std::vector<sf::Socket::Status> statuses;
+            const auto                      onCompleted = [&](sf::Socket::Status status) { statuses.push_back(status); };
+            sf::Packet                      receivedPacket;
+            context.asyncSend(server, packet, onCompleted);
+            context.asyncReceive(client, receivedPacket, onCompleted);
+            runAll();
+
+            CHECK(statuses == std::vector<sf::Socket::Status>(2, sf::Socket::Status::Done));
+            REQUIRE(receivedPacket.getDataSize() == data.size());
+            const auto* receivedData = static_cast<const std::uint8_t*>(receivedPacket.getData());
+            CHECK(std::equal(data.begin(), data.end(), receivedData));
+        }
+
+        SECTION("Announced size larger than the data")
+        {
+            // The peer announces almost 4 GiB and disconnects, the buffer must not be allocated upfront
+            const std::array<std::uint8_t, 6> data{0xFF, 0xFF, 0xFF, 0xF0, 1, 2};
+            REQUIRE(server.send(data.data(), data.size()) == sf::Socket::Status::Done);
+            server.disconnect();
+
+            std::optional<sf::Socket::Status> status;
+            sf::Packet                        packet;
+            context.asyncReceive(client, packet, [&](sf::Socket::Status receiveStatus) { status = receiveStatus; });
+            runAll();
+
+            CHECK(status == sf::Socket::Status::Disconnected);
+            CHECK(packet.getDataSize() == 0);
+        }
+
+        SECTION("Timeout")
+        {
+            std::optional<sf::Socket::Status> status;
+            sf::Packet                        packet;
+            int                               checks = 0;
+
+            SECTION("Time")
+            {
+                context.asyncReceive(
+                    client,
+                    packet,
+                    [&](sf::Socket::Status receiveStatus) { status = receiveStatus; },
+                    sf::milliseconds(50));
+            }
+
+            SECTION("Predicate")
+            {
+                context.asyncReceive(
+                    client,
+                    packet,
+                    [&](sf::Socket::Status receiveStatus) { status = receiveStatus; },
+                    sf::TimeoutWithPredicate([&checks] { return ++checks < 3; }, sf::milliseconds(10)));
+            }
+
+            runAll();
+            CHECK(status == sf::Socket::Status::NotReady);
+        }
+
+        SECTION("Timeout in the middle of a packet")
+        {
+            // A packet of 6 bytes, sent in 3 parts that split both its size and its data
+            const std::array<std::uint8_t, 10> data{0, 0, 0, 6, 1, 2, 3, 4, 5, 6};
+            std::vector<sf::Socket::Status>    statuses;
+            sf::Packet                         packet;
+
+            for (const auto& [begin, end] : {std::pair{0, 2}, std::pair{2, 7}, std::pair{7, 10}})
+            {
+                REQUIRE(server.send(data.data() + begin, static_cast<std::size_t>(end - begin)) ==
+                        sf::Socket::Status::Done);
+                context.asyncReceive(
+                    client,
+                    packet,
+                    [&](sf::Socket::Status status) { statuses.push_back(status); },
+                    sf::milliseconds(50));
+                runAll();
+            }
+
+            // The bytes received before each timeout are kept for the next operation
+            CHECK(statuses ==
+                  std::vector{sf::Socket::Status::NotReady, sf::Socket::Status::NotReady, sf::Socket::Status::Done});
+            REQUIRE(packet.getDataSize() == 6);
+            const auto* receivedData = static_cast<const std::uint8_t*>(packet.getData());
+            CHECK(std::equal(data.begin() + 4, data.end(), receivedData));
+        }
+
+        SECTION("Destruction with pending operations")
+        {
+            sf::TcpSocket             accepted;
+            std::array<std::byte, 16> buffer{};
+            bool                      called = false;
+            {
+                sf::IoContext pendingContext(backend);
+                pendingContext.asyncAccept(listener, accepted, [&](sf::Socket::Status) { called = true; });
+                pendingContext.asyncReceive(client,
+                                            buffer.data(),
+                                            buffer.size(),
+                                            [&](sf::Socket::Status, std::size_t) { called = true; });
+                CHECK(pendingContext.run(sf::milliseconds(10)) == 0);
+            }
+            CHECK(!called);
+
+            // The abandoned operations don't take the data and the connection that arrive afterwards
+            const std::array<std::byte, 4> data{std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}};
+            REQUIRE(server.send(data.data(), data.size()) == sf::Socket::Status::Done);
+            client.setBlocking(true);
+            std::size_t received = 0;
+            CHECK(client.receive(buffer.data(), buffer.size(), received) == sf::Socket::Status::Done);
+            CHECK(received == data.size());
+
+            sf::TcpSocket other;
+            REQUIRE(other.connect(sf::IpAddress::LocalHost, listener.getLocalPort()) == sf::Socket::Status::Done);
+            listener.setBlocking(true);
+            CHECK(listener.accept(accepted) == sf::Socket::Status::Done);
+        }
+
+        SECTION("Disconnection")
+        {
+            std::optional<sf::Socket::Status> status;
+            std::array<std::byte, 16>         buffer{};
+            context.asyncReceive(client,
+                                 buffer.data(),
+                                 buffer.size(),
+                                 [&](sf::Socket::Status receiveStatus, std::size_t) { status = receiveStatus; });
+            server.disconnect();
+            runAll();
+
+            CHECK(status == sf::Socket::Status::Disconnected);
+        }
+    }
+
+    SECTION("UDP")
+    {
+        sf::UdpSocket receiver;
+        REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        sf::UdpSocket sender;
+        REQUIRE(sender.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+        std::array<std::byte, 100> datagram{};
+        std::iota(reinterpret_cast<unsigned char*>(datagram.data()),
+                  reinterpret_cast<unsigned char*>(datagram.data() + datagram.size()),
+                  static_cast<unsigned char>(0));
+
+        std::array<std::byte, 200>   buffer{};
+        std::optional<sf::IpAddress> remoteAddress;
+        unsigned short               remotePort   = 0;
+        std::size_t                  receivedSize = 0;
+        context.asyncReceive(receiver,
+                             buffer.data(),
+                             buffer.size(),
+                             [&](sf::Socket::Status           status,
+                                 std::size_t                  size,
+                                 std::optional<sf::IpAddress> address,
+                                 unsigned short               port)
+                             {
+                                 CHECK(status == sf::Socket::Status::Done);
+                                 receivedSize  = size;
+                                 remoteAddress = address;
+                                 remotePort    = port;
+                             });
+
+        std::size_t sentSize = 0;
+        context.asyncSend(sender,
+                          datagram.data(),
+                          datagram.size(),
+                          sf::IpAddress::LocalHost,
+                          receiver.getLocalPort(),
+                          [&](sf::Socket::Status status, std::size_t size)
+                          {
+                              CHECK(status == sf::Socket::Status::Done);
+                              sentSize = size;
+                          });
+        runAll();
+
+        CHECK(sentSize == datagram.size());
+        REQUIRE(receivedSize == datagram.size());
+        CHECK(remoteAddress == sf::IpAddress::LocalHost);
+        CHECK(remotePort == sender.getLocalPort());
+        CHECK(std::equal(datagram.begin(), datagram.end(), buffer.begin()));
+    }
+}
@@ -5,11 +5,13 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
 #include <array>
 #include <limits>
 #include <type_traits>
 #include <vector>
 
+#include <cmath>
 #include <cstddef>
 #include <cwchar>
 
@@ -101,6 +103,33 @@ TEST_CASE("[Network] sf::Packet")
         CHECK(bool{packet});
     }
 
+    SECTION("allocate()")
+    {
+        sf::Packet packet;
+        packet.append(data.data(), 2);
+
+        std::byte* bytes = packet.allocate(3);
+        CHECK(packet.getDataSize() == 5);
+        CHECK(bytes == static_cast<const std::byte*>(packet.getData()) + 2);
+        CHECK(bytes[0] == std::byte{0});
+        CHECK(bytes[2] == std::byte{0});
+
+        bytes[1] = std::byte{42};
+        CHECK(static_cast<const std::byte*>(packet.getData())[3] == std::byte{42});
+    }
+
+    SECTION("reserve()")
+    {
+        sf::Packet packet;
+        packet.reserve(100);
+        CHECK(packet.getDataSize() == 0);
+
+        packet.append(data.data(), data.size());
+        const void* dataPtr = packet.getData();
+        packet.append(std::array<std::byte, 50>().data(), 50);
+        CHECK(packet.getData() == dataPtr);
+    }
+
     SECTION("Network ordering")
     {
         sf::Packet packet;
@@ -268,6 +297,288 @@ TEST_CASE("[Network] sf::Packet")
         }
     }
 
+    SECTION("Arrays")
+    {
+        sf::Packet packet;
+
+        SECTION("Network ordering")
+        {
+            static constexpr std::array<std::uint16_t, 2> values = {12'345, 1};
+            packet.writeArray(values.data(), values.size());
+            const auto*       dataPtr = static_cast<const std::byte*>(packet.getData());
+            const std::vector bytes(dataPtr, dataPtr + packet.getDataSize());
+            const std::vector expectedBytes{std::byte{0x30}, std::byte{0x39}, std::byte{0x00}, std::byte{0x01}};
+            CHECK(bytes == expectedBytes);
+        }
+
+        SECTION("Same encoding as stream operators")
+        {
+            static constexpr std::array<std::int64_t, 3> values = {-1,
+                                                                   std::numeric_limits<std::int64_t>::min(),
+                                                                   123'456'789'012};
+            packet.writeArray(values.data(), values.size());
+
+            sf::Packet expected;
+            for (const std::int64_t value : values)
+                expected << value;
+
+            const auto* dataPtr         = static_cast<const std::byte*>(packet.getData());
+            const auto* expectedDataPtr = static_cast<const std::byte*>(expected.getData());
+            CHECK(std::vector(dataPtr, dataPtr + packet.getDataSize()) ==
+                  std::vector(expectedDataPtr, expectedDataPtr + expected.getDataSize()));
+        }
+
+        SECTION("Round trip")
+        {
+            static constexpr std::array<std::uint8_t, 3>  bytes   = {1, 2, 255};
+            static constexpr std::array<std::int32_t, 4>  ints    = {-2, 0, 7, 2'000'000'000};
+            static constexpr std::array<std::uint64_t, 2> longs   = {1, std::numeric_limits<std::uint64_t>::max() - 1};
+            static constexpr std::array<float, 3>         floats  = {1.5f, -2.25f, 1e10f};
+            static constexpr std::array<double, 2>        doubles = {3.14159, -1e-300};
+            packet.writeArray(bytes.data(), bytes.size());
+            packet.writeArray(ints.data(), ints.size());
+            packet.writeArray(longs.data(), longs.size());
+            packet.writeArray(floats.data(), floats.size());
+            packet.writeArray(doubles.data(), doubles.size());
+            CHECK(packet.getDataSize() == 3 + 4 * 4 + 2 * 8 + 3 * 4 + 2 * 8);
+
+            std::array<std::uint8_t, 3>  receivedBytes{};
+            std::array<std::int32_t, 4>  receivedInts{};
+            std::array<std::uint64_t, 2> receivedLongs{};
+            std::array<float, 3>         receivedFloats{};
+            std::array<double, 2>        receivedDoubles{};
+            CHECK(packet.readArray(receivedBytes.data(), receivedBytes.size())
+                      .readArray(receivedInts.data(), receivedInts.size())
+                      .readArray(receivedLongs.data(), receivedLongs.size())
+                      .readArray(receivedFloats.data(), receivedFloats.size())
+                      .readArray(receivedDoubles.data(), receivedDoubles.size()));
+            CHECK(packet.endOfPacket());
+            CHECK(receivedBytes == bytes);
+            CHECK(receivedInts == ints);
+            CHECK(receivedLongs == longs);
+            CHECK(receivedFloats == floats);
+            CHECK(receivedDoubles == doubles);
+        }
+
+        SECTION("Read too many values")
+        {
+            static constexpr std::array<std::uint16_t, 2> values = {1, 2};
+            packet.writeArray(values.data(), values.size());
+
+            std::array<std::uint16_t, 3> received{};
+            CHECK(!packet.readArray(received.data(), received.size()));
+            CHECK(packet.getReadPosition() == 0);
+        }
+
+        SECTION("Attempt overflow")
+        {
+            packet.append(data.data(), data.size());
+
+            std::uint32_t value = 0;
+            CHECK(!packet.readArray(&value, std::numeric_limits<std::size_t>::max() / 2));
+            CHECK(packet.getReadPosition() == 0);
+        }
+    }
+
+    SECTION("Variable-length integers")
+    {
+        sf::Packet packet;
+
+        SECTION("Encoding")
+        {
+            packet.writeVarUint(0).writeVarUint(127).writeVarUint(300).writeVarInt(-1).writeVarInt(1);
+            const auto*       dataPtr = static_cast<const std::byte*>(packet.getData());
+            const std::vector bytes(dataPtr, dataPtr + packet.getDataSize());
+            const std::vector expectedBytes{std::byte{0x00},
+                                            std::byte{0x7F},
+                                            std::byte{0xAC},
+                                            std::byte{0x02},
+                                            std::byte{0x01},
+                                            std::byte{0x02}};
+            CHECK(bytes == expectedBytes);
+        }
+
+        SECTION("Round trip")
+        {
+            static constexpr std::array<std::uint64_t, 4> unsignedValues = {0,
+                                                                            128,
+                                                                            1'234'567'890'123,
+                                                                            std::numeric_limits<std::uint64_t>::max()};
+            static constexpr std::array<std::int64_t, 4>  signedValues   = {-64,
+                                                                            63,
+                                                                            std::numeric_limits<std::int64_t>::min(),
+                                                                            std::numeric_limits<std::int64_t>::max()};
+            for (const std::uint64_t value : unsignedValues)
+                packet.writeVarUint(value);
+            for (const std::int64_t value : signedValues)
+                packet.writeVarInt(value);
+            CHECK(packet.getDataSize() == 1 + 2 + 6 + 10 + 1 + 1 + 10 + 10);
+
+            for (const std::uint64_t value : unsignedValues)
+            {
+                std::uint64_t received = 0;
+                CHECK(packet.readVarUint(received));
+                CHECK(received == value);
+            }
+            for (const std::int64_t value : signedValues)
+            {
+                std::int64_t received = 0;
+                CHECK(packet.readVarInt(received));
+                CHECK(received == value);
+            }
+            CHECK(packet.endOfPacket());
+        }
+
+        SECTION("Truncated")
+        {
+            packet << std::uint8_t{0x80};
+            std::uint64_t received = 0;
+            CHECK(!packet.readVarUint(received));
+        }
+
+        SECTION("Too long")
+        {
+            const std::vector bytes(11, std::byte{0xFF});
+            packet.append(bytes.data(), bytes.size());
+            std::uint64_t received = 0;
+            CHECK(!packet.readVarUint(received));
+        }
+    }
+
+    SECTION("Bits")
+    {
+        sf::Packet packet;
+
+        SECTION("Packing")
+        {
+            packet.writeBits(1, 1).writeBits(0, 1).writeBits(1, 1).writeBits(0x1F, 5).writeBits(0x3FF, 10);
+            CHECK(packet.getDataSize() == 3);
+            const auto*       dataPtr = static_cast<const std::byte*>(packet.getData());
+            const std::vector bytes(dataPtr, dataPtr + packet.getDataSize());
+            const std::vector expectedBytes{std::byte{0xFD}, std::byte{0xFF}, std::byte{0x03}};
+            CHECK(bytes == expectedBytes);
+
+            std::array<std::uint32_t, 5> received{};
+            CHECK(packet.readBits(received[0], 1)
+                      .readBits(received[1], 1)
+                      .readBits(received[2], 1)
+                      .readBits(received[3], 5)
+                      .readBits(received[4], 10));
+            CHECK(received == std::array<std::uint32_t, 5>{1, 0, 1, 0x1F, 0x3FF});
+            CHECK(packet.endOfPacket());
+        }
+
+        SECTION("Mixed with bytes")
+        {
+            packet.writeBits(5, 3);
+            packet << std::uint8_t{42};
+            packet.writeBits(0xDEADBEEF, 32);
+            CHECK(packet.getDataSize() == 6);
+
+            std::uint32_t bits = 0;
+            std::uint8_t  byte = 0;
+            std::uint32_t word = 0;
+            CHECK(packet.readBits(bits, 3) >> byte);
+            CHECK(packet.readBits(word, 32));
+            CHECK(bits == 5);
+            CHECK(byte == 42);
+            CHECK(word == 0xDEADBEEF);
+        }
+
+        SECTION("Read too many bits")
+        {
+            packet.writeBits(3, 7);
+            std::uint32_t received = 0;
+            CHECK(!packet.readBits(received, 9));
+        }
+
+        SECTION("Quantized floats")
+        {
+            packet.writeQuantized(90.f, 0.f, 360.f, 12);
+            packet.writeQuantized(-5.f, -1.f, 1.f, 4);
+            packet.writeQuantized(0.5f, 0.f, 1.f, 32);
+            CHECK(packet.getDataSize() == 6);
+
+            float heading = 0;
+            float clamped = 0;
+            float precise = 0;
+            CHECK(packet.readQuantized(heading, 0.f, 360.f, 12)
+                      .readQuantized(clamped, -1.f, 1.f, 4)
+                      .readQuantized(precise, 0.f, 1.f, 32));
+            CHECK(std::abs(heading - 90.f) <= 360.f / 4095.f);
+            CHECK(clamped == -1.f);
+            CHECK(std::abs(precise - 0.5f) <= 1e-6f);
+        }
+    }
+
+    SECTION("Delta encoding")
+    {
+        sf::Packet baseline;
+        for (std::uint32_t i = 0; i < 100; ++i)
+            baseline << i;
+
+        sf::Packet packet;
+        SECTION("Same size")
+        {
+            for (std::uint32_t i = 0; i < 100; ++i)
+                packet << (i == 10 || i == 50 ? i + 1000 : i);
+        }
+
+        SECTION("Larger")
+        {
+            for (std::uint32_t i = 0; i < 120; ++i)
+                packet << i;
+        }
+
+        SECTION("Smaller")
+        {
+            for (std::uint32_t i = 0; i < 80; ++i)
+                packet << (i == 0 ? 7 : i);
+        }
+
+        SECTION("Empty")
+        {
+        }
+
+        const sf::Packet original = packet;
+        packet.makeDelta(baseline);
+        CHECK(packet.getDataSize() < original.getDataSize() / 2 + 2);
+
+        REQUIRE(packet.applyDelta(baseline));
+        CHECK(packet.getDataSize() == original.getDataSize());
+        if (original.getDataSize() > 0)
+        {
+            const auto* dataPtr     = static_cast<const std::byte*>(packet.getData());
+            const auto* originalPtr = static_cast<const std::byte*>(original.getData());
+            CHECK(std::equal(dataPtr, dataPtr + packet.getDataSize(), originalPtr));
+        }
+    }
+
+    SECTION("Invalid delta")
+    {
+        sf::Packet baseline;
+        baseline << std::uint32_t{1};
+
+        // 8 bytes, of which 6 are supposedly identical to a 4 byte baseline
+        sf::Packet packet;
+        packet.writeVarUint(8).writeVarUint(6).writeVarUint(2) << std::uint16_t{0};
+        const std::size_t size = packet.getDataSize();
+        CHECK(!packet.applyDelta(baseline));
+        CHECK(packet.getDataSize() == size);
+
+        // A size far larger than the baseline and the delta could ever provide, rejected before allocating
+        packet.clear();
+        packet.writeVarUint(std::uint64_t{1} << 40).writeVarUint(0).writeVarUint(1) << std::uint8_t{0};
+        CHECK(!packet.applyDelta(baseline));
+
+        packet.clear();
+        packet.writeVarUint(std::numeric_limits<std::uint64_t>::max());
+        CHECK(!packet.applyDelta(baseline));
+
+        packet.clear();
+        CHECK(!packet.applyDelta(baseline));
+    }
+
     SECTION("onSend")
     {
         Packet      packet;
@@ -49,6 +49,25 @@ TEST_CASE("[Network] sf::TcpListener")
         CHECK(tcpListener.getLocalPort() == 0);
     }
 
+    SECTION("setPortReuse()")
+    {
+        sf::TcpListener first;
+        sf::TcpListener second;
+        CHECK(first.setPortReuse(false));
+
+        if (first.setPortReuse(true))
+        {
+            CHECK(second.setPortReuse(true));
+            REQUIRE(first.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+            CHECK(second.listen(first.getLocalPort(), sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+            CHECK(second.getLocalPort() == first.getLocalPort());
+
+            // Listeners without port reuse can't share the port
+            sf::TcpListener third;
+            CHECK(third.listen(first.getLocalPort(), sf::IpAddress::LocalHost) == sf::Socket::Status::Error);
+        }
+    }
+
     SECTION("accept()")
     {
         sf::TcpListener tcpListener;
@@ -1,6 +1,8 @@
+#include <SFML/Network/Packet.hpp>
 #include <SFML/Network/SocketSelector.hpp>
 #include <SFML/Network/TcpListener.hpp>
 #include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/TlsSessionCache.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators_all.hpp>
@@ -9,6 +11,7 @@
 #include <algorithm>
 #include <chrono>
 #include <random>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -102,6 +105,8 @@ TEST_CASE("[Network] sf::Tcp Loopback (IPv4)", runIpV4LoopbackTests())
 
         CHECK(serverSocket.getCurrentCiphersuiteName() == std::nullopt);
         CHECK(clientSocket.getCurrentCiphersuiteName() == std::nullopt);
+        CHECK_FALSE(serverSocket.isTlsSessionResumed());
+        CHECK_FALSE(clientSocket.isTlsSessionResumed());
 
         const auto* sendPtr = testData.data();
         auto*       recvPtr = buffer.data();
@@ -201,6 +206,8 @@ TEST_CASE("[Network] sf::Tcp Loopback (IPv4)", runIpV4LoopbackTests())
         CHECK_FALSE(serverSocket.getCurrentCiphersuiteName() == std::nullopt);
         CHECK_FALSE(clientSocket.getCurrentCiphersuiteName() == std::nullopt);
         CHECK(serverSocket.getCurrentCiphersuiteName() == clientSocket.getCurrentCiphersuiteName());
+        CHECK_FALSE(serverSocket.isTlsSessionResumed());
+        CHECK_FALSE(clientSocket.isTlsSessionResumed());
 
         start = std::chrono::steady_clock::now();
 
@@ -603,3 +610,223 @@ TEST_CASE("[Network] sf::Tcp Loopback (IPv6)", runIpV6LoopbackTests())
         }
     }
 }
+
+TEST_CASE("[Network] sf::Tcp Loopback packets (IPv4)", runIpV4LoopbackTests())
+{
+    sf::TcpListener tcpListener;
+    REQUIRE(tcpListener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::TcpListener::Status::Done);
+
+    sf::TcpSocket clientSocket;
+    REQUIRE(clientSocket.connect(sf::IpAddress::LocalHost, tcpListener.getLocalPort(), sf::milliseconds(10000)) ==
+            sf::TcpSocket::Status::Done);
+
+    sf::TcpSocket serverSocket;
+    REQUIRE(tcpListener.accept(serverSocket) == sf::TcpListener::Status::Done);
+
+    // Packets of increasing sizes, the first one is empty and the last ones are too large to be sent at once
+    std::vector<sf::Packet>  packets(64);
+    std::vector<sf::Packet*> packetPointers;
+    for (std::size_t i = 0; i < packets.size(); ++i)
+    {
+        std::vector<std::byte> payload(i * i * 256);
+        std::generate(payload.begin(), payload.end(), [] { return static_cast<std::byte>(dist(rng)); });
+        packets[i].append(payload.data(), payload.size());
+        packetPointers.push_back(&packets[i]);
+    }
+
+    serverSocket.setBlocking(false);
+    clientSocket.setBlocking(false);
+
+    SECTION("Single packets")
+    {
+        std::size_t sent     = 0;
+        std::size_t received = 0;
+        const auto  start    = std::chrono::steady_clock::now();
+
+        while (received < packets.size())
+        {
+            if (sent < packets.size())
+            {
+                const auto status = serverSocket.send(packets[sent]);
+                REQUIRE_FALSE(status == sf::TcpSocket::Status::Error);
+                REQUIRE_FALSE(status == sf::TcpSocket::Status::Disconnected);
+                if (status == sf::TcpSocket::Status::Done)
+                    ++sent;
+            }
+
+            sf::Packet packet;
+            const auto status = clientSocket.receive(packet);
+            REQUIRE_FALSE(status == sf::TcpSocket::Status::Error);
+            REQUIRE_FALSE(status == sf::TcpSocket::Status::Disconnected);
+            if (status == sf::TcpSocket::Status::Done)
+            {
+                const auto* data     = static_cast<const std::byte*>(packet.getData());
+                const auto* expected = static_cast<const std::byte*>(packets[received].getData());
+                REQUIRE(packet.getDataSize() == packets[received].getDataSize());
+                CHECK(std::equal(data, data + packet.getDataSize(), expected));
+                ++received;
+            }
+
+            REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(10000));
+        }
+    }
+
+    SECTION("Several packets at once")
+    {
+        bool        sent     = false;
+        std::size_t received = 0;
+        const auto  start    = std::chrono::steady_clock::now();
+
+        while (received < packets.size())
+        {
+            if (!sent)
+            {
+                const auto status = serverSocket.send(packetPointers.data(), packetPointers.size());
+                REQUIRE_FALSE(status == sf::TcpSocket::Status::Error);
+                REQUIRE_FALSE(status == sf::TcpSocket::Status::Disconnected);
+                sent = (status == sf::TcpSocket::Status::Done);
+            }
+
+            sf::Packet packet;
+            const auto status = clientSocket.receive(packet);
+            REQUIRE_FALSE(status == sf::TcpSocket::Status::Error);
+            REQUIRE_FALSE(status == sf::TcpSocket::Status::Disconnected);
+            if (status == sf::TcpSocket::Status::Done)
+            {
+                const auto* data     = static_cast<const std::byte*>(packet.getData());
+                const auto* expected = static_cast<const std::byte*>(packets[received].getData());
+                REQUIRE(packet.getDataSize() == packets[received].getDataSize());
+                CHECK(std::equal(data, data + packet.getDataSize(), expected));
+                ++received;
+            }
+
+            REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(10000));
+        }
+    }
+
+    SECTION("Buffered packets")
+    {
+        // Most packets fit in the buffer, the largest ones bypass it
+        clientSocket.setPacketBufferSize(64 * 1024);
+        CHECK(clientSocket.getPacketBufferSize() == 64 * 1024);
+
+        bool        sent     = false;
+        std::size_t received = 0;
+        const auto  start    = std::chrono::steady_clock::now();
+
+        while (received < packets.size())
+        {
+            if (!sent)
+            {
+                const auto status = serverSocket.send(packetPointers.data(), packetPointers.size());
+                REQUIRE_FALSE(status == sf::TcpSocket::Status::Error);
+                REQUIRE_FALSE(status == sf::TcpSocket::Status::Disconnected);
+                sent = (status == sf::TcpSocket::Status::Done);
+            }
+
+            sf::Packet packet;
+            const auto status = clientSocket.receive(packet);
+            REQUIRE_FALSE(status == sf::TcpSocket::Status::Error);
+            REQUIRE_FALSE(status == sf::TcpSocket::Status::Disconnected);
+            if (status == sf::TcpSocket::Status::Done)
+            {
+                const auto* data     = static_cast<const std::byte*>(packet.getData());
+                const auto* expected = static_cast<const std::byte*>(packets[received].getData());
+                REQUIRE(packet.getDataSize() == packets[received].getDataSize());
+                CHECK(std::equal(data, data + packet.getDataSize(), expected));
+                ++received;
+            }
+
+            REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(10000));
+        }
+
+        clientSocket.setPacketBufferSize(0);
+        CHECK(clientSocket.getPacketBufferSize() == 0);
+    }
+}
+
+TEST_CASE("[Network] sf::Tcp Loopback TLS session resumption (IPv4)", runIpV4LoopbackTests())
+{
+    sf::TcpListener tcpListener;
+    tcpListener.setBlocking(false);
+    REQUIRE(tcpListener.listen(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::TcpListener::Status::Done);
+
+    sf::TlsSessionCache serverCache;
+    sf::TlsSessionCache clientCache;
+
+    // Connect, exchange a message over TLS and disconnect
+    const auto exchange = [&](bool verifyServer, bool resumed)
+    {
+        sf::TcpSocket serverSocket;
+        sf::TcpSocket clientSocket;
+        serverSocket.setTlsSessionCache(&serverCache);
+        clientSocket.setTlsSessionCache(&clientCache);
+        clientSocket.setBlocking(false);
+        REQUIRE(clientSocket.connect(sf::IpAddress::LocalHost, tcpListener.getLocalPort(), sf::milliseconds(10000)) ==
+                sf::TcpSocket::Status::NotReady);
+
+        auto start = std::chrono::steady_clock::now();
+
+        while (tcpListener.accept(serverSocket) != sf::TcpListener::Status::Done)
+            REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(10000));
+
+        serverSocket.setBlocking(false);
+        start = std::chrono::steady_clock::now();
+
+        while (true)
+        {
+            const auto serverStatus = serverSocket.setupTlsServer(certificate, privateKey);
+            REQUIRE_FALSE(serverStatus == sf::TcpSocket::TlsStatus::Error);
+
+            const auto clientStatus = verifyServer ? clientSocket.setupTlsClient(commonName, certificate)
+                                                   : clientSocket.setupTlsClient(commonName, false);
+            REQUIRE_FALSE(clientStatus == sf::TcpSocket::TlsStatus::Error);
+
+            if ((serverStatus == sf::TcpSocket::TlsStatus::HandshakeComplete) &&
+                (clientStatus == sf::TcpSocket::TlsStatus::HandshakeComplete))
+                break;
+
+            REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(10000));
+        }
+
+        CHECK(clientSocket.isTlsSessionResumed() == resumed);
+        CHECK(serverSocket.isTlsSessionResumed() == resumed);
+
+        // Receiving lets the client process the session ticket that TLS 1.3 servers send after the handshake
+        const std::string_view message = "Hello";
+        REQUIRE(serverSocket.send(message.data(), message.size()) == sf::TcpSocket::Status::Done);
+
+        std::string received(message.size(), '\0');
+        std::size_t receivedSize = 0;
+        start                    = std::chrono::steady_clock::now();
+
+        while (receivedSize < received.size())
+        {
+            std::size_t size   = 0;
+            const auto  status = clientSocket.receive(&received[receivedSize], received.size() - receivedSize, size);
+            REQUIRE_FALSE(status == sf::TcpSocket::Status::Error);
+            REQUIRE_FALSE(status == sf::TcpSocket::Status::Disconnected);
+            receivedSize += size;
+
+            REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(10000));
+        }
+
+        CHECK(received == message);
+        clientSocket.disconnect();
+        serverSocket.disconnect();
+    };
+
+    // Sessions aren't stored when the server isn't verified
+    exchange(false, false);
+    CHECK(clientCache.getSize() == 0);
+
+    exchange(true, false);
+    CHECK(clientCache.getSize() == 1);
+
+    // The second connection resumes the session stored by the first one
+    exchange(true, true);
+    CHECK(clientCache.getSize() == 1);
+
+    clientCache.clear();
+    CHECK(clientCache.getSize() == 0);
+}
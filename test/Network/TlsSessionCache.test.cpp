@@ -0,0 +1,47 @@
+#include <SFML/Network/TlsSessionCache.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <type_traits>
+
+#include <cstddef>
+
+TEST_CASE("[Network] sf::TlsSessionCache")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::TlsSessionCache>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::TlsSessionCache>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TlsSessionCache>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TlsSessionCache>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::TlsSessionCache cache;
+        CHECK(cache.getSize() == 0);
+
+        const sf::TlsSessionCache shortLivedCache(sf::seconds(60));
+        CHECK(shortLivedCache.getSize() == 0);
+    }
+
+    SECTION("clear()")
+    {
+        sf::TlsSessionCache cache;
+        cache.clear();
+        CHECK(cache.getSize() == 0);
+    }
+
+    SECTION("setTicketKey()")
+    {
+        sf::TlsSessionCache       cache;
+        std::array<std::byte, 32> key{};
+        key.fill(std::byte{0x5A});
+        CHECK(cache.setTicketKey(1, key));
+
+        // Keys can be rotated
+        key.fill(std::byte{0xA5});
+        CHECK(cache.setTicketKey(2, key));
+    }
+}
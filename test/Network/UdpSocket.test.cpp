@@ -2,7 +2,12 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <NetworkUtil.hpp>
+#include <array>
 #include <type_traits>
+#include <vector>
+
+#include <cstddef>
 
 TEST_CASE("[Network] sf::UdpSocket")
 {
@@ -49,3 +54,89 @@ TEST_CASE("[Network] sf::UdpSocket")
         }
     }
 }
+
+TEST_CASE("[Network] sf::UdpSocket Loopback batches (IPv4)", runIpV4LoopbackTests())
+{
+    sf::UdpSocket receiver;
+    REQUIRE(receiver.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+    sf::UdpSocket sender;
+    REQUIRE(sender.bind(sf::Socket::AnyPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+
+    // 100 datagrams of 100 bytes, the last one is smaller
+    static constexpr std::size_t datagramCount = 100;
+
+    std::vector<std::array<std::byte, 100>> payloads(datagramCount);
+    std::vector<sf::UdpSocket::Datagram>    datagrams(datagramCount);
+    for (std::size_t i = 0; i < datagramCount; ++i)
+    {
+        payloads[i].fill(static_cast<std::byte>(i));
+        datagrams[i] = {payloads[i].data(), payloads[i].size(), 0, sf::IpAddress::LocalHost, receiver.getLocalPort()};
+    }
+    datagrams.back().size = 10;
+
+    SECTION("Nothing to receive")
+    {
+        receiver.setBlocking(false);
+
+        std::array<std::byte, 100>             buffer{};
+        std::array<sf::UdpSocket::Datagram, 1> received{{{buffer.data(), buffer.size()}}};
+        std::size_t                            receivedCount = 0;
+        CHECK(receiver.receiveBatch(received.data(), received.size(), receivedCount) == sf::Socket::Status::NotReady);
+        CHECK(receivedCount == 0);
+    }
+
+    SECTION("Oversized datagram")
+    {
+        std::vector<std::byte>  buffer(sf::UdpSocket::MaxDatagramSize + 1);
+        sf::UdpSocket::Datagram datagram{buffer.data(), buffer.size(), 0, sf::IpAddress::LocalHost, 1234};
+        std::size_t             sent = 0;
+        CHECK(sender.sendBatch(&datagram, 1, sent) == sf::Socket::Status::Error);
+        CHECK(sent == 0);
+    }
+
+    SECTION("Send and receive")
+    {
+        CHECK(sender.setSegmentationOffload(false));
+
+        SECTION("Without segmentation offload")
+        {
+        }
+
+        SECTION("With segmentation offload")
+        {
+            // Not supported everywhere, the datagrams must be the same either way
+            (void)sender.setSegmentationOffload(true);
+        }
+
+        std::size_t sent = 0;
+        REQUIRE(sender.sendBatch(datagrams.data(), datagrams.size(), sent) == sf::Socket::Status::Done);
+        CHECK(sent == datagramCount);
+
+        std::vector<std::array<std::byte, 200>> buffers(datagramCount + 1);
+        std::vector<sf::UdpSocket::Datagram>    received(buffers.size());
+        for (std::size_t i = 0; i < buffers.size(); ++i)
+            received[i] = {buffers[i].data(), buffers[i].size()};
+
+        // Loopback datagrams are neither lost nor reordered
+        std::size_t receivedCount = 0;
+        while (receivedCount < datagramCount)
+        {
+            std::size_t count = 0;
+            REQUIRE(receiver.receiveBatch(received.data() + receivedCount, received.size() - receivedCount, count) ==
+                    sf::Socket::Status::Done);
+            REQUIRE(count > 0);
+            receivedCount += count;
+        }
+        CHECK(receivedCount == datagramCount);
+
+        for (std::size_t i = 0; i < datagramCount; ++i)
+        {
+            REQUIRE(received[i].received == datagrams[i].size);
+            CHECK(received[i].remoteAddress == sf::IpAddress::LocalHost);
+            CHECK(received[i].remotePort == sender.getLocalPort());
+            CHECK(buffers[i][0] == static_cast<std::byte>(i));
+            CHECK(buffers[i][received[i].received - 1] == static_cast<std::byte>(i));
+        }
+    }
+}
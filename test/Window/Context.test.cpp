@@ -9,6 +9,13 @@
 #include <string>
 #include <type_traits>
 
+#if defined(SFML_SYSTEM_LINUX) && defined(SFML_OPENGL_ES) && !defined(SFML_USE_DRM)
+#include <dlfcn.h>
+
+#include <cstdint>
+#include <cstdlib>
+#endif
+
 #if defined(SFML_SYSTEM_WINDOWS)
 #define GLAPI __stdcall
 #else
@@ -183,3 +190,83 @@ TEST_CASE("[Window] sf::Context", runDisplayTests())
         CHECK(sf::Context::getFunction("glIsEnabled"));
     }
 }
+
+#if defined(SFML_SYSTEM_LINUX) && defined(SFML_OPENGL_ES) && !defined(SFML_USE_DRM)
+namespace
+{
+// Check whether one of the headless EGL platforms used by SFML can be initialized, without going through SFML
+bool isHeadlessEglAvailable()
+{
+    void* library = dlopen("libEGL.so.1", RTLD_NOW | RTLD_LOCAL);
+    if (!library)
+        return false;
+
+    using GetProcAddress     = void* (*)(const char*);
+    using GetPlatformDisplay = void* (*)(unsigned int, void*, const std::int32_t*);
+    using QueryDevices       = unsigned int (*)(std::int32_t, void**, std::int32_t*);
+    using Initialize         = unsigned int (*)(void*, std::int32_t*, std::int32_t*);
+    using Terminate          = unsigned int (*)(void*);
+
+    constexpr unsigned int platformSurfacelessMesa = 0x31DD;
+    constexpr unsigned int platformDeviceExt       = 0x313F;
+
+    const auto getProcAddress = reinterpret_cast<GetProcAddress>(dlsym(library, "eglGetProcAddress"));
+    const auto initialize     = reinterpret_cast<Initialize>(dlsym(library, "eglInitialize"));
+    const auto terminate      = reinterpret_cast<Terminate>(dlsym(library, "eglTerminate"));
+
+    bool available = false;
+    if (getProcAddress && initialize && terminate)
+    {
+        const auto getPlatformDisplay = reinterpret_cast<GetPlatformDisplay>(
+            getProcAddress("eglGetPlatformDisplayEXT"));
+        const auto queryDevices = reinterpret_cast<QueryDevices>(getProcAddress("eglQueryDevicesEXT"));
+
+        // Same order as SFML: Mesa's surfaceless platform first, then the first EGL device
+        void* display = nullptr;
+        if (getPlatformDisplay)
+        {
+            display = getPlatformDisplay(platformSurfacelessMesa, nullptr, nullptr);
+
+            void*        device      = nullptr;
+            std::int32_t deviceCount = 0;
+            if (!display && queryDevices && queryDevices(1, &device, &deviceCount) && (deviceCount > 0))
+                display = getPlatformDisplay(platformDeviceExt, device, nullptr);
+        }
+
+        if (display && initialize(display, nullptr, nullptr))
+        {
+            available = true;
+            terminate(display);
+        }
+    }
+
+    dlclose(library);
+    return available;
+}
+} // namespace
+
+TEST_CASE("[Window] sf::Context Headless (EGL)")
+{
+    // The headless EGL platforms are only used when there's no X server to connect to
+    if (std::getenv("DISPLAY") != nullptr)
+        SKIP("An X server is configured");
+
+    if (!isHeadlessEglAvailable())
+        SKIP("No headless EGL platform is available");
+
+    SECTION("Default construction")
+    {
+        const sf::Context context;
+        CHECK(context.getSettings().majorVersion > 0);
+        CHECK(sf::Context::getActiveContext() == &context);
+    }
+
+    SECTION("Construction with a size")
+    {
+        const sf::Context context(sf::ContextSettings{}, {64, 32});
+        CHECK(context.getSettings().majorVersion > 0);
+        CHECK(sf::Context::getActiveContext() == &context);
+        CHECK(sf::Context::getFunction("glGetString"));
+    }
+}
+#endif